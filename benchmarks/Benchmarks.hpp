@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BENCHMARKS_HPP
+#define TGUI_BENCHMARKS_HPP
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Runs benchmarks and collects their timings
+class BenchmarkRunner
+{
+public:
+
+    // Only benchmarks containing the filter in their name will be run
+    explicit BenchmarkRunner(std::string filter);
+
+    // Checks whether a benchmark with the given name is going to run, to skip an expensive setup when it won't
+    bool isEnabled(const std::string& name) const;
+
+    // Calls the function once to warm up and then the given amount of times while measuring each call
+    void run(const std::string& name, unsigned int iterations, const std::function<void()>& function);
+
+    // Writes all results as a JSON document
+    void writeJson(std::ostream& stream) const;
+
+private:
+
+    struct Result
+    {
+        std::string name;
+        unsigned int iterations;
+        double totalMs;
+        double meanMs;
+        double medianMs;
+        double minMs;
+        double maxMs;
+    };
+
+    std::string m_filter;
+    std::vector<Result> m_results;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The benchmarks draw on an offscreen render texture, so no window is needed
+void runCreationBenchmarks(BenchmarkRunner& runner);
+void runLoadingBenchmarks(BenchmarkRunner& runner);
+void runEventBenchmarks(BenchmarkRunner& runner, sf::RenderTexture& target);
+void runTextBenchmarks(BenchmarkRunner& runner, sf::RenderTexture& target);
+void runDrawBenchmarks(BenchmarkRunner& runner, sf::RenderTexture& target);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BENCHMARKS_HPP
@@ -0,0 +1,219 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmarks.hpp"
+#include <TGUI/TGUI.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const unsigned int widgetsPerIteration = 1000;
+
+    template <typename WidgetType>
+    void benchmarkCreation(BenchmarkRunner& runner, const std::string& typeName)
+    {
+        std::vector<tgui::Widget::Ptr> widgets;
+        widgets.reserve(widgetsPerIteration);
+
+        runner.run("create/" + typeName + "/x1000", 20, [&]{
+            widgets.clear();
+            for (unsigned int i = 0; i < widgetsPerIteration; ++i)
+                widgets.push_back(WidgetType::create());
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void benchmarkLayouts(BenchmarkRunner& runner)
+    {
+        std::vector<tgui::Layout> layouts;
+        layouts.reserve(widgetsPerIteration);
+
+        runner.run("layout/parse/x1000", 20, [&]{
+            layouts.clear();
+            for (unsigned int i = 0; i < widgetsPerIteration; ++i)
+                layouts.emplace_back("(parent.width - 20) / 3 + prev.right * 2");
+        });
+
+        const tgui::Layout layout{"(parent.width - 20) / 3 + prev.right * 2"};
+        runner.run("layout/copy/x1000", 20, [&]{
+            layouts.clear();
+            for (unsigned int i = 0; i < widgetsPerIteration; ++i)
+                layouts.push_back(layout);
+        });
+
+        // Every widget is positioned relative to the previous one, like in a generated form
+        runner.run("layout/form/x1000", 10, [&]{
+            auto panel = tgui::Panel::create({800, 600});
+            for (unsigned int i = 0; i < widgetsPerIteration; ++i)
+            {
+                auto editBox = tgui::EditBox::create();
+                if (i > 0)
+                    editBox->setPosition({"w" + tgui::to_string(i-1) + ".left", "w" + tgui::to_string(i-1) + ".bottom + 5"});
+                editBox->setSize({"parent.width - 20", "20"});
+                panel->add(editBox, "w" + tgui::to_string(i));
+            }
+
+            panel->setSize({1024, 768});
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Builds a panel with rows of widgets, like a template for an inventory grid or table rows
+    tgui::Panel::Ptr createTemplatePanel(unsigned int widgetCount)
+    {
+        auto panel = tgui::Panel::create({800, 600});
+        for (unsigned int i = 0; i < widgetCount; ++i)
+        {
+            const std::string name = "w" + tgui::to_string(i);
+            const tgui::Layout2d position{"(" + tgui::to_string(i % 4) + " * parent.width / 4)", tgui::to_string((i / 4) * 25)};
+
+            tgui::Widget::Ptr widget;
+            switch (i % 4)
+            {
+                case 0: widget = tgui::Label::create("Item " + tgui::to_string(i)); break;
+                case 1: widget = tgui::Button::create("Use"); break;
+                case 2: widget = tgui::EditBox::create(); break;
+                case 3: widget = tgui::ProgressBar::create(); break;
+            }
+
+            widget->setPosition(position);
+            widget->setSize({"parent.width / 4 - 5", 20});
+            panel->add(widget, name);
+        }
+
+        return panel;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void benchmarkCloning(BenchmarkRunner& runner)
+    {
+        for (const unsigned int widgetCount : {100u, 1000u})
+        {
+            const std::string suffix = "/x" + tgui::to_string(widgetCount);
+            if (!runner.isEnabled("build/Panel" + suffix) && !runner.isEnabled("clone/Panel" + suffix)
+             && !runner.isEnabled("clone/Panel/inherited" + suffix))
+                continue;
+
+            const auto panel = createTemplatePanel(widgetCount);
+
+            // Building the subtree from scratch is the baseline that cloning should beat
+            runner.run("build/Panel" + suffix, 10, [&]{ createTemplatePanel(widgetCount); });
+            runner.run("clone/Panel" + suffix, 10, [&]{ tgui::Panel::copy(panel); });
+
+            // Cloning a panel that lies inside a semi-transparent parent
+            auto parent = tgui::Panel::create();
+            parent->setInheritedOpacity(0.5f);
+            parent->add(panel);
+            runner.run("clone/Panel/inherited" + suffix, 10, [&]{ tgui::Panel::copy(panel); });
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void benchmarkContainerChanges(BenchmarkRunner& runner)
+    {
+        const unsigned int widgetCount = 10000;
+        std::vector<tgui::Widget::Ptr> widgets;
+        for (unsigned int i = 0; i < widgetCount; ++i)
+            widgets.push_back(tgui::ClickableWidget::create());
+
+        auto group = tgui::Group::create();
+        runner.run("container/add/x10000", 10, [&]{
+            group->removeAllWidgets();
+            for (const auto& widget : widgets)
+                group->add(widget);
+        });
+
+        runner.run("container/addWidgets/x10000", 10, [&]{
+            group->removeAllWidgets();
+            group->addWidgets(widgets);
+        });
+
+        // Removes the widgets in the order in which they were added, which is the worst case for a vector
+        runner.run("container/remove/x10000", 5, [&]{
+            group->addWidgets(widgets);
+            for (const auto& widget : widgets)
+                group->remove(widget);
+        });
+
+        runner.run("container/removeWidgets/x10000", 5, [&]{
+            group->addWidgets(widgets);
+            group->removeWidgets([](const tgui::Widget::Ptr&){ return true; });
+        });
+
+        group->addWidgets(widgets);
+        runner.run("container/getWidgetName/x10000", 10, [&]{
+            for (const auto& widget : widgets)
+                group->getWidgetName(widget);
+        });
+
+        std::vector<tgui::Widget::Ptr> reversed(widgets.rbegin(), widgets.rend());
+        runner.run("container/reorder/x10000", 10, [&]{ group->reorder(reversed); });
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void runCreationBenchmarks(BenchmarkRunner& runner)
+{
+    benchmarkCreation<tgui::BitmapButton>(runner, "BitmapButton");
+    benchmarkCreation<tgui::Button>(runner, "Button");
+    benchmarkCreation<tgui::Canvas>(runner, "Canvas");
+    benchmarkCreation<tgui::ChatBox>(runner, "ChatBox");
+    benchmarkCreation<tgui::CheckBox>(runner, "CheckBox");
+    benchmarkCreation<tgui::ChildWindow>(runner, "ChildWindow");
+    benchmarkCreation<tgui::ComboBox>(runner, "ComboBox");
+    benchmarkCreation<tgui::EditBox>(runner, "EditBox");
+    benchmarkCreation<tgui::Grid>(runner, "Grid");
+    benchmarkCreation<tgui::Group>(runner, "Group");
+    benchmarkCreation<tgui::HorizontalLayout>(runner, "HorizontalLayout");
+    benchmarkCreation<tgui::HorizontalWrap>(runner, "HorizontalWrap");
+    benchmarkCreation<tgui::Knob>(runner, "Knob");
+    benchmarkCreation<tgui::Label>(runner, "Label");
+    benchmarkCreation<tgui::ListBox>(runner, "ListBox");
+    benchmarkCreation<tgui::MenuBar>(runner, "MenuBar");
+    benchmarkCreation<tgui::MessageBox>(runner, "MessageBox");
+    benchmarkCreation<tgui::Panel>(runner, "Panel");
+    benchmarkCreation<tgui::Picture>(runner, "Picture");
+    benchmarkCreation<tgui::ProgressBar>(runner, "ProgressBar");
+    benchmarkCreation<tgui::RadioButton>(runner, "RadioButton");
+    benchmarkCreation<tgui::RadioButtonGroup>(runner, "RadioButtonGroup");
+    benchmarkCreation<tgui::RangeSlider>(runner, "RangeSlider");
+    benchmarkCreation<tgui::ScrollablePanel>(runner, "ScrollablePanel");
+    benchmarkCreation<tgui::Scrollbar>(runner, "Scrollbar");
+    benchmarkCreation<tgui::Slider>(runner, "Slider");
+    benchmarkCreation<tgui::SpinButton>(runner, "SpinButton");
+    benchmarkCreation<tgui::Tabs>(runner, "Tabs");
+    benchmarkCreation<tgui::TextBox>(runner, "TextBox");
+    benchmarkCreation<tgui::VerticalLayout>(runner, "VerticalLayout");
+
+    benchmarkLayouts(runner);
+    benchmarkCloning(runner);
+    benchmarkContainerChanges(runner);
+}
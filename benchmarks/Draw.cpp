@@ -0,0 +1,178 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmarks.hpp"
+#include <TGUI/TGUI.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    void benchmarkDraw(BenchmarkRunner& runner, sf::RenderTexture& target, unsigned int widgetCount)
+    {
+        const std::string name = "draw/" + tgui::to_string(widgetCount) + "-widgets";
+        if (!runner.isEnabled(name))
+            return;
+
+        tgui::Gui gui{target};
+
+        // About half of the widgets are placed inside panels so that clipping is part of the measurement
+        const unsigned int panelCount = widgetCount / 20;
+        for (unsigned int i = 0; i < panelCount; ++i)
+        {
+            auto panel = tgui::Panel::create({100, 100});
+            panel->setPosition({(i % 10) * 100.f, ((i / 10) % 7) * 100.f});
+            gui.add(panel);
+
+            for (unsigned int j = 0; j < 10; ++j)
+            {
+                auto label = tgui::Label::create("Label");
+                label->setPosition({5, j * 10.f});
+                panel->add(label);
+            }
+        }
+
+        for (unsigned int i = panelCount * 11; i < widgetCount; ++i)
+        {
+            auto button = tgui::Button::create("Button");
+            button->setPosition({(i % 50) * 20.f, ((i / 50) % 38) * 20.f});
+            button->setSize({18, 18});
+            gui.add(button);
+        }
+
+        runner.run(name, 100, [&]{
+            target.clear();
+            gui.draw();
+            target.display();
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void benchmarkCanvas(BenchmarkRunner& runner)
+    {
+        if (!runner.isEnabled("canvas/"))
+            return;
+
+        // Resizing the canvas by a few pixels every frame, like when it is inside a layout while the window is resized
+        auto canvas = tgui::Canvas::create({400, 300});
+        unsigned int frame = 0;
+        runner.run("canvas/resize/x100", 10, [&]{
+            for (unsigned int i = 0; i < 100; ++i, ++frame)
+                canvas->setSize({400.f + (frame % 200), 300.f + (frame % 100)});
+        });
+
+        // A strip chart that only draws one new column every frame
+        const sf::RectangleShape strip{{4, 300}};
+        runner.run("canvas/scroll/x100", 10, [&]{
+            for (unsigned int i = 0; i < 100; ++i)
+            {
+                canvas->scroll({-4, 0});
+                canvas->draw(strip);
+                canvas->display();
+            }
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void benchmarkListView(BenchmarkRunner& runner, sf::RenderTexture& target, std::size_t rowCount)
+    {
+        const std::string name = "listview/scroll/" + tgui::to_string(rowCount) + "-rows";
+        if (!runner.isEnabled(name))
+            return;
+
+        tgui::Gui gui{target};
+
+        auto listView = tgui::ListView::create();
+        listView->setSize({600, 400});
+        for (unsigned int i = 0; i < 5; ++i)
+            listView->addColumn("Column " + tgui::to_string(i), 110);
+        listView->setDataProvider([](std::size_t row, std::size_t column){ return tgui::to_string(row * 10 + column); }, rowCount);
+        gui.add(listView);
+
+        // Jump through the whole list, the cost should not depend on the amount of rows
+        const unsigned int maximum = static_cast<unsigned int>(std::min<std::size_t>(rowCount * listView->getRowHeight(), 0xFFFFFFFFu));
+        const unsigned int step = std::max(1u, maximum / 1000);
+        unsigned int value = 0;
+        runner.run(name, 100, [&]{
+            for (unsigned int i = 0; i < 10; ++i)
+            {
+                value = (value + step) % maximum;
+                listView->setVerticalScrollbarValue(value);
+                target.clear();
+                gui.draw();
+                target.display();
+            }
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void benchmarkTreeView(BenchmarkRunner& runner, sf::RenderTexture& target, std::size_t childCount)
+    {
+        const std::string name = "treeview/expand/" + tgui::to_string(childCount) + "-children";
+        if (!runner.isEnabled(name))
+            return;
+
+        tgui::Gui gui{target};
+
+        auto treeView = tgui::TreeView::create();
+        treeView->setSize({300, 400});
+        treeView->setChildrenProvider([childCount](const std::vector<sf::String>& hierarchy){
+                std::vector<tgui::TreeView::Item> items(hierarchy.empty() ? 100 : (hierarchy.size() == 1) ? childCount : 0);
+                for (std::size_t i = 0; i < items.size(); ++i)
+                    items[i] = {tgui::to_string(i), hierarchy.size() < 2};
+                return items;
+            });
+        gui.add(treeView);
+
+        // Children are only loaded once, afterwards only the rows of the subtree are inserted and removed
+        treeView->expand({"50"});
+        runner.run(name, 100, [&]{
+            for (unsigned int i = 0; i < 10; ++i)
+            {
+                treeView->collapse({"50"});
+                treeView->expand({"50"});
+                target.clear();
+                gui.draw();
+                target.display();
+            }
+        });
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void runDrawBenchmarks(BenchmarkRunner& runner, sf::RenderTexture& target)
+{
+    benchmarkDraw(runner, target, 1000);
+    benchmarkDraw(runner, target, 10000);
+    benchmarkCanvas(runner);
+    benchmarkListView(runner, target, 1000);
+    benchmarkListView(runner, target, 10000000);
+    benchmarkTreeView(runner, target, 1000);
+    benchmarkTreeView(runner, target, 100000);
+}
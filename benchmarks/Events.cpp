@@ -0,0 +1,127 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmarks.hpp"
+#include <TGUI/TGUI.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Places the widgets in a grid of 20x20 pixel cells covering the render target
+    void fillGrid(tgui::Container& container, unsigned int count)
+    {
+        const unsigned int columns = static_cast<unsigned int>(container.getSize().x / 20);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            auto button = tgui::Button::create();
+            button->setPosition({20.f * (i % columns), 20.f * ((i / columns) % 38)});
+            button->setSize({18, 18});
+            container.add(button);
+        }
+    }
+
+    void benchmarkMouseMoves(BenchmarkRunner& runner, sf::RenderTexture& target, unsigned int widgetCount)
+    {
+        const std::string suffix = "/" + tgui::to_string(widgetCount) + "-widgets";
+        if (!runner.isEnabled("events/mouse-move-x10000" + suffix) && !runner.isEnabled("events/queued-mouse-move-x10000" + suffix))
+            return;
+
+        tgui::Gui gui{target};
+        fillGrid(*gui.getContainer(), widgetCount);
+
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        runner.run("events/mouse-move-x10000" + suffix, 10, [&]{
+            for (int i = 0; i < 10000; ++i)
+            {
+                event.mouseMove.x = (i * 7) % static_cast<int>(target.getSize().x);
+                event.mouseMove.y = (i * 13) % static_cast<int>(target.getSize().y);
+                gui.handleEvent(event);
+            }
+        });
+
+        // With the queued input mode all moves within a frame are collapsed into one
+        runner.run("events/queued-mouse-move-x10000" + suffix, 10, [&]{
+            for (int i = 0; i < 10000; ++i)
+            {
+                event.mouseMove.x = (i * 7) % static_cast<int>(target.getSize().x);
+                event.mouseMove.y = (i * 13) % static_cast<int>(target.getSize().y);
+                gui.queueEvent(event);
+
+                if (i % 10 == 9)
+                    gui.handleQueuedEvents();
+            }
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Every progress bar receives 10 new values per frame, as if they were produced at a much higher rate than the frame rate
+    void benchmarkBoundValues(BenchmarkRunner& runner, unsigned int widgetCount)
+    {
+        const std::string suffix = "/" + tgui::to_string(widgetCount) + "-widgets";
+        if (!runner.isEnabled("events/set-values" + suffix) && !runner.isEnabled("events/bound-values" + suffix))
+            return;
+
+        std::vector<tgui::ProgressBar::Ptr> progressBars;
+        std::vector<tgui::BoundValue<unsigned int>::Ptr> values;
+        tgui::Bindings bindings;
+        for (unsigned int i = 0; i < widgetCount; ++i)
+        {
+            progressBars.push_back(tgui::ProgressBar::create());
+            values.push_back(tgui::BoundValue<unsigned int>::create());
+            bindings.bind(values.back(), progressBars.back(), &tgui::ProgressBar::setValue);
+        }
+
+        unsigned int frame = 0;
+        runner.run("events/set-values" + suffix, 10, [&]{
+            for (unsigned int i = 0; i < 10; ++i, ++frame)
+            {
+                for (auto& progressBar : progressBars)
+                    progressBar->setValue(frame % 100);
+            }
+        });
+
+        runner.run("events/bound-values" + suffix, 10, [&]{
+            for (unsigned int i = 0; i < 10; ++i, ++frame)
+            {
+                for (auto& value : values)
+                    value->set(frame % 100);
+            }
+
+            bindings.update();
+        });
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void runEventBenchmarks(BenchmarkRunner& runner, sf::RenderTexture& target)
+{
+    benchmarkMouseMoves(runner, target, 100);
+    benchmarkMouseMoves(runner, target, 1000);
+    benchmarkBoundValues(runner, 1000);
+}
@@ -0,0 +1,102 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmarks.hpp"
+#include <TGUI/TGUI.hpp>
+#include <cstdio>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Builds a form with a mix of common widgets, grouped in panels like a real settings screen would be
+    void fillForm(tgui::Container& container, unsigned int rows)
+    {
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            auto panel = tgui::Panel::create({"100%", 30});
+            panel->setPosition({0, 30 * i});
+            container.add(panel, "Row" + tgui::to_string(i));
+
+            auto label = tgui::Label::create("Setting " + tgui::to_string(i));
+            label->setPosition({5, 5});
+            panel->add(label);
+
+            auto editBox = tgui::EditBox::create();
+            editBox->setPosition({"25%", 5});
+            editBox->setSize({"25%", 20});
+            editBox->setText(tgui::to_string(i));
+            panel->add(editBox);
+
+            auto checkBox = tgui::CheckBox::create();
+            checkBox->setPosition({"55%", 5});
+            panel->add(checkBox);
+
+            auto button = tgui::Button::create("Apply");
+            button->setPosition({"75%", 5});
+            panel->add(button);
+        }
+    }
+
+    void benchmarkFormLoading(BenchmarkRunner& runner, unsigned int rows)
+    {
+        const std::string name = "load/form/" + tgui::to_string(rows) + "-rows";
+        if (!runner.isEnabled(name))
+            return;
+
+        const std::string filename = "BenchmarkForm" + tgui::to_string(rows) + ".txt";
+        {
+            auto group = tgui::Group::create({800, 600});
+            fillForm(*group, rows);
+            group->saveWidgetsToFile(filename);
+        }
+
+        auto group = tgui::Group::create({800, 600});
+        runner.run(name, 10, [&]{
+            group->removeAllWidgets();
+            group->loadWidgetsFromFile(filename);
+        });
+
+        std::remove(filename.c_str());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void runLoadingBenchmarks(BenchmarkRunner& runner)
+{
+    benchmarkFormLoading(runner, 100);
+    benchmarkFormLoading(runner, 1000);
+
+    runner.run("load/theme/Black", 20, []{
+        tgui::DefaultThemeLoader::flushCache();
+        tgui::Theme theme{"themes/Black.txt"};
+    });
+
+    tgui::Theme theme{"themes/Black.txt"};
+    runner.run("load/theme/cached", 100, [&]{
+        theme.load("themes/Black.txt");
+    });
+}
@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmarks.hpp"
+#include <TGUI/TGUI.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const unsigned int itemCount = 100000;
+
+    std::string makeLine(unsigned int index)
+    {
+        return "Line " + tgui::to_string(index) + ": the quick brown fox jumps over the lazy dog";
+    }
+
+    void drawFrames(tgui::Gui& gui, sf::RenderTexture& target, unsigned int frames)
+    {
+        for (unsigned int i = 0; i < frames; ++i)
+        {
+            target.clear();
+            gui.draw();
+            target.display();
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void runTextBenchmarks(BenchmarkRunner& runner, sf::RenderTexture& target)
+{
+    tgui::Gui gui{target};
+
+    auto listBox = tgui::ListBox::create();
+    listBox->setSize({400, 600});
+    gui.add(listBox);
+    runner.run("text/ListBox/add-100k-items", 3, [&]{
+        listBox->removeAllItems();
+        for (unsigned int i = 0; i < itemCount; ++i)
+            listBox->addItem(makeLine(i));
+    });
+    runner.run("text/ListBox/draw-100k-items-x100", 5, [&]{ drawFrames(gui, target, 100); });
+    gui.removeAllWidgets();
+
+    auto chatBox = tgui::ChatBox::create();
+    chatBox->setSize({400, 600});
+    gui.add(chatBox);
+    runner.run("text/ChatBox/add-100k-lines", 3, [&]{
+        chatBox->removeAllLines();
+        for (unsigned int i = 0; i < itemCount; ++i)
+            chatBox->addLine(makeLine(i));
+    });
+    runner.run("text/ChatBox/draw-100k-lines-x100", 5, [&]{ drawFrames(gui, target, 100); });
+    gui.removeAllWidgets();
+
+    std::string text;
+    for (unsigned int i = 0; i < itemCount; ++i)
+        text += makeLine(i) + "\n";
+
+    auto textBox = tgui::TextBox::create();
+    textBox->setSize({400, 600});
+    gui.add(textBox);
+    runner.run("text/TextBox/set-100k-lines", 3, [&]{ textBox->setText(text); });
+    runner.run("text/TextBox/draw-100k-lines-x100", 5, [&]{ drawFrames(gui, target, 100); });
+    runner.run("text/TextBox/append-1M-lines", 1, [&]{
+        textBox->setText("");
+        for (unsigned int i = 0; i < 1000000; ++i)
+            textBox->addText(makeLine(i) + "\n");
+    });
+    runner.run("text/TextBox/append-1M-lines-limit-10k", 1, [&]{
+        textBox->setText("");
+        textBox->setLineLimit(10000);
+        for (unsigned int i = 0; i < 1000000; ++i)
+            textBox->addText(makeLine(i) + "\n");
+        textBox->setLineLimit(0);
+    });
+    textBox->setText(text);
+    runner.run("text/TextBox/type-100-characters", 3, [&]{
+        sf::Event event;
+        event.type = sf::Event::TextEntered;
+        event.text.unicode = 'x';
+        textBox->setFocused(true);
+        for (unsigned int i = 0; i < 100; ++i)
+            gui.handleEvent(event);
+    });
+    gui.removeAllWidgets();
+}
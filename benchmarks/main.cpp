@@ -0,0 +1,178 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmarks.hpp"
+#include <TGUI/TGUI.hpp>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    std::string escapeJsonString(const std::string& str)
+    {
+        std::string result;
+        for (const char c : str)
+        {
+            if ((c == '"') || (c == '\\'))
+                result += '\\';
+            result += c;
+        }
+        return result;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BenchmarkRunner::BenchmarkRunner(std::string filter) :
+    m_filter{std::move(filter)}
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BenchmarkRunner::isEnabled(const std::string& name) const
+{
+    return m_filter.empty() || (name.find(m_filter) != std::string::npos);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BenchmarkRunner::run(const std::string& name, unsigned int iterations, const std::function<void()>& function)
+{
+    if (!isEnabled(name) || (iterations == 0))
+        return;
+
+    function();
+
+    std::vector<double> timings;
+    timings.reserve(iterations);
+    for (unsigned int i = 0; i < iterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto end = std::chrono::steady_clock::now();
+        timings.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.totalMs = 0;
+    for (const double timing : timings)
+        result.totalMs += timing;
+
+    result.meanMs = result.totalMs / iterations;
+    result.minMs = *std::min_element(timings.begin(), timings.end());
+    result.maxMs = *std::max_element(timings.begin(), timings.end());
+
+    std::sort(timings.begin(), timings.end());
+    result.medianMs = timings[timings.size() / 2];
+
+    std::cout << std::left << std::setw(50) << name << std::right << std::fixed << std::setprecision(4)
+              << std::setw(14) << result.medianMs << " ms  (mean " << result.meanMs << " ms, " << iterations << " iterations)" << std::endl;
+
+    m_results.push_back(std::move(result));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BenchmarkRunner::writeJson(std::ostream& stream) const
+{
+    stream << "{\n    \"benchmarks\": [";
+    for (std::size_t i = 0; i < m_results.size(); ++i)
+    {
+        const Result& result = m_results[i];
+        stream << (i > 0 ? "," : "") << "\n        {"
+               << "\"name\": \"" << escapeJsonString(result.name) << "\", "
+               << "\"iterations\": " << result.iterations << ", "
+               << std::fixed << std::setprecision(6)
+               << "\"total_ms\": " << result.totalMs << ", "
+               << "\"mean_ms\": " << result.meanMs << ", "
+               << "\"median_ms\": " << result.medianMs << ", "
+               << "\"min_ms\": " << result.minMs << ", "
+               << "\"max_ms\": " << result.maxMs << "}";
+    }
+    stream << "\n    ]\n}\n";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    std::string outputFile = "benchmarks.json";
+    std::string filter;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if ((arg == "--output") && (i + 1 < argc))
+            outputFile = argv[++i];
+        else if ((arg == "--filter") && (i + 1 < argc))
+            filter = argv[++i];
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--output file.json] [--filter name]" << std::endl;
+            return 1;
+        }
+    }
+
+    sf::RenderTexture target;
+    if (!target.create(1024, 768))
+    {
+        std::cerr << "Failed to create the render texture" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        BenchmarkRunner runner{filter};
+        runCreationBenchmarks(runner);
+        runLoadingBenchmarks(runner);
+        runEventBenchmarks(runner, target);
+        runTextBenchmarks(runner, target);
+        runDrawBenchmarks(runner, target);
+
+        std::ofstream file{outputFile};
+        if (!file)
+        {
+            std::cerr << "Failed to open " << outputFile << " for writing" << std::endl;
+            return 1;
+        }
+
+        runner.writeJson(file);
+        std::cout << "Results written to " << outputFile << std::endl;
+    }
+    catch (const tgui::Exception& e)
+    {
+        std::cerr << "TGUI exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
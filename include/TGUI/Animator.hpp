@@ -0,0 +1,356 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_ANIMATOR_HPP
+#define TGUI_ANIMATOR_HPP
+
+#include <TGUI/Color.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <SFML/System/Time.hpp>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Curve that maps the linear progress of an animation to the progress that is actually shown
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class Easing
+    {
+        Linear,       ///< Constant speed
+        QuadIn,       ///< Quadratic curve, starting slow
+        QuadOut,      ///< Quadratic curve, ending slow
+        QuadInOut,    ///< Quadratic curve, starting and ending slow
+        CubicIn,      ///< Cubic curve, starting slow
+        CubicOut,     ///< Cubic curve, ending slow
+        CubicInOut,   ///< Cubic curve, starting and ending slow
+        SineIn,       ///< Sinusoidal curve, starting slow
+        SineOut,      ///< Sinusoidal curve, ending slow
+        SineInOut,    ///< Sinusoidal curve, starting and ending slow
+        BackOut,      ///< Overshoots the end value slightly before settling on it
+        BounceOut     ///< Bounces a few times before settling on the end value
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Runs tweens that interpolate widget properties or arbitrary values over time
+    ///
+    /// Every gui owns an animator which is updated once per frame from Gui::updateTime. All tweens are stored together and
+    /// the new positions, sizes and opacities are only passed to the widgets after every tween has been advanced, so that
+    /// each widget receives at most one setPosition and one setSize call per frame, no matter how many tweens target it.
+    ///
+    /// Tweens can be combined with sequence and parallel, which return the id of a group that can itself be part of
+    /// another group.
+    /// @code
+    /// auto& animator = gui.getAnimator();
+    /// animator.sequence({animator.moveTo(panel, {100, 0}, sf::milliseconds(300), tgui::Easing::CubicOut),
+    ///                    animator.wait(sf::milliseconds(100)),
+    ///                    animator.fadeTo(panel, 0, sf::milliseconds(200))});
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Animator
+    {
+    public:
+
+        typedef std::uint32_t Id;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the eased progress for a given linear progress
+        ///
+        /// @param easing    Easing curve to use
+        /// @param progress  Linear progress between 0 and 1
+        ///
+        /// @return Eased progress, which is 0 at the start and 1 at the end but may leave that range in between
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float ease(Easing easing, float progress);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Moves a widget from its position at the moment the tween starts to a given position
+        ///
+        /// @param widget    Widget to move
+        /// @param position  Position at the end of the tween
+        /// @param duration  How long the tween takes
+        /// @param easing    Easing curve to use
+        ///
+        /// @return Id of the tween
+        ///
+        /// The tween ends early when the widget is destroyed before the tween has finished.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id moveTo(const std::shared_ptr<Widget>& widget, Vector2f position, sf::Time duration, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resizes a widget from its size at the moment the tween starts to a given size
+        ///
+        /// @param widget    Widget to resize
+        /// @param size      Size at the end of the tween
+        /// @param duration  How long the tween takes
+        /// @param easing    Easing curve to use
+        ///
+        /// @return Id of the tween
+        ///
+        /// The tween ends early when the widget is destroyed before the tween has finished.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id resizeTo(const std::shared_ptr<Widget>& widget, Vector2f size, sf::Time duration, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the inherited opacity of a widget from its value at the moment the tween starts to a given value
+        ///
+        /// @param widget    Widget to fade
+        /// @param opacity   Inherited opacity at the end of the tween
+        /// @param duration  How long the tween takes
+        /// @param easing    Easing curve to use
+        ///
+        /// @return Id of the tween
+        ///
+        /// The tween ends early when the widget is destroyed before the tween has finished.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id fadeTo(const std::shared_ptr<Widget>& widget, float opacity, sf::Time duration, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Interpolates between two colors and passes the result to a function every frame
+        ///
+        /// @param from      Color at the start of the tween
+        /// @param to        Color at the end of the tween
+        /// @param duration  How long the tween takes
+        /// @param setter    Function that receives the interpolated color, e.g. one that changes a renderer property
+        /// @param easing    Easing curve to use
+        ///
+        /// @return Id of the tween
+        ///
+        /// The setter must not create or stop tweens, use setFinishedCallback to chain logic to the end of a tween instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id animateColor(Color from, Color to, sf::Time duration, std::function<void(Color)> setter, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Interpolates between two values and passes the result to a function every frame
+        ///
+        /// @param from      Value at the start of the tween
+        /// @param to        Value at the end of the tween
+        /// @param duration  How long the tween takes
+        /// @param setter    Function that receives the interpolated value
+        /// @param easing    Easing curve to use
+        ///
+        /// @return Id of the tween
+        ///
+        /// The setter must not create or stop tweens, use setFinishedCallback to chain logic to the end of a tween instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id animateFloat(float from, float to, sf::Time duration, std::function<void(float)> setter, Easing easing = Easing::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a tween that does nothing, to insert a pause in a sequence
+        ///
+        /// @param duration  How long the tween takes
+        ///
+        /// @return Id of the tween
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id wait(sf::Time duration);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Groups tweens or groups so that each one only starts when the previous one has finished
+        ///
+        /// @param ids  Tweens or groups that were just created and are not yet part of another group
+        ///
+        /// @return Id of the group, which finishes when the last tween in it has finished
+        ///
+        /// Tweens that start later in the sequence take their start value from the widget when they start, so moving a widget
+        /// to one position and then to another one works as expected.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id sequence(const std::vector<Id>& ids);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Groups tweens or groups that run at the same time
+        ///
+        /// @param ids  Tweens or groups that were just created and are not yet part of another group
+        ///
+        /// @return Id of the group, which finishes when all tweens in it have finished
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id parallel(const std::vector<Id>& ids);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets a function that is called when a tween or group finishes
+        ///
+        /// @param id        Id of the tween or group
+        /// @param callback  Function to call once the tween or group has finished or was stopped
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFinishedCallback(Id id, std::function<void()> callback);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops a tween or all tweens in a group
+        ///
+        /// @param id         Id of the tween or group
+        /// @param jumpToEnd  Should the properties be set to their end values?
+        ///
+        /// Stopped tweens count as finished: finished callbacks are called and tweens that were waiting for them will start.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stop(Id id, bool jumpToEnd = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops all tweens and groups without calling their finished callbacks
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a tween or group still has to finish
+        ///
+        /// @param id  Id of the tween or group
+        ///
+        /// @return Is the tween or group still running or waiting to start?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRunning(Id id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of tweens that are still running or waiting to start
+        ///
+        /// @return Amount of tweens
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTweenCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Advances all tweens and applies the new values. This function is called by Gui::updateTime.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        enum class Target : std::uint8_t
+        {
+            None,
+            Position,
+            Size,
+            Opacity,
+            Color,
+            Float
+        };
+
+        struct Tween
+        {
+            Id id = 0;
+            Target target = Target::None;
+            Easing easing = Easing::Linear;
+            bool started = false;
+            bool finished = false;
+            sf::Time duration;
+            sf::Time elapsed;
+            float from[4] = {0, 0, 0, 0};
+            float to[4] = {0, 0, 0, 0};
+            std::weak_ptr<Widget> widget;
+            std::function<void(float)> floatSetter;
+            std::function<void(Color)> colorSetter;
+        };
+
+        // Tweens and groups both have a node, which tracks in which group they are and what they are waiting for
+        struct Node
+        {
+            Id parent = 0;
+            Id waitFor = 0;
+            std::size_t remaining = 1;
+            std::function<void()> finishedCallback;
+        };
+
+        // Values that will be passed to a widget at the end of the frame
+        struct PendingChange
+        {
+            std::shared_ptr<Widget> widget;
+            bool positionChanged = false;
+            bool sizeChanged = false;
+            bool opacityChanged = false;
+            Vector2f position;
+            Vector2f size;
+            float opacity = 0;
+        };
+
+        // Creates a tween and its node
+        Tween& addTween(Target target, sf::Time duration, Easing easing);
+
+        // Creates a group node containing the given ids and returns its id
+        Id addGroup(const std::vector<Id>& ids, bool sequential);
+
+        // Checks whether the tween and all groups containing it are no longer waiting for something else to finish
+        bool isReady(Id id) const;
+
+        // Checks whether the tween is part of the given group (or is the given id itself)
+        bool isPartOf(Id id, Id group) const;
+
+        // Reads the start values from the widget. Returns false if the widget no longer exists.
+        bool start(Tween& tween);
+
+        // Interpolates the values of the tween and either calls the setter or stores the values in the pending changes
+        void apply(Tween& tween, float progress);
+
+        // Passes the pending changes to the widgets
+        void applyPendingChanges();
+
+        // Removes the finished tweens, updates the groups and calls the finished callbacks
+        void removeFinishedTweens();
+
+
+    private:
+
+        std::vector<Tween> m_tweens;
+        std::unordered_map<Id, Node> m_nodes;
+        Id m_lastId = 0;
+
+        std::vector<PendingChange> m_pendingChanges;
+        std::unordered_map<const Widget*, std::size_t> m_pendingChangeIndices;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ANIMATOR_HPP
@@ -0,0 +1,363 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BINDINGS_HPP
+#define TGUI_BINDINGS_HPP
+
+#include <TGUI/Config.hpp>
+#include <type_traits>
+#include <functional>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <array>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Value that can be changed from any thread and is read by the gui once per frame
+    ///
+    /// Setting the value never blocks. When the value is set several times before the gui reads it, only the last value
+    /// is seen by the gui.
+    ///
+    /// Non-arithmetic values are stored in a triple buffer, which means that only one thread may call set at a time.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Enable = void>
+    class BoundValue
+    {
+    public:
+
+        typedef std::shared_ptr<BoundValue<T>> Ptr; ///< Shared bound value pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param initialValue  Value that the gui will read the first time
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BoundValue(const T& initialValue = T{}) :
+            m_buffers{{initialValue, initialValue, initialValue}}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new bound value
+        ///
+        /// @param initialValue  Value that the gui will read the first time
+        ///
+        /// @return The new bound value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Ptr create(const T& initialValue = T{})
+        {
+            return std::make_shared<BoundValue<T>>(initialValue);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the value
+        ///
+        /// @param value  New value
+        ///
+        /// This function is lock-free and may be called from a worker thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void set(T value)
+        {
+            m_buffers[m_back] = std::move(value);
+            m_back = m_middle.exchange(m_back | ChangedFlag, std::memory_order_acq_rel) & IndexMask;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the latest value if it is newer than the one that the caller saw last
+        ///
+        /// @param version  Version of the value that the caller saw last, which is updated when a newer value is returned.
+        ///                 Start with 0 to always receive the current value.
+        ///
+        /// @return Pointer to the value which stays valid until the next call, or nullptr when there is no newer value
+        ///
+        /// Only the thread that owns the gui may call this function. Multiple widgets can be bound to the same value, as
+        /// each binding keeps track of its own version.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const T* fetch(std::uint64_t& version)
+        {
+            if ((m_middle.load(std::memory_order_relaxed) & ChangedFlag) != 0)
+            {
+                m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & IndexMask;
+                ++m_frontVersion;
+            }
+
+            if (version == m_frontVersion)
+                return nullptr;
+
+            version = m_frontVersion;
+            return &m_buffers[m_front];
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static const unsigned int IndexMask = 3;
+        static const unsigned int ChangedFlag = 4;
+
+        // The producer writes in the back buffer and the gui reads from the front buffer.
+        // The middle buffer is swapped with one of them, together with a flag that tells whether it holds a newer value.
+        std::array<T, 3> m_buffers;
+        std::atomic<unsigned int> m_middle{1};
+        unsigned int m_back = 0;
+        unsigned int m_front = 2;
+        std::uint64_t m_frontVersion = 1;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Value that can be changed from any thread and is read by the gui once per frame
+    ///
+    /// Arithmetic values are stored atomically, so they may be set from several threads at the same time.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class BoundValue<T, typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    {
+    public:
+
+        typedef std::shared_ptr<BoundValue<T>> Ptr; ///< Shared bound value pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param initialValue  Value that the gui will read the first time
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BoundValue(T initialValue = T{}) :
+            m_value{initialValue},
+            m_fetchedValue{initialValue}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new bound value
+        ///
+        /// @param initialValue  Value that the gui will read the first time
+        ///
+        /// @return The new bound value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Ptr create(T initialValue = T{})
+        {
+            return std::make_shared<BoundValue<T>>(initialValue);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the value
+        ///
+        /// @param value  New value
+        ///
+        /// This function is lock-free and may be called from a worker thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void set(T value)
+        {
+            m_value.store(value, std::memory_order_relaxed);
+            m_changed.store(true, std::memory_order_release);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the latest value if it is newer than the one that the caller saw last
+        ///
+        /// @param version  Version of the value that the caller saw last, which is updated when a newer value is returned.
+        ///                 Start with 0 to always receive the current value.
+        ///
+        /// @return Pointer to the value which stays valid until the next call, or nullptr when there is no newer value
+        ///
+        /// Only the thread that owns the gui may call this function. Multiple widgets can be bound to the same value, as
+        /// each binding keeps track of its own version.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const T* fetch(std::uint64_t& version)
+        {
+            if (m_changed.exchange(false, std::memory_order_acquire))
+            {
+                m_fetchedValue = m_value.load(std::memory_order_relaxed);
+                ++m_fetchedVersion;
+            }
+
+            if (version == m_fetchedVersion)
+                return nullptr;
+
+            version = m_fetchedVersion;
+            return &m_fetchedValue;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::atomic<T> m_value;
+        std::atomic<bool> m_changed{false};
+        T m_fetchedValue;
+        std::uint64_t m_fetchedVersion = 1;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Passes values that are produced on other threads to widgets, at most once per frame
+    ///
+    /// Every gui owns a Bindings object which is updated at the start of Gui::draw. Only bindings whose source changed since
+    /// the previous frame call their setter, so a value that is set a thousand times per second still results in a single
+    /// setValue or setText call (and a single signal) per frame.
+    /// @code
+    /// auto load = tgui::BoundValue<int>::create();
+    /// gui.getBindings().bind(load, progressBar, &tgui::ProgressBar::setValue);
+    ///
+    /// // On a worker thread
+    /// load->set(75);
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Bindings
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Binds a widget setter to a value
+        ///
+        /// @param source  Value that is read once per frame
+        /// @param widget  Widget that is updated when the value changed
+        /// @param setter  Member function of the widget that is called with the new value (e.g. &ProgressBar::setValue)
+        ///
+        /// The binding is removed automatically when the widget is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename T, typename WidgetType, typename SetterClass, typename Arg>
+        void bind(const std::shared_ptr<BoundValue<T>>& source, const std::shared_ptr<WidgetType>& widget, void (SetterClass::*setter)(Arg))
+        {
+            bind(source, widget, [setter](WidgetType& w, const T& value){
+                (w.*setter)(static_cast<typename std::decay<Arg>::type>(value));
+            });
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Binds a function to a value
+        ///
+        /// @param source  Value that is read once per frame
+        /// @param widget  Widget that is updated when the value changed
+        /// @param apply   Function that is called with the widget and the new value
+        ///
+        /// The binding is removed automatically when the widget is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename T, typename WidgetType, typename Func>
+        void bind(const std::shared_ptr<BoundValue<T>>& source, const std::shared_ptr<WidgetType>& widget, Func apply)
+        {
+            std::weak_ptr<WidgetType> weakWidget = widget;
+            std::uint64_t version = 0;
+            addBinding(static_cast<const Widget*>(widget.get()), [source,weakWidget,apply,version]() mutable {
+                const auto widget = weakWidget.lock();
+                if (!widget)
+                    return UpdateResult::Expired;
+
+                const T* value = source->fetch(version);
+                if (!value)
+                    return UpdateResult::Unchanged;
+
+                apply(*widget, *value);
+                return UpdateResult::Updated;
+            });
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all bindings of a widget
+        ///
+        /// @param widget  Widget that should no longer be updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbind(const std::shared_ptr<Widget>& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all bindings
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindAll();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of bindings
+        ///
+        /// @return Number of bindings, including the ones of which the widget was destroyed since the last update
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getBindingCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes the values that changed to their widgets
+        ///
+        /// @return Amount of bindings that updated their widget
+        ///
+        /// This function is called automatically by Gui::draw.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t update();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        enum class UpdateResult
+        {
+            Unchanged,
+            Updated,
+            Expired
+        };
+
+        struct Binding
+        {
+            const Widget* widget;
+            std::function<UpdateResult()> update;
+        };
+
+        void addBinding(const Widget* widget, std::function<UpdateResult()> update);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<Binding> m_bindings;
+
+        // Widgets that were unbound by a setter while the bindings were being updated
+        std::vector<const Widget*> m_unboundDuringUpdate;
+        bool m_updating = false;
+        bool m_unbindAllDuringUpdate = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BINDINGS_HPP
@@ -28,6 +28,7 @@
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/View.hpp>
 
@@ -37,6 +38,13 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Restricts drawing to a rectangle for as long as the object exists
+    ///
+    /// Clipping objects form a stack while drawing. Every clipping area is converted to pixels of the render target and
+    /// intersected with the area of the clipping object below it, so nested widgets can never draw outside their parents.
+    /// The view of the render target is only changed when the clipping area differs from the one of the parent.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Clipping
     {
     public:
@@ -44,6 +52,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates a clipping object which will define a clipping region until the object is destroyed
         ///
+        /// Clipping objects have to be destroyed in the opposite order of their creation.
+        ///
         /// @param target  Target to which we are drawing
         /// @param states  Current render states
         /// @param topLeft Position of the top left corner of the clipping area relative to the view
@@ -61,6 +71,31 @@ namespace tgui
         ~Clipping();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area to which drawing is currently restricted
+        ///
+        /// @param target  Target to which we are drawing
+        ///
+        /// @return Clipping area in pixels of the render target, or the viewport of the gui view when nothing is being clipped
+        ///
+        /// The returned rectangle has a width and height of 0 when nothing can be drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::IntRect getClipRect(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the part of the local coordinate system that is currently visible
+        ///
+        /// @param target  Target to which we are drawing
+        /// @param states  Current render states
+        ///
+        /// @return Bounding rectangle of the clipping area, in the coordinates that are transformed by the render states
+        ///
+        /// This can be used to skip drawing things that would be clipped anyway.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FloatRect getVisibleArea(const sf::RenderTarget& target, const sf::RenderStates& states);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Sets the view used by the gui, which the calculations have to take into account when changing the view for clipping
@@ -72,8 +107,12 @@ namespace tgui
     private:
 
         sf::RenderTarget& m_target;
+        Clipping* m_parent;
+        sf::IntRect m_clipRect;
+        bool m_viewChanged = false;
         sf::View m_oldView;
 
+        static Clipping* m_currentClipping;
         static sf::View m_originalView;
     };
 
@@ -28,6 +28,7 @@
 
 
 #include <list>
+#include <functional>
 
 #include <TGUI/Widget.hpp>
 
@@ -52,6 +53,19 @@ namespace tgui
         typedef std::shared_ptr<const Container> ConstPtr; ///< Shared constant widget pointer
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Widgets that were loaded from a widget file without being added to a container
+        ///
+        /// @see loadDetachedWidgetsFromFile
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct DetachedWidgets
+        {
+            std::vector<Widget::Ptr> widgets;     ///< Loaded widgets, in the order in which they appear in the file
+            std::vector<sf::String> widgetNames;  ///< Names of the loaded widgets
+            std::vector<std::shared_ptr<TextureData>> pendingTextures; ///< Textures that still have to be uploaded to the graphics card
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,6 +193,45 @@ namespace tgui
         virtual void removeAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple widgets to the container at once
+        ///
+        /// @param widgets      Widgets to add, in the order in which they should be drawn
+        /// @param widgetNames  Names of the widgets, either empty or containing a name for every widget
+        ///
+        /// Containers that arrange their children (e.g. HorizontalLayout) only reposition the widgets once after all widgets
+        /// have been added, instead of after every added widget.
+        ///
+        /// @throw Exception when widgetNames isn't empty but contains a different amount of names than there are widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all child widgets for which the predicate returns true
+        ///
+        /// @param predicate  Function that is called once for every child widget and returns whether it should be removed
+        ///
+        /// @return Amount of widgets that were removed
+        ///
+        /// Unlike calling remove for every widget, this function takes linear time in the amount of child widgets.
+        /// The predicate should not change the container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::size_t removeWidgets(const std::function<bool(const Widget::Ptr&)>& predicate);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the order in which the child widgets are drawn
+        ///
+        /// @param widgets  All child widgets of the container, in the order in which they should be drawn
+        ///
+        /// @return True when the order was changed, false when the list didn't contain every child widget exactly once
+        ///
+        /// The names of the widgets move together with the widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool reorder(const std::vector<Widget::Ptr>& widgets);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the name of a widget
         ///
@@ -257,9 +310,60 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the child widgets to a text file
         ///
-        /// @param stream  stringstream to which the widget file will be added
+        /// @param stream  Stream to which the widget file will be written
+        ///
+        /// Each top-level widget is written as soon as it is saved, so the stream can directly be a file. A container is
+        /// still saved completely, including all its children, before it is written.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToStream(std::ostream& stream) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the widgets from a widget file without adding them to a container
+        ///
+        /// @param filename  Filename of the widget file
+        ///
+        /// @return Widgets that can be passed to addDetachedWidgets
+        ///
+        /// Unlike loadWidgetsFromFile, this function may be called on a different thread than the one that draws the gui, e.g.
+        /// to build a large screen while a loading animation keeps running. Images are loaded into memory, but the textures are
+        /// only created on the graphics card when the widgets are passed to addDetachedWidgets.
+        /// Properties of the root of the file (which would be applied to the container itself) are ignored.
+        ///
+        /// Renderers and fonts are shared with the widgets in the gui. The renderers of the theme should not be changed and
+        /// text in the same font should not be drawn while widgets are being loaded on another thread.
+        ///
+        /// Usage example:
+        /// @code
+        /// auto future = std::async(std::launch::async, []{ return tgui::Container::loadDetachedWidgetsFromFile("form.txt"); });
+        /// // ... keep drawing the gui until the future is ready ...
+        /// gui.addDetachedWidgets(future.get());
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static DetachedWidgets loadDetachedWidgetsFromFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the widgets from a string stream without adding them to a container
+        ///
+        /// @param stream  stringstream that contains the widget file
+        ///
+        /// @return Widgets that can be passed to addDetachedWidgets
+        ///
+        /// @see loadDetachedWidgetsFromFile
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static DetachedWidgets loadDetachedWidgetsFromStream(std::stringstream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds widgets that were loaded by loadDetachedWidgetsFromFile or loadDetachedWidgetsFromStream to the container
+        ///
+        /// @param detachedWidgets  Widgets to add, which will be empty after this call
+        ///
+        /// This function creates the textures that were loaded together with the widgets, so it must be called on the thread
+        /// that draws the gui. The existing widgets of the container are not removed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream) const;
+        void addDetachedWidgets(DetachedWidgets&& detachedWidgets);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -312,6 +416,13 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when a child widget starts or stops requiring to be updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childUpdateRequiredChanged(Widget& child);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -362,6 +473,13 @@ namespace tgui
         Widget::Ptr askToolTip(Vector2f mousePos) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Adds the memory used by the container and all widgets inside it to the report.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToMemoryReport(MemoryReport& report) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // This function is called every frame with the time passed since the last frame.
@@ -369,6 +487,13 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns true when the container itself or any of its child widgets has to be updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // The function returns true when the event is consumed and false when the event was ignored by all widgets.
@@ -376,6 +501,13 @@ namespace tgui
         bool handleEvent(sf::Event& event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns how many times a widget was checked for being below the mouse, counted over all containers.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getHitTestCount();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -426,6 +558,52 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the cached absolute position of the container and all its child widgets as outdated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateAbsolutePosition() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the cached absolute positions of the child widgets as outdated.
+        // This function has to be called when the value returned by getChildWidgetsOffset changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetsOffsetChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the widget in m_widgets, or m_widgets.size() when it isn't a child of this container.
+        // This takes constant time as long as updateWidgetIndices was called after the order of the widgets changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findWidgetIndex(const Widget* widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the position of every widget starting from the given index, after widgets were inserted, removed or moved.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetIndices(std::size_t firstIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called once after addWidgets, removeWidgets or reorder changed the child widgets. While widgets are being added by
+        // addWidgets, m_changingWidgetsInBatch is true so that derived classes can postpone work until this function is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void widgetsChangedInBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds clones of the child widgets of another container. This is used instead of 'add' when copying a container, so
+        // that the 'add' function of a derived class isn't called before its members are copied.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addClonedWidgets(const Container& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the widgets that are described by the children of the root node of a widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static DetachedWidgets createWidgetsFromNode(const std::unique_ptr<DataIO::Node>& rootNode);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -435,12 +613,24 @@ namespace tgui
         Widget::Ptr m_widgetBelowMouse;
         Widget::Ptr m_focusedWidget;
 
+        // Child widgets that need to be updated every frame. Only these widgets are visited when the time is updated.
+        std::vector<Widget::Ptr> m_updatedWidgets;
+
+        // Copy of m_updatedWidgets that is only used inside update, kept as member to reuse its memory
+        std::vector<Widget::Ptr> m_updatedWidgetsCopy;
+
+        // Amount of mouseOnWidget calls made by mouseOnWhichWidget in all containers
+        static std::size_t m_hitTestCount;
+
         // Did we enter handleEvent directly or because we got a MouseReleased event?
         bool m_handingMouseReleased = false;
 
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Is addWidgets currently adding widgets one by one?
+        bool m_changingWidgetsInBatch = false;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -28,10 +28,13 @@
 
 #include <TGUI/Config.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/System/String.hpp>
+#include <SFML/System/Time.hpp>
 #include <cstdint>
 #include <string>
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +46,18 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about the glyphs that were rasterized by the font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct GlyphCacheStatistics
+        {
+            std::size_t pageCount = 0;      ///< Amount of glyph pages, the font has a separate page for every character size
+            std::size_t textureBytes = 0;   ///< Memory used by the textures of the glyph pages and the distance field
+            std::size_t glyphsWarmedUp = 0; ///< Amount of glyphs that were requested by warmUp and continueWarmUp
+            std::size_t glyphsPending = 0;  ///< Amount of glyphs that were queued with queueWarmUp and not rasterized yet
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor which will set the font to nullptr
         ///
@@ -195,8 +210,11 @@ namespace tgui
         ///
         /// \return The glyph corresponding to \a codePoint and \a characterSize
         ///
+        /// When distance field rendering is enabled, the metrics are scaled from the reference size and the texture rect of
+        /// the returned glyph should not be used.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const sf::Glyph& getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
+        sf::Glyph getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -229,11 +247,200 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether text using this font is rendered from a signed distance field
+        ///
+        /// @param enabled       Should glyphs be rendered from a distance field?
+        /// @param referenceSize Character size at which the glyphs are rasterized
+        ///
+        /// By default every character size used with a font has its glyphs rasterized separately, which means that text that
+        /// scales continuously keeps adding glyphs to the font texture. When distance field rendering is enabled, glyphs are
+        /// only rasterized once at the reference size. A distance field is calculated from them on the CPU and text of any
+        /// size is rendered from it by a shader. The metrics returned by getGlyph, getKerning and getLineSpacing are then
+        /// scaled from the reference size as well.
+        ///
+        /// Only copies of the font that are made after calling this function will share the distance field, so call it
+        /// before passing the font to the gui or to widgets.
+        ///
+        /// When shaders are not available on the system, text is still rendered with the glyphs of its own character size.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceFieldEnabled(bool enabled, unsigned int referenceSize = 48);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether text using this font is rendered from a signed distance field
+        ///
+        /// @return Is distance field rendering enabled?
+        ///
+        /// @see setDistanceFieldEnabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDistanceFieldEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the character size at which the glyphs of the distance field are rasterized
+        ///
+        /// @return Reference size, or 0 when distance field rendering is disabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDistanceFieldReferenceSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes glyphs before any text needs them
+        ///
+        /// @param characters      Characters of which the glyphs should be loaded
+        /// @param characterSizes  Character sizes at which every character should be loaded
+        /// @param includeBold     Should the bold glyphs be loaded as well?
+        ///
+        /// The first time a text is drawn with a new character or character size, the glyph has to be rasterized and the glyph
+        /// page has to grow and be copied to the graphics card, which can cause a visible hitch. Calling this function while
+        /// e.g. a loading screen is shown moves that work to a moment where it isn't noticed.
+        ///
+        /// When distance field rendering is enabled, the character sizes are ignored as all sizes use the same glyphs.
+        ///
+        /// @code
+        /// font.warmUp("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 .,:;!?()-", {13, 18}, true);
+        /// @endcode
+        ///
+        /// @see queueWarmUp
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void warmUp(const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool includeBold = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues glyphs to be rasterized by continueWarmUp
+        ///
+        /// @param characters      Characters of which the glyphs should be loaded
+        /// @param characterSizes  Character sizes at which every character should be loaded
+        /// @param includeBold     Should the bold glyphs be loaded as well?
+        ///
+        /// This function doesn't rasterize anything by itself. It allows spreading the work of warmUp over several frames by
+        /// calling continueWarmUp with a small time budget every frame.
+        ///
+        /// The queue is shared with all fonts that use the same sf::Font.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueWarmUp(const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool includeBold = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes queued glyphs until the time budget runs out
+        ///
+        /// @param timeBudget  Time after which no more glyphs are loaded. At least one glyph is loaded per call.
+        ///
+        /// @return True when all queued glyphs have been rasterized, false when continueWarmUp has to be called again
+        ///
+        /// @code
+        /// // In the main loop, before drawing the gui
+        /// font.continueWarmUp(sf::milliseconds(2));
+        /// @endcode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool continueWarmUp(sf::Time timeBudget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether there are still glyphs queued with queueWarmUp that weren't rasterized yet
+        ///
+        /// @return Does continueWarmUp still have work to do?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isWarmUpPending() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the character sizes at which glyphs were requested from the font
+        ///
+        /// @return Sorted list of character sizes that were used by texts, getGlyph or warmUp
+        ///
+        /// The sizes are shared by all fonts that were created from the same sf::Font, including the global font.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<unsigned int> getUsedCharacterSizes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the glyph pages of the font
+        ///
+        /// @return Amount of glyph pages, their memory and the progress of the warm-up
+        ///
+        /// Only the pages that were created by this font or by other fonts using the same sf::Font are counted. In distance
+        /// field mode, glyphs are only rasterized at the reference size.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GlyphCacheStatistics getGlyphCacheStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Makes sure that all characters in the string have their glyph in the distance field
+        ///
+        /// The glyphs that were still missing are rasterized together, so that the glyph page only has to be copied from the
+        /// graphics card once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadDistanceFieldGlyphs(const sf::String& string, bool bold) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a glyph from the distance field
+        ///
+        /// The bounds and advance of the glyph are those of the reference size, the bounds include the spread of the field.
+        /// The texture rect is located in the texture returned by getDistanceFieldTexture.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Glyph& getDistanceFieldGlyph(std::uint32_t codePoint, bool bold) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the texture containing the distance field of all loaded glyphs
+        ///
+        /// The distance is stored in the alpha channel, with 128 lying on the edge of the glyph. The top left 4x4 pixels are
+        /// completely inside a glyph so that they can be used to draw lines.
+        ///
+        /// @return Texture of the distance field, or nullptr when distance field rendering is disabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Texture* getDistanceFieldTexture() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        struct GlyphCache;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers that glyphs of the character size were requested, so that they are included in the statistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addUsedCharacterSize(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers that the sf::Font created a glyph page for the character size, called before glyphs are rasterized
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addRasterizedCharacterSize(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the glyph cache that belongs to the sf::Font, so that all fonts wrapping it share the same statistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<GlyphCache> getGlyphCache(const std::shared_ptr<sf::Font>& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct DistanceField;
+
         std::shared_ptr<sf::Font> m_font;
         std::string m_id;
+        std::shared_ptr<DistanceField> m_distanceField;
+        std::shared_ptr<GlyphCache> m_glyphCache; // Shared with all fonts using the same sf::Font
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
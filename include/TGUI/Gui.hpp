@@ -28,6 +28,8 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/Animator.hpp>
+#include <TGUI/Bindings.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <queue>
 
@@ -43,6 +45,18 @@ namespace tgui
     {
       public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters about the events that were handled by the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct InputStatistics
+        {
+            std::size_t queuedEvents = 0;    ///< Amount of events that were passed to queueEvent
+            std::size_t coalescedEvents = 0; ///< Amount of queued events that were replaced by a newer move event
+            std::size_t handledEvents = 0;   ///< Amount of events that were passed to the widgets
+            std::size_t hitTests = 0;        ///< Amount of times a widget was checked for being below the mouse
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         ///
@@ -145,6 +159,59 @@ namespace tgui
         bool handleEvent(sf::Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds an event to the queue of events that will be passed to the widgets in the next draw call
+        ///
+        /// @param event  The event that was polled from the gui
+        ///
+        /// This is an alternative to calling handleEvent for every event. Consecutive MouseMoved events, as well as
+        /// consecutive TouchMoved events of the same finger, are replaced by the last one so that a fast mouse doesn't
+        /// cause the widgets to be searched several times per frame. The order of all other events is preserved.
+        ///
+        /// Note that you can't find out whether a queued event was consumed by a widget.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueEvent(const sf::Event& event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes all queued events to the widgets
+        ///
+        /// This function is called automatically by the draw function.
+        /// You only need to call it yourself when you want the events to be handled earlier.
+        ///
+        /// @see queueEvent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void handleQueuedEvents();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the events that were handled by the gui
+        ///
+        /// @return Counters since the gui was created or since resetInputStatistics was last called
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const InputStatistics& getInputStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets all counters of the input statistics to 0
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetInputStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Estimates how much memory is used by all widgets in the gui
+        ///
+        /// @return Bytes used per widget type and per part of the widgets
+        ///
+        /// @see Widget::MemoryReport
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::MemoryReport getMemoryReport() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief While tab key usage is enabled (default), pressing tab will focus another widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -285,6 +352,37 @@ namespace tgui
         void removeAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple widgets to the gui at once
+        ///
+        /// @param widgets      Widgets to add, in the order in which they should be drawn
+        /// @param widgetNames  Names of the widgets, either empty or containing a name for every widget
+        ///
+        /// @see Container::addWidgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets for which the predicate returns true
+        ///
+        /// @param predicate  Function that is called once for every widget and returns whether it should be removed
+        ///
+        /// @return Amount of widgets that were removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t removeWidgets(const std::function<bool(const Widget::Ptr&)>& predicate);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the order in which the widgets are drawn
+        ///
+        /// @param widgets  All widgets in the gui, in the order in which they should be drawn
+        ///
+        /// @return True when the order was changed, false when the list didn't contain every widget exactly once
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool reorder(const std::vector<Widget::Ptr>& widgets);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the name of a widget
         ///
@@ -387,13 +485,44 @@ namespace tgui
         void loadWidgetsFromStream(std::stringstream&& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds widgets that were loaded on another thread to the gui
+        ///
+        /// @param detachedWidgets  Widgets returned by Container::loadDetachedWidgetsFromFile or loadDetachedWidgetsFromStream
+        ///
+        /// This function must be called on the thread that draws the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addDetachedWidgets(Container::DetachedWidgets&& detachedWidgets);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves this the child widgets to a text file
         ///
-        /// @param stream  stringstream to which the widget file will be added
+        /// @param stream  Stream to which the widget file will be written
+        ///
+        /// Each top-level widget is written as soon as it is saved, so the stream can directly be a file. A container is
+        /// still saved completely, including all its children, before it is written.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToStream(std::ostream& stream) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the animator that runs the tweens of this gui
+        ///
+        /// @return Animator that is updated every frame together with the widgets
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream) const;
+        Animator& getAnimator();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the bindings that pass values from other threads to the widgets of this gui
+        ///
+        /// @return Bindings that are updated once per frame at the start of the draw function
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Bindings& getBindings();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -431,6 +560,12 @@ namespace tgui
         // Internal container to store all widgets
         GuiContainer::Ptr m_container = std::make_shared<GuiContainer>();
 
+        // Runs the tweens that were created via getAnimator
+        Animator m_animator;
+
+        // Widget setters that are bound to values from other threads via getBindings
+        Bindings m_bindings;
+
         Widget::Ptr m_visibleToolTip = nullptr;
         sf::Time m_tooltipTime;
         bool m_tooltipPossible = false;
@@ -440,6 +575,10 @@ namespace tgui
 
         bool m_TabKeyUsageEnabled = true;
 
+        // Events that are handled in the next draw call
+        std::vector<sf::Event> m_queuedEvents;
+        InputStatistics m_inputStatistics;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
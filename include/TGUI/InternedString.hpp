@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_INTERNED_STRING_HPP
+#define TGUI_INTERNED_STRING_HPP
+
+#include <TGUI/Config.hpp>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief String of which every distinct value is only stored once
+    ///
+    /// Interned strings are used for names that are repeated in many objects, such as the type of a widget or the name of
+    /// a signal. An interned string is only the size of a pointer and copying or comparing it doesn't touch the characters.
+    /// Strings that are interned are never released, so this class should not be used for arbitrary user text.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API InternedString
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that creates an empty string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the interned string from a string
+        ///
+        /// @param str  Value of the string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString(const std::string& str);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the interned string from a null-terminated string
+        ///
+        /// @param str  Value of the string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InternedString(const char* str);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of the string
+        ///
+        /// @return String that remains valid until the program ends
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getString() const
+        {
+            return *m_string;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of the string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        operator const std::string&() const
+        {
+            return *m_string;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compares two interned strings
+        ///
+        /// @return Whether the strings are equal, which is the case when they point to the same interned value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool operator==(const InternedString& other) const
+        {
+            return m_string == other.m_string;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compares two interned strings
+        ///
+        /// @return Whether the strings differ
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool operator!=(const InternedString& other) const
+        {
+            return m_string != other.m_string;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const std::string* m_string;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_INTERNED_STRING_HPP
@@ -30,8 +30,10 @@
 #include <TGUI/Vector2f.hpp>
 #include <type_traits>
 #include <functional>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,6 +46,9 @@ namespace tgui
     /// @brief Class to store the left, top, width or height of a widget
     ///
     /// You don't have to create an instance of this class, numbers are implicitly cast to this class.
+    ///
+    /// Layouts that aren't constant are compiled into a flat array of nodes in postfix order, so that copying a layout
+    /// only copies the array and evaluating it is a single loop over the nodes.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Layout
     {
@@ -119,6 +124,15 @@ namespace tgui
         explicit Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Constructs the layout with a mathematical operation between two other layouts
+        ///
+        /// The nodes of the operands are appended to the nodes of this layout, the operands don't have to be allocated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit Layout(Operation operation, Layout leftOperand, Layout rightOperand);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Copy constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -178,58 +192,103 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief If the layout has bound a widget and the widget gets destroyed, this function is called
+        ///
+        /// @param widget  Widget that is being destroyed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindWidget();
+        void unbindWidget(Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Recalculate the value of the layout based on the operation it contains and tell the parent layout to
-        ///        do the same when the value of the layout has changed.
+        /// @brief Recalculate the value of the layout based on the operations it contains and tell the connected widget
+        ///        about it when the value of the layout has changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateValue();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the amount of bytes that the layout has allocated on the heap
+        ///
+        /// @return Zero for constant layouts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getAllocatedMemory() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // If a widget is bound, inform it that the layout no longer binds it
+        // A single operation of the layout. Operands always come before the operation that uses them in the node array.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Node
+        {
+            Operation operation = Operation::Value;
+            float value = 0;
+            std::uint32_t leftOperand = 0; // Index of the left operand in case the operation is a math operation
+            std::uint32_t rightOperand = 0; // Index of the right operand in case the operation is a math operation
+            Widget* boundWidget = nullptr; // The widget on which this node depends in case the operation is a binding
+            std::uint32_t boundStringStart = 0; // Start of the string referring to a widget inside m_boundStrings
+            std::uint32_t boundStringLength = 0; // Length of the string referring to a widget, 0 if the node wasn't created from a string
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tell the bound widgets that this layout no longer requires information about changes to their position or size
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void unbindLayout();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Resets the parent pointers of the left and right operands if they exist and tell the bound widget that this layout
-        // requires information about changes to its position or size when the operation requires a widget to be bound.
+        // Tell the bound widgets that this layout requires information about changes to their position or size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Forgets widgets that were found by name after copying, the same name may apply to a different widget now
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetBoundStrings();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the node for a constant, a binding string or a percentage and returns its index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint32_t addOperandNodes(std::string operand);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a node that refers to a widget by name and returns its index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint32_t addBindingStringNode(const std::string& expression);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a math operation on two nodes that already exist and returns its index
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void resetPointers();
+        std::uint32_t addOperationNode(Operation operation, std::uint32_t leftOperand, std::uint32_t rightOperand);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Moves the nodes of another layout behind the nodes of this layout and returns the index of its last node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        std::uint32_t appendLayout(Layout&& other);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Find the widget corresponding to the given name and bind it if found
+        // Converts the node and its operands to a string
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingString(const std::string& expression, Widget* widget, bool xAxis);
+        std::string nodeToString(std::size_t index) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         float m_value = 0;
-        Layout* m_parent = nullptr;
-        Operation m_operation = Operation::Value;
-        std::unique_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
-        std::string m_boundString; // String referring  to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
-        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        std::vector<Node> m_nodes; // Empty when the layout is a constant
+        std::unique_ptr<std::string> m_boundStrings; // Strings referring to widgets of all nodes that were created from a string, stored back to back. Only allocated when such a node exists.
+        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout is not a constant
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
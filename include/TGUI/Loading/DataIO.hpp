@@ -94,6 +94,18 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits a single section of the widget file, including its nested sections
+        ///
+        /// @param node    Node that is to be written as a section of the widget file
+        /// @param stream  Stream to which the section will be written
+        ///
+        /// Emitting a file section by section means that the tree of nodes never has to exist for the entire file at once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitSection(const std::unique_ptr<Node>& node, std::ostream& stream);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -41,6 +42,20 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters about what changed during the last call to load
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct ReloadStatistics
+        {
+            std::size_t renderersChanged = 0;    ///< Amount of renderers of which at least one property changed
+            std::size_t propertiesUnchanged = 0; ///< Amount of properties that kept their value and were not reapplied
+            std::size_t propertiesChanged = 0;   ///< Amount of properties that were added, removed or got a different value
+            std::size_t resourcesReused = 0;     ///< Amount of times a texture or font was reused instead of being loaded again
+            std::size_t notifications = 0;       ///< Amount of times a widget was told that a property of its renderer changed
+            std::size_t glyphsWarmedUp = 0;      ///< Amount of glyphs that were rasterized because of setFontWarmUp
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructs the theme class, with an optional theme file to load
         ///
@@ -64,10 +79,37 @@ namespace tgui
         ///
         /// When the theme was loaded before and a renderer with the same name is encountered, the widgets that were using
         /// the old renderer will be reloaded with the new renderer.
+        ///
+        /// Only the properties of which the value differs are reapplied to the widgets. Values are compared after converting
+        /// them to the type that the widgets requested, so e.g. "Red" and "#FF0000" are considered equal. Textures and fonts
+        /// that were already loaded by the previous theme are reused.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void load(const std::string& primary);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about how much was reapplied during the last call to load
+        ///
+        /// @return Counters of the last load
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const ReloadStatistics& getReloadStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes load rasterize the glyphs of the fonts in the theme before they are needed
+        ///
+        /// @param characters   Characters of which the glyphs should be loaded, or an empty string to disable the warm-up
+        /// @param includeBold  Should the bold glyphs be loaded as well?
+        ///
+        /// Theme files don't contain text sizes, so the glyphs are loaded at the global text size and at every character size
+        /// at which the fonts of the previous theme were used. This avoids hitches when the widgets redraw their text with a
+        /// font that was changed by the theme.
+        ///
+        /// @see Font::warmUp
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFontWarmUp(const sf::String& characters, bool includeBold = false);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets data for the renderers
         ///
@@ -166,6 +208,13 @@ namespace tgui
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loader which will do the actual loading
         std::map<std::string, std::shared_ptr<RendererData>> m_renderers; ///< Maps ids to renderer datas
         std::string m_primary;
+        ReloadStatistics m_reloadStatistics;
+        sf::String m_fontWarmUpCharacters;
+        bool m_fontWarmUpBold = false;
+
+        // Names of the properties that the theme loader provided for each renderer. Other properties in the renderer were
+        // added by widgets (e.g. default values) and are not reset when reloading.
+        std::map<std::string, std::set<std::string>> m_loadedProperties;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
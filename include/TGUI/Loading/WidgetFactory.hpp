@@ -44,6 +44,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets the construct function that will be used to create a widget when loading it
         ///
+        /// This function can be called from any thread.
+        ///
         /// @param type         Type of the widget
         /// @param constructor  Function used to construct the widget (all TGUI widgets use std::make_shared<WidgetType>)
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,9 +57,12 @@ namespace tgui
         ///
         /// @param type  Type of the widget
         ///
-        /// @return Function used to construct the widget (all TGUI widgets use std::make_shared<WidgetType>)
+        /// @return Function used to construct the widget (all TGUI widgets use std::make_shared<WidgetType>), or an empty function
+        ///         when no construct function exists for the type
+        ///
+        /// The function is returned by value so that it remains valid when setConstructFunction is called on another thread.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static const std::function<Widget::Ptr()>& getConstructFunction(const std::string& type);
+        static std::function<Widget::Ptr()> getConstructFunction(const std::string& type);
 
 
 
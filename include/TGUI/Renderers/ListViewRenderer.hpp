@@ -0,0 +1,106 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_LIST_VIEW_RENDERER_HPP
+#define TGUI_LIST_VIEW_RENDERER_HPP
+
+
+#include <TGUI/Renderers/ListBoxRenderer.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class TGUI_API ListViewRenderer : public ListBoxRenderer
+    {
+    public:
+
+        using ListBoxRenderer::ListBoxRenderer;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the background color of the header
+        ///
+        /// @param backgroundColor  New background color of the header
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setHeaderBackgroundColor(Color backgroundColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the background color of the header
+        ///
+        /// @return Background color of the header
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color getHeaderBackgroundColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color of the column captions in the header
+        ///
+        /// @param textColor  New text color of the header
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setHeaderTextColor(Color textColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color of the column captions in the header
+        ///
+        /// @return Text color of the header
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color getHeaderTextColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color of the lines between the columns in the header
+        ///
+        /// @param separatorColor  New color of the separators
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSeparatorColor(Color separatorColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color of the lines between the columns in the header
+        ///
+        /// @return Color of the separators
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color getSeparatorColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_LIST_VIEW_RENDERER_HPP
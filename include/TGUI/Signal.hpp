@@ -29,6 +29,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Global.hpp>
+#include <TGUI/InternedString.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Animation.hpp>
 #include <SFML/System/String.hpp>
@@ -49,7 +50,19 @@ namespace tgui
 
     namespace internal_signal
     {
-        extern TGUI_API std::deque<const void*> parameters;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parameters of the signal that is being emitted. Every thread has its own list, so that widgets can be created and
+        // signals can be emitted on multiple threads. The list grows when an index is accessed that doesn't exist yet on the
+        // current thread (e.g. when a signal was created on another thread).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TGUI_API ParameterList
+        {
+            const void*& operator[](std::size_t index);
+            std::size_t size() const;
+            void resize(std::size_t size);
+        };
+
+        extern TGUI_API ParameterList parameters;
     }
 
 
@@ -171,7 +184,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         std::string getName() const
         {
-            return m_name;
+            return m_name.getString();
         }
 
 
@@ -183,6 +196,17 @@ namespace tgui
         virtual unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns an estimate of the amount of bytes that the connected signal handlers occupy on the heap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getAllocatedMemory() const
+        {
+            // Every handler is stored in its own tree node, which also contains three pointers and the color of the node
+            return m_handlers.size() * (sizeof(decltype(m_handlers)::value_type) + 4 * sizeof(void*));
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -196,7 +220,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        std::string m_name;
+        InternedString m_name; // Signals with the same name share the string
         std::map<unsigned int, std::function<void()>> m_handlers;
     };
 
@@ -33,6 +33,9 @@
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Vertex.hpp>
+#include <array>
+#include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -122,6 +125,8 @@ namespace tgui
         ///
         /// By default, the sprite's color is opaque white.
         ///
+        /// The color is only applied when drawing, the vertices of the sprite are shared with other sprites of the same size.
+        ///
         /// @param color  New color of the sprite
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -208,28 +213,58 @@ namespace tgui
         void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the triangles of the sprite to a list of vertices
+        ///
+        /// @param vertices  List of vertices to which the triangles are added
+        /// @param offset    Distance to move the sprite, in addition to its own position
+        ///
+        /// This allows several sprites with the same texture to be drawn with a single draw call, with the texture and shader
+        /// of the sprite in the render states and sf::Triangles as primitive type.
+        /// The visible rect that was set with setVisibleRect is ignored.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTriangles(std::vector<sf::Vertex>& vertices, Vector2f offset = {}) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Vertices of the sprite in local space, stored as a triangle strip with white vertices
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Geometry
+        {
+            ScalingType scalingType = ScalingType::Normal;
+            std::size_t vertexCount = 0;
+            std::array<sf::Vertex, 22> vertices;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the location of the vertices
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateVertices();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the geometry for the given texture size, middle rect and sprite size. The geometry is shared with all other
+        // sprites that use the same parameters and is only calculated when no other sprite is using it yet.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<const Geometry> getGeometry(Vector2f textureSize, FloatRect middleRect, Vector2f size);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         Vector2f    m_size;
         Texture     m_texture;
-        std::vector<sf::Vertex> m_vertices;
+        std::shared_ptr<const Geometry> m_geometry;
 
         FloatRect   m_visibleRect;
 
         Color       m_vertexColor = Color::White;
         float       m_opacity = 1;
-
-        ScalingType m_scalingType = ScalingType::Normal;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
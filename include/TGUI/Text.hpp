@@ -31,7 +31,9 @@
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -109,6 +111,14 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /// Copies of a text share their string and vertices until one of them is changed, so copying a text is cheap.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Text();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the text
         ///
@@ -245,6 +255,13 @@ namespace tgui
         Vector2f findCharacterPos(std::size_t index) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether this text still shares its string and vertices with another text that it was copied from or to.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSharingDataWith(const Text& other) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the text to a render target
         ///
@@ -264,10 +281,40 @@ namespace tgui
         void recalculateSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Builds the vertices that render the text from the distance field of the font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDistanceFieldVertices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // The text and the vertices that are created from it are shared between copies until one of the copies is changed
+        struct SharedData
+        {
+            sf::Text        text;
+            sf::VertexArray distanceFieldVertices{sf::Triangles};
+            bool            distanceFieldVerticesOutdated = true;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the shared data after making a copy of it when it is still being used by other texts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SharedData& getMutableData();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the data that all texts share until they are changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const std::shared_ptr<SharedData>& getEmptyData();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        sf::Text     m_text;
+        std::shared_ptr<SharedData> m_data;
         Vector2f     m_size;
         Font         m_font;
         Color        m_color;
@@ -30,6 +30,7 @@
 
 #include <TGUI/TextureData.hpp>
 #include <memory>
+#include <vector>
 #include <list>
 #include <map>
 
@@ -53,6 +54,9 @@ namespace tgui
         ///
         /// The second time you call this function with the same filename, the previously loaded image will be reused.
         ///
+        /// This function can be called from any thread. When setDeferredUploadList was called on the calling thread, only the
+        /// image is loaded and the texture is created later by uploadDeferredTextures.
+        ///
         /// @return Texture data when loaded successfully, nullptr otherwise
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +83,29 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Makes getTexture only load the image on the calling thread, without creating the texture on the graphics card
+        ///
+        /// @param pendingTextures  List to which the texture data that still has to be uploaded is added, or nullptr to create
+        ///                         textures immediately again
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDeferredUploadList(std::vector<std::shared_ptr<TextureData>>* pendingTextures);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Creates the textures of which the upload was deferred
+        ///
+        /// @param pendingTextures  Texture data that was collected while a deferred upload list was set
+        ///
+        /// This function has to be called on the thread that draws the gui.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void uploadDeferredTextures(const std::vector<std::shared_ptr<TextureData>>& pendingTextures);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -77,6 +77,28 @@ namespace tgui
         typedef std::shared_ptr<const Widget> ConstPtr; ///< Shared constant widget pointer
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Estimate of the memory used by widgets, as returned by getMemoryReport
+        ///
+        /// Only memory owned by the Widget base class and by containers is counted, data specific to a widget type isn't.
+        /// Memory that is shared between widgets, such as renderer data, textures and fonts, is not included either.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct MemoryReport
+        {
+            /// Widgets of a single type
+            struct WidgetTypeUsage
+            {
+                std::size_t widgetCount = 0; ///< Amount of widgets of this type
+                std::size_t bytes = 0;       ///< Bytes used by all widgets of this type together
+            };
+
+            std::map<std::string, WidgetTypeUsage> widgetTypes; ///< Memory usage per widget type
+            std::map<std::string, std::size_t> subsystems;       ///< Bytes used per part of the widgets (e.g. "Layouts" or "Signals")
+            std::size_t widgetCount = 0;                         ///< Total amount of widgets
+            std::size_t totalBytes = 0;                          ///< Total amount of bytes used by all widgets
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -249,6 +271,8 @@ namespace tgui
         /// @brief Get the absolute position of the widget instead of the relative position to its parent
         ///
         /// @return Absolute position of the widget
+        ///
+        /// The result is cached and only recalculated after the position of the widget or one of its parents has changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual Vector2f getAbsolutePosition() const;
 
@@ -410,7 +434,7 @@ namespace tgui
         void setUserData(tgui::Any userData)
     #endif
         {
-            m_userData = std::move(userData);
+            getColdData().userData = std::move(userData);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -422,9 +446,15 @@ namespace tgui
         T getUserData() const
         {
         #ifdef TGUI_USE_CPP17
-            return std::any_cast<T>(m_userData);
+            if (m_coldData)
+                return std::any_cast<T>(m_coldData->userData);
+            else
+                return std::any_cast<T>(std::any{});
         #else
-            return m_userData.as<T>();
+            if (m_coldData)
+                return m_coldData->userData.as<T>();
+            else
+                throw std::bad_cast();
         #endif
         }
 
@@ -506,6 +536,14 @@ namespace tgui
         virtual void update(sf::Time elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the update function has to be called every frame on this widget or one of its child widgets.
+        /// Only widgets for which this function returns true are being updated by their parent.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateRequired() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -663,9 +701,41 @@ namespace tgui
         virtual Widget::Ptr clone() const = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Estimates how much memory is used by the widget
+        ///
+        /// @return Memory used by this widget, its tool tip and, when the widget is a container, all widgets inside it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MemoryReport getMemoryReport() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds the memory used by the widget to a report
+        ///
+        /// @param report  Report to which the estimated memory usage of this widget is added
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void addToMemoryReport(MemoryReport& report) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Members that most widgets never use. They are only allocated when one of them is set.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct ColdData
+        {
+            Widget::Ptr toolTip; // The tool tip connected to the widget
+            std::vector<std::shared_ptr<priv::Animation>> showAnimations;
+
+        #ifdef TGUI_USE_CPP17
+            std::any userData;
+        #else
+            tgui::Any userData;
+        #endif
+        };
+
         using SavingRenderersMap = std::map<const Widget*, std::pair<std::unique_ptr<DataIO::Node>, std::string>>;
         using LoadingRenderersMap = std::map<std::string, std::shared_ptr<RendererData>>;
 
@@ -714,6 +784,19 @@ namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Informs the parent that the value returned by isUpdateRequired may have changed.
+        // This function has to be called whenever the widget starts or stops needing the time that passes (e.g. for animations).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRequiredChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the cached absolute position as outdated. Containers also invalidate the cache of their child widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidateAbsolutePosition();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw a rectangle shape with the right opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -736,6 +819,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the members that are rarely used, allocating them when this is the first time they are needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ColdData& getColdData();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Callback function which is called on a renderer change and which calls the virtual rendererChanged function
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -757,7 +846,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        std::string m_type;
+        InternedString m_type; // Widgets of the same type share the string
 
         Layout2d m_position;
         Layout2d m_size;
@@ -767,6 +856,10 @@ namespace tgui
         Vector2f m_prevPosition;
         Vector2f m_prevSize;
 
+        // Cached result of getAbsolutePosition. When the cache of a widget is invalid then the caches of its children are too.
+        mutable Vector2f m_absolutePositionCached;
+        mutable bool m_absolutePositionCacheValid = false;
+
         // Layouts that need to recalculate their value when the position or size of this widget changes
         std::unordered_set<Layout*> m_boundPositionLayouts;
         std::unordered_set<Layout*> m_boundSizeLayouts;
@@ -780,6 +873,9 @@ namespace tgui
         // This will point to our parent widget. If there is no parent then this will be nullptr.
         Container* m_parent = nullptr;
 
+        // Position of the widget in the widget list of the parent. Container checks this hint before relying on it.
+        std::size_t m_indexInParent = 0;
+
         // Is the mouse on top of the widget? Did the mouse go down on the widget?
         bool m_mouseHover = false;
         bool m_mouseDown = false;
@@ -796,15 +892,9 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
-        // The tool tip connected to the widget
-        Widget::Ptr m_toolTip = nullptr;
-
         // Renderer of the widget
         aurora::CopiedPtr<WidgetRenderer> m_renderer = aurora::makeCopied<WidgetRenderer>();
 
-        // Show animations
-        std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
-
         // Renderer properties that can be passed from containers to their children
         Font m_inheritedFont;
         float m_inheritedOpacity = 1;
@@ -814,11 +904,8 @@ namespace tgui
         float m_opacityCached = 1;
         bool m_transparentTextureCached = false;
 
-    #ifdef TGUI_USE_CPP17
-        std::any m_userData;
-    #else
-        tgui::Any m_userData;
-    #endif
+        // Tool tip, show animations and user data, which are nullptr until they are used
+        std::unique_ptr<ColdData> m_coldData;
 
         std::function<void(const std::string& property)> m_rendererChangedCallback = [this](const std::string& property){ rendererChangedCallback(property); };
 
@@ -146,6 +146,12 @@ namespace tgui
         void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions the widgets once after multiple widgets were added, removed or reordered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetsChangedInBatch() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // @brief Repositions and resize the widgets
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,6 +118,26 @@ namespace tgui
         void removeAllWidgets() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets for which the predicate returns true, together with their ratios
+        ///
+        /// @param predicate  Function that is called once for every widget and returns whether it should be removed
+        ///
+        /// @return Amount of widgets that were removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t removeWidgets(const std::function<bool(const Widget::Ptr&)>& predicate) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the order of the widgets in the layout, the ratios move together with the widgets
+        ///
+        /// @param widgets  All widgets of the layout, in their new order
+        ///
+        /// @return True when the order was changed, false when the list didn't contain every widget exactly once
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool reorder(const std::vector<Widget::Ptr>& widgets) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Add an extra space after the last widget
         ///
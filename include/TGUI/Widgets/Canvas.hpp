@@ -30,6 +30,7 @@
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <array>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -105,11 +106,67 @@ namespace tgui
         ///
         /// @param size  The new size of the widget
         ///
+        /// The contents of the canvas are kept when it is resized. The texture behind the canvas grows in steps and never
+        /// shrinks, so the canvas can be resized every frame (e.g. while the window is being resized) without creating a
+        /// new texture every time.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setSize(const Layout2d& size) override;
         using Widget::setSize;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether areas that become visible after resizing or scrolling the canvas are cleared
+        ///
+        /// @param autoClear  Should new areas be filled with black (or the color passed to scroll)?
+        ///
+        /// When the canvas is redrawn completely every frame, disabling this avoids clearing pixels that will be overwritten
+        /// anyway. The contents of new areas are undefined when auto-clear is disabled. It is enabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAutoClear(bool autoClear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether areas that become visible after resizing or scrolling the canvas are cleared
+        ///
+        /// @return Are new areas filled with a color?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getAutoClear() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Moves the current contents of the canvas
+        ///
+        /// @param offset     Amount of pixels that the contents move, e.g. (-10, 0) moves everything 10 pixels to the left
+        /// @param fillColor  Color of the area that becomes empty when auto-clear is enabled
+        ///
+        /// Scrolling doesn't copy any pixels, it only changes which part of the texture is shown where. This is useful for
+        /// strip charts: scroll the canvas by the width of a new strip and then only draw the new strip.
+        /// Call display() after drawing the new content.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scroll(Vector2f offset, Color fillColor = Color::Black);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the canvas
+        ///
+        /// @param pixels  Array of pixels in RGBA format, containing width * height pixels
+        /// @param width   Width of the area to update
+        /// @param height  Height of the area to update
+        /// @param x       Left position of the area to update
+        /// @param y       Top position of the area to update
+        ///
+        /// Only the pixels of the given area are uploaded to the graphics card, so when pixels are calculated on the cpu
+        /// (e.g. for a plot), only the changed part has to be passed instead of the entire canvas.
+        /// Call display() after updating the pixels.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updatePixels(const sf::Uint8* pixels, unsigned int width, unsigned int height, unsigned int x, unsigned int y);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Clears the entire canvas with a single color
         ///
@@ -195,11 +252,51 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Part of the canvas that is stored in one piece of the texture. After scrolling, the canvas is split in up to 4 parts.
+        struct Tile
+        {
+            FloatRect   area;        // Part of the canvas
+            sf::IntRect textureRect; // Part of the texture where this area is stored
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the canvas in the parts that are stored in one piece of the texture and returns the amount of parts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTiles(std::array<Tile, 4>& tiles) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the view of the render texture so that only the given part of the canvas can be drawn to.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setViewToTile(const Tile& tile);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the pixels in a part of the canvas with a color.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void fillArea(FloatRect area, Color color);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         sf::RenderTexture m_renderTexture;
         sf::Sprite        m_sprite;
+
+        // Size of the visible part of the texture, the texture itself can be larger to make resizing cheaper
+        sf::Vector2u m_canvasSize;
+
+        // Position in the texture where the top left pixel of the canvas is stored, this changes when the canvas is scrolled
+        sf::Vector2u m_scrollOffset;
+
+        bool m_autoClear = true;
+
+        // Texture that is used to upload the pixels passed to updatePixels
+        sf::Texture m_uploadTexture;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 #include <TGUI/FloatRect.hpp>
 #include <TGUI/Text.hpp>
 #include <regex>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -76,11 +77,13 @@ namespace tgui
             static inline const std::string Int   = "[+-]?[0-9]*";           ///< Accept negative and positive integers
             static inline const std::string UInt  = "[0-9]*";                ///< Accept only positive integers
             static inline const std::string Float = "[+-]?[0-9]*\\.?[0-9]*"; ///< Accept decimal numbers
+            static inline const std::string Hex   = "[0-9a-fA-F]*";          ///< Accept hexadecimal digits
         #else
             static TGUI_API const std::string All;   ///< Accept any input
             static TGUI_API const std::string Int;   ///< Accept negative and positive integers
             static TGUI_API const std::string UInt;  ///< Accept only positive integers
             static TGUI_API const std::string Float; ///< Accept decimal numbers
+            static TGUI_API const std::string Hex;   ///< Accept hexadecimal digits
         #endif
         };
 
@@ -371,6 +374,10 @@ namespace tgui
         /// When the regex does not match when calling the setText function then the edit box contents will be cleared.
         /// When it does not match when the user types a character in the edit box, then the input character is rejected.
         ///
+        /// The predefined validators and regexes that only consist of a character set followed by "*" or "{0,n}" (e.g. "[a-z_]*"
+        /// or "[0-9]{0,5}") are checked without std::regex and only look at the typed character. Other regexes are compiled once
+        /// and shared between all edit boxes that use them.
+        ///
         /// Examples:
         /// @code
         /// edit1->setInputValidator(EditBox::Validator::Int);
@@ -505,6 +512,25 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes characters from m_text while keeping track of where the decimal point is located
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseCharacters(std::size_t pos, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether the entire text is accepted by the input validator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAcceptedByValidator(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether replacing the characters between start and end with the given character would result in a text that is
+        // accepted by the input validator. The current text is assumed to already be accepted.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool canReplaceCharacters(std::size_t start, std::size_t end, std::uint32_t key);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the position of the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -529,6 +555,12 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true while the caret is blinking or a double click is still possible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -561,8 +593,30 @@ namespace tgui
         // The text inside the edit box
         sf::String    m_text;
 
+        // The input validator. Simple validators are checked by hand, other regexes are compiled once and shared.
+        enum class ValidatorType
+        {
+            All,
+            Int,
+            UInt,
+            Float,
+            CharacterSet,
+            Regex
+        };
+
         std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        ValidatorType m_validatorType = ValidatorType::All;
+
+        // Inclusive ranges of accepted characters and the maximum length (0 for unlimited) for the CharacterSet validator
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> m_validatorCharacterRanges;
+        std::size_t   m_validatorMaxLength = 0;
+
+        // Compiled regex for the Regex validator and a buffer that is reused to avoid allocating a string on every key press
+        std::shared_ptr<const std::regex> m_regex;
+        std::string   m_regexBuffer;
+
+        // Position of the decimal point in m_text, so that the Float validator doesn't have to search for it on every key press
+        std::size_t   m_decimalPointPosition = sf::String::InvalidPos;
 
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_textSize = 0;
@@ -169,6 +169,18 @@ namespace tgui
         void removeAllWidgets() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets for which the predicate returns true
+        ///
+        /// @param predicate  Function that is called once for every widget and returns whether it should be removed
+        ///
+        /// @return Amount of widgets that were removed
+        ///
+        /// The widgets are removed from the grid one by one, so this isn't faster than calling remove for each widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t removeWidgets(const std::function<bool(const Widget::Ptr&)>& predicate) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Adds a widget to the grid
         ///
@@ -0,0 +1,638 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_LIST_VIEW_HPP
+#define TGUI_LIST_VIEW_HPP
+
+
+#include <TGUI/CopiedSharedPtr.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/Renderers/ListViewRenderer.hpp>
+#include <TGUI/Text.hpp>
+#include <functional>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief List with multiple columns of which the rows are provided by a callback
+    ///
+    /// The list view doesn't store its rows. It only knows how many rows there are and asks the data provider for the text
+    /// of the cells that are currently visible. The cost of scrolling and drawing thus only depends on the size of the
+    /// widget and not on the amount of rows.
+    /// @code
+    /// listView->addColumn("Name", 200);
+    /// listView->addColumn("Amount", 80);
+    /// listView->setDataProvider([&](std::size_t row, std::size_t column){ return inventory.getCell(row, column); },
+    ///                           inventory.getRowCount());
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ListView : public Widget
+    {
+      public:
+
+        typedef std::shared_ptr<ListView> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const ListView> ConstPtr; ///< Shared constant widget pointer
+
+        /// Returns the text of the cell in the given row and column
+        using DataProvider = std::function<sf::String(std::size_t row, std::size_t column)>;
+
+        /// Reorders the rows of the data provider when the user clicks on a column header
+        using SortFunction = std::function<void(std::size_t column, bool ascending)>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListView();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new list view widget
+        ///
+        /// @return The new list view
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ListView::Ptr create();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another list view
+        ///
+        /// @param listView  The other list view
+        ///
+        /// @return The new list view
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ListView::Ptr copy(ListView::ConstPtr listView);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
+        /// @return Temporary pointer to the renderer that may be shared with other widgets using the same renderer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListViewRenderer* getSharedRenderer();
+        const ListViewRenderer* getSharedRenderer() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
+        /// @return Temporary pointer to the renderer
+        /// @warning After calling this function, the widget has its own copy of the renderer and it will no longer be shared.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListViewRenderer* getRenderer();
+        const ListViewRenderer* getRenderer() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the list view
+        ///
+        /// @param size  The new size of the list view
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(const Layout2d& size) override;
+        using Widget::setSize;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a column
+        ///
+        /// @param caption  Text shown in the header of the column
+        /// @param width    Width of the column
+        ///
+        /// @return Index of the new column
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t addColumn(const sf::String& caption, float width = 100);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the width of a column
+        ///
+        /// @param index  Index of the column
+        /// @param width  New width of the column
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setColumnWidth(std::size_t index, float width);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width of a column
+        ///
+        /// @param index  Index of the column
+        ///
+        /// @return Width of the column or 0 when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getColumnWidth(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the caption of a column
+        ///
+        /// @param index  Index of the column
+        ///
+        /// @return Text in the header of the column or an empty string when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getColumnCaption(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of columns
+        ///
+        /// @return Number of columns
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getColumnCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all columns
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllColumns();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the function that provides the text of the cells
+        ///
+        /// @param provider  Function that returns the text of a cell, it is only called for cells that become visible
+        /// @param rowCount  Amount of rows that the provider has
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDataProvider(const DataProvider& provider, std::size_t rowCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of rows that the data provider has
+        ///
+        /// @param rowCount  Amount of rows
+        ///
+        /// Rows that were already visible are not requested again, call refreshRows when their contents changed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRowCount(std::size_t rowCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of rows
+        ///
+        /// @return Number of rows that the data provider has
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getRowCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Requests the text of the visible cells again from the data provider
+        ///
+        /// This has to be called when the data of the provider changed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refreshRows();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the function that sorts the rows of the data provider
+        ///
+        /// @param sortFunction  Function that is called when the user clicks on a column header
+        ///
+        /// Clicking on the header of the column that is already sorted reverses the order.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSortFunction(const SortFunction& sortFunction);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sorts the rows by calling the sort function and shows the sort direction in the header
+        ///
+        /// @param column     Index of the column to sort on
+        /// @param ascending  Should the rows be sorted in ascending order?
+        ///
+        /// The selection is removed as the selected row may have moved.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortByColumn(std::size_t column, bool ascending = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the column that the rows are sorted on
+        ///
+        /// @return Index of the column passed to sortByColumn, or -1 when the rows weren't sorted
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getSortColumn() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the rows are sorted in ascending order
+        ///
+        /// @return Direction that was passed to sortByColumn
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSortedAscending() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Selects a row
+        ///
+        /// @param index  Index of the row
+        ///
+        /// @return
+        ///         - true on success
+        ///         - false when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setSelectedRow(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deselects the selected row
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deselectRow();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the selected row
+        ///
+        /// @return Index of the selected row or -1 when no row was selected
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getSelectedRow() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the height of the rows
+        ///
+        /// @param rowHeight  The size of a single row
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRowHeight(unsigned int rowHeight);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the height of the rows
+        ///
+        /// @return Row height
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getRowHeight() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the height of the header with the column captions
+        ///
+        /// @param headerHeight  Height of the header or 0 to hide it
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setHeaderHeight(unsigned int headerHeight);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the height of the header with the column captions
+        ///
+        /// @return Header height
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getHeaderHeight() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the text size of the cells and column captions
+        ///
+        /// @param textSize  The character size of the text, or 0 to determine it based on the row height
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTextSize(unsigned int textSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text size of the cells
+        ///
+        /// @return The text size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getTextSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the thumb position of the vertical scrollbar
+        ///
+        /// @param value  New value of the vertical scrollbar
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVerticalScrollbarValue(unsigned int value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the thumb position of the vertical scrollbar
+        ///
+        /// @return Value of the vertical scrollbar
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getVerticalScrollbarValue() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the thumb position of the horizontal scrollbar
+        ///
+        /// @param value  New value of the horizontal scrollbar
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setHorizontalScrollbarValue(unsigned int value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the thumb position of the horizontal scrollbar
+        ///
+        /// @return Value of the horizontal scrollbar
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getHorizontalScrollbarValue() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
+        ///
+        /// @return Is the mouse on top of the widget?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool mouseOnWidget(Vector2f pos) const override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void leftMousePressed(Vector2f pos) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void leftMouseReleased(Vector2f pos) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mouseMoved(Vector2f pos) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool mouseWheelScrolled(float delta, Vector2f pos) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mouseNoLongerOnWidget() override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mouseNoLongerDown() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draw the widget to a render target
+        ///
+        /// @param target Render target to draw to
+        /// @param states Current render states
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves a signal based on its name
+        ///
+        /// @param signalName  Name of the signal
+        ///
+        /// @return Signal that corresponds to the name
+        ///
+        /// @throw Exception when the name does not match any signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal& getSignal(std::string signalName) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when one of the properties of the renderer is changed
+        ///
+        /// @param property  Lowercase name of the property that was changed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rendererChanged(const std::string& property) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the widget as a tree node in order to save it to a file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> save(SavingRenderersMap& renderers) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the widget from a tree of nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the size without the borders
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getInnerSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the area in which the rows are drawn, relative to the top left of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getRowsArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the total width of all columns
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getTotalColumnWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row below the mouse, or -1 when the mouse isn't on a row. The position is relative to the widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getRowAtPosition(Vector2f pos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the column of which the header is below the mouse, or -1 when the mouse isn't on the header
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getHeaderColumnAtPosition(Vector2f pos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the size, position and range of both scrollbars
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbars();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the texts of the cells that became visible and drops the ones that are no longer visible.
+        // When rebuild is true, all visible cells are requested again from the data provider.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleCells(bool rebuild = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the texts of a visible row the color and style that matches its selected and hover state
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRowColorsAndStyle(std::size_t row);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the texts of all visible rows the color and style that matches their state
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleRowsColorsAndStyle();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the text size, font, color and opacity of the column captions
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCaptions();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Update on which row the mouse is standing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateHoveringRow(int row);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Update which row is selected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelectedRow(int row);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called every frame with the time passed since the last frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true while a double click is still possible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr clone() const override
+        {
+            return std::make_shared<ListView>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
+        SignalInt onItemSelect   = {"ItemSelected"};   ///< A row was selected. Optional parameter: index of the selected row or -1
+        SignalInt onDoubleClick  = {"DoubleClicked"};  ///< A row was double clicked. Optional parameter: index of the row
+        SignalInt onHeaderClick  = {"HeaderClicked"};  ///< The header of a column was clicked. Optional parameter: column index
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct Column
+        {
+            Text caption;
+            float width = 0;
+        };
+
+        // Texts of the visible columns in a visible row
+        struct VisibleRow
+        {
+            std::size_t index = 0;
+            std::vector<Text> cells;
+        };
+
+        std::vector<Column> m_columns;
+
+        DataProvider m_dataProvider;
+        SortFunction m_sortFunction;
+        std::size_t m_rowCount = 0;
+
+        // Only the rows and columns that are visible have texts, the rows are stored in order
+        std::vector<VisibleRow> m_visibleRows;
+        std::size_t m_firstVisibleColumn = 0;
+        std::size_t m_lastVisibleColumn = 0;
+
+        int m_selectedRow = -1;
+        int m_hoveringRow = -1;
+        int m_mouseDownOnHeaderColumn = -1;
+        int m_sortColumn = -1;
+        bool m_sortAscending = true;
+
+        unsigned int m_rowHeight = 0;
+        unsigned int m_headerHeight = 0;
+        unsigned int m_requestedTextSize = 0;
+        unsigned int m_textSize = 0;
+
+        CopiedSharedPtr<ScrollbarChildWidget> m_verticalScroll;
+        CopiedSharedPtr<ScrollbarChildWidget> m_horizontalScroll;
+
+        // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
+        bool m_possibleDoubleClick = false;
+
+        Sprite m_spriteBackground;
+
+        // Cached renderer properties
+        Borders   m_bordersCached;
+        Borders   m_paddingCached;
+        Color     m_borderColorCached;
+        Color     m_backgroundColorCached;
+        Color     m_backgroundColorHoverCached;
+        Color     m_selectedBackgroundColorCached;
+        Color     m_selectedBackgroundColorHoverCached;
+        Color     m_textColorCached;
+        Color     m_textColorHoverCached;
+        Color     m_selectedTextColorCached;
+        Color     m_selectedTextColorHoverCached;
+        Color     m_headerBackgroundColorCached;
+        Color     m_headerTextColorCached;
+        Color     m_separatorColorCached;
+        TextStyle m_textStyleCached;
+        TextStyle m_selectedTextStyleCached;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_LIST_VIEW_HPP
@@ -340,6 +340,42 @@ namespace tgui
         void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Opens the menu with the given index, after closing the menu that was open before
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void openMenu(std::size_t menuIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes which item of the open menu is selected. Pass -1 to deselect the item.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelectedMenuItem(int menuItem);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the left position of a menu in the bar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMenuLeft(std::size_t menuIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the width of a menu in the bar. The items of the menu are only measured again when the menu is opened.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateMenuWidth(std::size_t menuIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the width of all menus in the bar and updates the geometry of the open menu
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateMenuWidths();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the width of the open menu when its items changed and rebuilds its background geometry
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateOpenMenuGeometry();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,10 +403,21 @@ namespace tgui
             Text text;
             std::vector<Text> menuItems;
             int selectedMenuItem = -1;
+
+            float width = 0; // Width of the menu in the bar
+            float itemsWidth = 0; // Width of the items when the menu is open, only valid when itemsWidthOutdated is false
+            bool itemsWidthOutdated = true;
+            Sprite spriteBackground; // Item background texture, sized to the width of the menu in the bar
         };
 
         std::vector<Menu> m_menus;
 
+        // Geometry of the open menu, which is only rebuilt when the menu is opened or when its items or properties change
+        std::vector<sf::Vertex> m_openMenuVertices; // Background of the menu in the bar followed by the backgrounds of its items, or the textured item backgrounds
+        Sprite m_spriteOpenMenuBackground; // Selected item background texture, sized to the width of the menu in the bar
+        Sprite m_spriteOpenMenuItemBackground;
+        Sprite m_spriteOpenMenuSelectedItemBackground;
+
         int m_visibleMenu = -1;
 
         unsigned int m_textSize = 0;
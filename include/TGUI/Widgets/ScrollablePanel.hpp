@@ -169,6 +169,16 @@ namespace tgui
         void removeAllWidgets() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all child widgets for which the predicate returns true
+        ///
+        /// @param predicate  Function that is called once for every child widget and returns whether it should be removed
+        ///
+        /// @return Amount of widgets that were removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t removeWidgets(const std::function<bool(const Widget::Ptr&)>& predicate) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Channges the size available for child widgets
         ///
@@ -302,6 +312,12 @@ namespace tgui
         void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbars once after multiple widgets were added or removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetsChangedInBatch() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -119,6 +119,12 @@ namespace tgui
         ///
         /// @param text  Text that will be added to the text that is already in the text box
         ///
+        /// Only the last line and the new text are word-wrapped again, so the text box can be used to stream a log.
+        /// When the view was scrolled to the bottom, it stays at the bottom. Otherwise the visible lines remain in place.
+        /// The caret only moves along with the text when it was located at the end and nothing was selected.
+        ///
+        /// @see setLineLimit
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addText(const sf::String& text);
 
@@ -184,6 +190,53 @@ namespace tgui
         std::size_t getMaximumCharacters() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets a limit on the amount of lines that are kept in the text box
+        ///
+        /// @param maxLines  Maximum amount of lines, as they are displayed after word-wrap, or 0 to disable the limit
+        ///
+        /// Unlike setMaximumCharacters which refuses new text, this limit removes the oldest lines to make room.
+        /// When addText exceeds the limit, a quarter of the lines is removed at once so that the cost of removing the
+        /// text is spread over many calls.
+        ///
+        /// The line limit is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLineLimit(std::size_t maxLines);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of lines that are kept in the text box
+        ///
+        /// @return Line limit, or 0 when there is no limit
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineLimit() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets a limit on the amount of characters that are kept in the text box
+        ///
+        /// @param maxChars  Maximum amount of characters, or 0 to disable the limit
+        ///
+        /// Unlike setMaximumCharacters which refuses new text, this limit removes the oldest lines to make room.
+        /// Lines are removed in the same way as for the line limit.
+        ///
+        /// @see setLineLimit
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCharacterLimit(std::size_t maxChars);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of characters that are kept in the text box
+        ///
+        /// @return Character limit, or 0 when there is no limit
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCharacterLimit() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets the blinking caret to after a specific character
         ///
@@ -363,7 +416,20 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Removes the oldest lines until the text fits within the given limits (0 means no limit).
+        // Returns the amount of lines that were removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t removeOldestLines(std::size_t lineLimit, std::size_t characterLimit);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the scrollbar how many pixels the text contains.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbarMaximum();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Scrolls to the caret when needed and updates the positions and the texts of the visible lines.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
@@ -393,6 +459,12 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true while the caret is blinking or a double click is still possible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the positions of the contents of the text box.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -405,6 +477,12 @@ namespace tgui
         void recalculateVisibleLines();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the visible lines into five pieces so that the text and the selection can be easily drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleTexts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -465,6 +543,10 @@ namespace tgui
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
+        // How many lines and characters are kept when text is added (0 by default, which means no limit)
+        std::size_t m_lineLimit = 0;
+        std::size_t m_characterLimit = 0;
+
         // What is known about the visible lines?
         std::size_t m_topLine = 1;
         std::size_t m_visibleLines = 1;
@@ -483,6 +565,9 @@ namespace tgui
         Text m_textAfterSelection1;
         Text m_textAfterSelection2;
 
+        // The text objects only contain the lines that were visible when they were last updated
+        bool m_visibleTextsOutdated = true;
+
         std::vector<FloatRect> m_selectionRects;
 
         // The scrollbar
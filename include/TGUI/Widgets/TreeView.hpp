@@ -0,0 +1,593 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TREE_VIEW_HPP
+#define TGUI_TREE_VIEW_HPP
+
+
+#include <TGUI/CopiedSharedPtr.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/Renderers/ListBoxRenderer.hpp>
+#include <TGUI/Text.hpp>
+#include <functional>
+#include <limits>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Tree of items of which the children are only requested when their parent is expanded
+    ///
+    /// Items are identified by their hierarchy, e.g. {"Assets", "Textures", "Grass.png"}. The children provider is called
+    /// with the hierarchy of an item the first time that the item is expanded and with an empty hierarchy to get the
+    /// items at the root of the tree.
+    /// @code
+    /// treeView->setChildrenProvider([](const std::vector<sf::String>& hierarchy){
+    ///     std::vector<tgui::TreeView::Item> items;
+    ///     for (const auto& entry : listDirectory(hierarchy))
+    ///         items.push_back({entry.name, entry.isDirectory});
+    ///     return items;
+    /// });
+    /// @endcode
+    ///
+    /// The tree view uses the same renderer properties as a list box.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TreeView : public Widget
+    {
+      public:
+
+        typedef std::shared_ptr<TreeView> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const TreeView> ConstPtr; ///< Shared constant widget pointer
+
+        /// Item returned by the children provider
+        struct Item
+        {
+            sf::String text;
+            bool hasChildren = false; ///< Can the item be expanded?
+        };
+
+        /// Returns the children of the item with the given hierarchy, or the root items when the hierarchy is empty
+        using ChildrenProvider = std::function<std::vector<Item>(const std::vector<sf::String>& hierarchy)>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TreeView();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new tree view widget
+        ///
+        /// @return The new tree view
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static TreeView::Ptr create();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another tree view
+        ///
+        /// @param treeView  The other tree view
+        ///
+        /// @return The new tree view
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static TreeView::Ptr copy(TreeView::ConstPtr treeView);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
+        /// @return Temporary pointer to the renderer that may be shared with other widgets using the same renderer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListBoxRenderer* getSharedRenderer();
+        const ListBoxRenderer* getSharedRenderer() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
+        /// @return Temporary pointer to the renderer
+        /// @warning After calling this function, the widget has its own copy of the renderer and it will no longer be shared.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListBoxRenderer* getRenderer();
+        const ListBoxRenderer* getRenderer() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the tree view
+        ///
+        /// @param size  The new size of the tree view
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(const Layout2d& size) override;
+        using Widget::setSize;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the function that provides the children of the items
+        ///
+        /// @param provider  Function that is called when an item is expanded for the first time
+        ///
+        /// All items are removed and the root items are requested from the new provider.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setChildrenProvider(const ChildrenProvider& provider);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the children of an item
+        ///
+        /// @param hierarchy  Hierarchy of the item, its parents have to be loaded already
+        ///
+        /// @return True when the item was found and has children, false otherwise
+        ///
+        /// The children are requested from the children provider when the item is expanded for the first time.
+        /// The parents of the item are expanded as well.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool expand(const std::vector<sf::String>& hierarchy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Hides the children of an item
+        ///
+        /// @param hierarchy  Hierarchy of the item
+        ///
+        /// @return True when the item was found, false otherwise
+        ///
+        /// The children remain loaded and are shown again without calling the children provider when the item is expanded.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool collapse(const std::vector<sf::String>& hierarchy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the children of an item are shown
+        ///
+        /// @param hierarchy  Hierarchy of the item
+        ///
+        /// @return Is the item expanded? False when the item wasn't found.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isExpanded(const std::vector<sf::String>& hierarchy) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Collapses all items so that only the root items remain visible
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void collapseAll();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets the loaded children of an item, they are requested again when the item is expanded next time
+        ///
+        /// @param hierarchy  Hierarchy of the item, or an empty list to request the root items again
+        ///
+        /// @return True when the item was found, false otherwise
+        ///
+        /// When the item was expanded then its children are requested immediately.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool reloadChildren(const std::vector<sf::String>& hierarchy = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Selects an item
+        ///
+        /// @param hierarchy  Hierarchy of the item
+        ///
+        /// @return True when the item was found, false otherwise
+        ///
+        /// The parents of the item are expanded to make the item visible.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setSelectedItem(const std::vector<sf::String>& hierarchy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deselects the selected item
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deselectItem();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the hierarchy of the selected item
+        ///
+        /// @return Hierarchy of the selected item or an empty list when no item was selected
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<sf::String> getSelectedItem() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of rows, which are the root items and the children of expanded items
+        ///
+        /// @return Number of items that can be scrolled into view
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getVisibleItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that were requested from the children provider and are still stored
+        ///
+        /// @return Number of loaded items
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLoadedItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the height of the items
+        ///
+        /// @param itemHeight  The size of a single item, which is also the indentation of every level in the tree
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemHeight(unsigned int itemHeight);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the height of the items
+        ///
+        /// @return Item height
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getItemHeight() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the text size of the items
+        ///
+        /// @param textSize  The character size of the text, or 0 to determine it based on the item height
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTextSize(unsigned int textSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text size of the items
+        ///
+        /// @return The text size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getTextSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the thumb position of the scrollbar
+        ///
+        /// @param value  New value of the scrollbar
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setScrollbarValue(unsigned int value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the thumb position of the scrollbar
+        ///
+        /// @return Value of the scrollbar
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getScrollbarValue() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
+        ///
+        /// @return Is the mouse on top of the widget?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool mouseOnWidget(Vector2f pos) const override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void leftMousePressed(Vector2f pos) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void leftMouseReleased(Vector2f pos) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mouseMoved(Vector2f pos) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool mouseWheelScrolled(float delta, Vector2f pos) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mouseNoLongerOnWidget() override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mouseNoLongerDown() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draw the widget to a render target
+        ///
+        /// @param target Render target to draw to
+        /// @param states Current render states
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves a signal based on its name
+        ///
+        /// @param signalName  Name of the signal
+        ///
+        /// @return Signal that corresponds to the name
+        ///
+        /// @throw Exception when the name does not match any signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal& getSignal(std::string signalName) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when one of the properties of the renderer is changed
+        ///
+        /// @param property  Lowercase name of the property that was changed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rendererChanged(const std::string& property) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the widget as a tree node in order to save it to a file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> save(SavingRenderersMap& renderers) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the widget from a tree of nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the size without the borders
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getInnerSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the area in which the items are drawn, relative to the top left of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getItemsArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row below the mouse, or -1 when the mouse isn't on an item. The position is relative to the widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getRowAtPosition(Vector2f pos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of a loaded node based on its hierarchy, or npos when there is no such node
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findNode(const std::vector<sf::String>& hierarchy) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the loaded child with the given text, or npos when there is no such child.
+        // The root nodes are searched when parent is npos.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findChild(std::size_t parent, const sf::String& text) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the hierarchy of a node
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<sf::String> getHierarchy(std::size_t node) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Requests the children of a node, or the root nodes when node is npos, from the children provider
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadChildren(std::size_t node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Releases all loaded descendants of a node, or all nodes when node is npos
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unloadChildren(std::size_t node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the nodes below a node that are shown when the node is expanded to the list, in the order of the rows
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addVisibleDescendants(std::size_t node, std::vector<std::size_t>& rows) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row at which a node is shown, or npos when one of its parents is collapsed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findRow(std::size_t node) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores in each node the row at which it is shown, for all rows starting from the given one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRowIndices(std::size_t firstRow);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Expands or collapses the node in the given row. Only the rows of the node's subtree are inserted or removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void expandRow(std::size_t row);
+        void collapseRow(std::size_t row);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbar after the amount of rows changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbar();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the texts of the items that became visible and drops the ones that are no longer visible.
+        // When rebuild is true, the texts of all visible items are created again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItems(bool rebuild = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the visible texts the color and style that matches the selected and hover state of their item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemColorsAndStyle();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Update on which item the mouse is standing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateHoveringNode(std::size_t node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Update which node is selected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelectedNode(std::size_t node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called every frame with the time passed since the last frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true while a double click is still possible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr clone() const override
+        {
+            return std::make_shared<TreeView>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
+        SignalMenuItem onItemSelect   = {"ItemSelected"};   ///< An item was selected. Optional parameter: text or hierarchy of the item
+        SignalMenuItem onDoubleClick  = {"DoubleClicked"};  ///< An item was double clicked. Optional parameter: text or hierarchy of the item
+        SignalMenuItem onExpand       = {"Expanded"};       ///< An item was expanded. Optional parameter: text or hierarchy of the item
+        SignalMenuItem onCollapse     = {"Collapsed"};      ///< An item was collapsed. Optional parameter: text or hierarchy of the item
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        struct Node
+        {
+            sf::String text;
+            std::size_t parent = npos;
+            unsigned int depth = 0;
+            bool hasChildren = false;
+            bool childrenLoaded = false;
+            bool expanded = false;
+            std::size_t row = npos; // Index in m_rows, or npos when the node isn't shown because a parent is collapsed
+            std::vector<std::size_t> children;
+        };
+
+        // Text of an item that is on the screen
+        struct VisibleItem
+        {
+            std::size_t node = 0;
+            Text text;
+        };
+
+        ChildrenProvider m_childrenProvider;
+
+        // Nodes keep their index while they are loaded, the indices of unloaded nodes are reused
+        std::vector<Node> m_nodes;
+        std::vector<std::size_t> m_freeNodes;
+        std::vector<std::size_t> m_rootNodes;
+
+        // Flattened index of all rows that can be scrolled into view, each element is the index of a node
+        std::vector<std::size_t> m_rows;
+
+        // Only the items that are on the screen have texts, they are stored in the order of the rows
+        std::vector<VisibleItem> m_visibleItems;
+
+        std::size_t m_selectedNode = npos;
+        std::size_t m_hoveringNode = npos;
+
+        unsigned int m_itemHeight = 0;
+        unsigned int m_requestedTextSize = 0;
+        unsigned int m_textSize = 0;
+
+        CopiedSharedPtr<ScrollbarChildWidget> m_scroll;
+
+        // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
+        bool m_possibleDoubleClick = false;
+
+        Sprite m_spriteBackground;
+
+        // Cached renderer properties
+        Borders   m_bordersCached;
+        Borders   m_paddingCached;
+        Color     m_borderColorCached;
+        Color     m_backgroundColorCached;
+        Color     m_backgroundColorHoverCached;
+        Color     m_selectedBackgroundColorCached;
+        Color     m_selectedBackgroundColorHoverCached;
+        Color     m_textColorCached;
+        Color     m_textColorHoverCached;
+        Color     m_selectedTextColorCached;
+        Color     m_selectedTextColorHoverCached;
+        TextStyle m_textStyleCached;
+        TextStyle m_selectedTextStyleCached;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TREE_VIEW_HPP
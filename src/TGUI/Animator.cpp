@@ -0,0 +1,516 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Animator.hpp>
+#include <TGUI/Widget.hpp>
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        float easeBounceOut(float t)
+        {
+            if (t < 1 / 2.75f)
+                return 7.5625f * t * t;
+            else if (t < 2 / 2.75f)
+            {
+                t -= 1.5f / 2.75f;
+                return 7.5625f * t * t + 0.75f;
+            }
+            else if (t < 2.5f / 2.75f)
+            {
+                t -= 2.25f / 2.75f;
+                return 7.5625f * t * t + 0.9375f;
+            }
+            else
+            {
+                t -= 2.625f / 2.75f;
+                return 7.5625f * t * t + 0.984375f;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Animator::ease(Easing easing, float t)
+    {
+        const float pi = 3.14159265358979f;
+
+        switch (easing)
+        {
+        case Easing::Linear:
+            return t;
+        case Easing::QuadIn:
+            return t * t;
+        case Easing::QuadOut:
+            return t * (2 - t);
+        case Easing::QuadInOut:
+            return (t < 0.5f) ? (2 * t * t) : (-1 + (4 - 2 * t) * t);
+        case Easing::CubicIn:
+            return t * t * t;
+        case Easing::CubicOut:
+            return 1 + (t - 1) * (t - 1) * (t - 1);
+        case Easing::CubicInOut:
+            return (t < 0.5f) ? (4 * t * t * t) : (1 + 4 * (t - 1) * (t - 1) * (t - 1));
+        case Easing::SineIn:
+            return 1 - std::cos(t * pi / 2);
+        case Easing::SineOut:
+            return std::sin(t * pi / 2);
+        case Easing::SineInOut:
+            return (1 - std::cos(t * pi)) / 2;
+        case Easing::BackOut:
+        {
+            const float overshoot = 1.70158f;
+            return 1 + (overshoot + 1) * (t - 1) * (t - 1) * (t - 1) + overshoot * (t - 1) * (t - 1);
+        }
+        case Easing::BounceOut:
+            return easeBounceOut(t);
+        }
+
+        return t;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Animator::Id Animator::moveTo(const std::shared_ptr<Widget>& widget, Vector2f position, sf::Time duration, Easing easing)
+    {
+        Tween& tween = addTween(Target::Position, duration, easing);
+        tween.widget = widget;
+        tween.to[0] = position.x;
+        tween.to[1] = position.y;
+        return tween.id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Animator::Id Animator::resizeTo(const std::shared_ptr<Widget>& widget, Vector2f size, sf::Time duration, Easing easing)
+    {
+        Tween& tween = addTween(Target::Size, duration, easing);
+        tween.widget = widget;
+        tween.to[0] = size.x;
+        tween.to[1] = size.y;
+        return tween.id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Animator::Id Animator::fadeTo(const std::shared_ptr<Widget>& widget, float opacity, sf::Time duration, Easing easing)
+    {
+        Tween& tween = addTween(Target::Opacity, duration, easing);
+        tween.widget = widget;
+        tween.to[0] = opacity;
+        return tween.id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Animator::Id Animator::animateColor(Color from, Color to, sf::Time duration, std::function<void(Color)> setter, Easing easing)
+    {
+        Tween& tween = addTween(Target::Color, duration, easing);
+        tween.from[0] = from.getRed();
+        tween.from[1] = from.getGreen();
+        tween.from[2] = from.getBlue();
+        tween.from[3] = from.getAlpha();
+        tween.to[0] = to.getRed();
+        tween.to[1] = to.getGreen();
+        tween.to[2] = to.getBlue();
+        tween.to[3] = to.getAlpha();
+        tween.colorSetter = std::move(setter);
+        return tween.id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Animator::Id Animator::animateFloat(float from, float to, sf::Time duration, std::function<void(float)> setter, Easing easing)
+    {
+        Tween& tween = addTween(Target::Float, duration, easing);
+        tween.from[0] = from;
+        tween.to[0] = to;
+        tween.floatSetter = std::move(setter);
+        return tween.id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Animator::Id Animator::wait(sf::Time duration)
+    {
+        return addTween(Target::None, duration, Easing::Linear).id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Animator::Id Animator::sequence(const std::vector<Id>& ids)
+    {
+        return addGroup(ids, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Animator::Id Animator::parallel(const std::vector<Id>& ids)
+    {
+        return addGroup(ids, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Animator::setFinishedCallback(Id id, std::function<void()> callback)
+    {
+        const auto it = m_nodes.find(id);
+        if (it != m_nodes.end())
+            it->second.finishedCallback = std::move(callback);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Animator::stop(Id id, bool jumpToEnd)
+    {
+        if (m_nodes.find(id) == m_nodes.end())
+            return;
+
+        for (auto& tween : m_tweens)
+        {
+            if (tween.finished || !isPartOf(tween.id, id))
+                continue;
+
+            if (jumpToEnd && (tween.started || start(tween)))
+                apply(tween, 1);
+
+            tween.finished = true;
+        }
+
+        applyPendingChanges();
+        removeFinishedTweens();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Animator::clear()
+    {
+        m_tweens.clear();
+        m_nodes.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Animator::isRunning(Id id) const
+    {
+        return m_nodes.find(id) != m_nodes.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Animator::getTweenCount() const
+    {
+        return m_tweens.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Animator::update(sf::Time elapsedTime)
+    {
+        if (m_tweens.empty())
+            return;
+
+        for (auto& tween : m_tweens)
+        {
+            if (tween.finished)
+                continue;
+
+            if (!tween.started)
+            {
+                if (!isReady(tween.id))
+                    continue;
+
+                if (!start(tween))
+                {
+                    tween.finished = true;
+                    continue;
+                }
+            }
+
+            tween.elapsed += elapsedTime;
+            if (tween.elapsed >= tween.duration)
+            {
+                tween.finished = true;
+                apply(tween, 1);
+            }
+            else
+                apply(tween, tween.elapsed.asSeconds() / tween.duration.asSeconds());
+        }
+
+        applyPendingChanges();
+        removeFinishedTweens();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Animator::Tween& Animator::addTween(Target target, sf::Time duration, Easing easing)
+    {
+        Tween tween;
+        tween.id = ++m_lastId;
+        tween.target = target;
+        tween.easing = easing;
+        tween.duration = duration;
+        m_tweens.push_back(std::move(tween));
+
+        m_nodes[m_lastId] = Node{};
+        return m_tweens.back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Animator::Id Animator::addGroup(const std::vector<Id>& ids, bool sequential)
+    {
+        const Id groupId = ++m_lastId;
+
+        Node group;
+        group.remaining = 0;
+
+        Id previousId = 0;
+        for (const Id id : ids)
+        {
+            const auto it = m_nodes.find(id);
+            if (it == m_nodes.end())
+                continue;
+
+            it->second.parent = groupId;
+            if (sequential)
+                it->second.waitFor = previousId;
+
+            previousId = id;
+            ++group.remaining;
+        }
+
+        // A group without unfinished members is finished from the start
+        if (group.remaining > 0)
+            m_nodes[groupId] = std::move(group);
+
+        return groupId;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Animator::isReady(Id id) const
+    {
+        while (id != 0)
+        {
+            const Node& node = m_nodes.at(id);
+            if ((node.waitFor != 0) && (m_nodes.find(node.waitFor) != m_nodes.end()))
+                return false;
+
+            id = node.parent;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Animator::isPartOf(Id id, Id group) const
+    {
+        while (id != 0)
+        {
+            if (id == group)
+                return true;
+
+            id = m_nodes.at(id).parent;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Animator::start(Tween& tween)
+    {
+        tween.started = true;
+
+        switch (tween.target)
+        {
+        case Target::Position:
+        case Target::Size:
+        case Target::Opacity:
+        {
+            const auto widget = tween.widget.lock();
+            if (!widget)
+                return false;
+
+            if (tween.target == Target::Position)
+            {
+                tween.from[0] = widget->getPosition().x;
+                tween.from[1] = widget->getPosition().y;
+            }
+            else if (tween.target == Target::Size)
+            {
+                tween.from[0] = widget->getSize().x;
+                tween.from[1] = widget->getSize().y;
+            }
+            else
+                tween.from[0] = widget->getInheritedOpacity();
+
+            break;
+        }
+        case Target::None:
+        case Target::Color:
+        case Target::Float:
+            break;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Animator::apply(Tween& tween, float progress)
+    {
+        const float t = ease(tween.easing, progress);
+        const auto lerp = [&tween,t](unsigned int i){ return tween.from[i] + (t * (tween.to[i] - tween.from[i])); };
+
+        switch (tween.target)
+        {
+        case Target::None:
+            break;
+
+        case Target::Color:
+        {
+            const auto channel = [&lerp](unsigned int i){ return static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, std::round(lerp(i))))); };
+            if (tween.colorSetter)
+                tween.colorSetter({channel(0), channel(1), channel(2), channel(3)});
+            break;
+        }
+        case Target::Float:
+        {
+            if (tween.floatSetter)
+                tween.floatSetter(lerp(0));
+            break;
+        }
+        case Target::Position:
+        case Target::Size:
+        case Target::Opacity:
+        {
+            auto widget = tween.widget.lock();
+            if (!widget)
+            {
+                tween.finished = true;
+                break;
+            }
+
+            // Changes to the same widget are merged so that the widget only recalculates its layout once
+            const auto it = m_pendingChangeIndices.find(widget.get());
+            if (it == m_pendingChangeIndices.end())
+            {
+                m_pendingChangeIndices[widget.get()] = m_pendingChanges.size();
+                m_pendingChanges.emplace_back();
+                m_pendingChanges.back().widget = std::move(widget);
+            }
+
+            PendingChange& change = (it == m_pendingChangeIndices.end()) ? m_pendingChanges.back() : m_pendingChanges[it->second];
+            if (tween.target == Target::Position)
+            {
+                change.positionChanged = true;
+                change.position = {lerp(0), lerp(1)};
+            }
+            else if (tween.target == Target::Size)
+            {
+                change.sizeChanged = true;
+                change.size = {lerp(0), lerp(1)};
+            }
+            else
+            {
+                change.opacityChanged = true;
+                change.opacity = std::max(0.f, std::min(1.f, lerp(0)));
+            }
+            break;
+        }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Animator::applyPendingChanges()
+    {
+        for (auto& change : m_pendingChanges)
+        {
+            if (change.positionChanged)
+                change.widget->setPosition(change.position);
+            if (change.sizeChanged)
+                change.widget->setSize(change.size);
+            if (change.opacityChanged)
+                change.widget->setInheritedOpacity(change.opacity);
+        }
+
+        // The vectors keep their capacity so that the next frame doesn't have to allocate again
+        m_pendingChanges.clear();
+        m_pendingChangeIndices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Animator::removeFinishedTweens()
+    {
+        std::vector<std::function<void()>> callbacks;
+        for (const auto& tween : m_tweens)
+        {
+            if (!tween.finished)
+                continue;
+
+            // Finishing the last member of a group also finishes the group
+            Id id = tween.id;
+            while (id != 0)
+            {
+                const auto it = m_nodes.find(id);
+                if (it == m_nodes.end())
+                    break;
+
+                if (it->second.finishedCallback)
+                    callbacks.push_back(std::move(it->second.finishedCallback));
+
+                const Id parent = it->second.parent;
+                m_nodes.erase(it);
+
+                const auto parentIt = m_nodes.find(parent);
+                if ((parentIt == m_nodes.end()) || (--parentIt->second.remaining > 0))
+                    break;
+
+                id = parent;
+            }
+        }
+
+        m_tweens.erase(std::remove_if(m_tweens.begin(), m_tweens.end(), [](const Tween& tween){ return tween.finished; }), m_tweens.end());
+
+        // The callbacks are called last, as they may create or stop tweens
+        for (const auto& callback : callbacks)
+            callback();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
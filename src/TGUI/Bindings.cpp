@@ -0,0 +1,127 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Bindings.hpp>
+#include <TGUI/Widget.hpp>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::unbind(const std::shared_ptr<Widget>& widget)
+    {
+        const Widget* widgetPtr = widget.get();
+        if (m_updating)
+            m_unboundDuringUpdate.push_back(widgetPtr);
+
+        m_bindings.erase(std::remove_if(m_bindings.begin(), m_bindings.end(),
+                                        [widgetPtr](const Binding& binding){ return binding.widget == widgetPtr; }),
+                         m_bindings.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::unbindAll()
+    {
+        if (m_updating)
+            m_unbindAllDuringUpdate = true;
+
+        m_bindings.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Bindings::getBindingCount() const
+    {
+        return m_bindings.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Bindings::update()
+    {
+        // A setter may add or remove bindings, so the bindings are moved out of the list while they are being updated
+        std::vector<Binding> bindings;
+        bindings.swap(m_bindings);
+        m_updating = true;
+
+        std::size_t updateCount = 0;
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < bindings.size(); ++i)
+        {
+            if (m_unbindAllDuringUpdate)
+                break;
+
+            if (std::find(m_unboundDuringUpdate.begin(), m_unboundDuringUpdate.end(), bindings[i].widget) != m_unboundDuringUpdate.end())
+                continue;
+
+            const UpdateResult result = bindings[i].update();
+            if (result == UpdateResult::Expired)
+                continue;
+
+            if (result == UpdateResult::Updated)
+                ++updateCount;
+
+            if (kept != i)
+                bindings[kept] = std::move(bindings[i]);
+            ++kept;
+        }
+        bindings.resize(kept);
+
+        // Remove the bindings that were unbound after they were already updated
+        if (m_unbindAllDuringUpdate)
+            bindings.clear();
+        for (const Widget* widget : m_unboundDuringUpdate)
+        {
+            bindings.erase(std::remove_if(bindings.begin(), bindings.end(),
+                                          [widget](const Binding& binding){ return binding.widget == widget; }),
+                           bindings.end());
+        }
+
+        m_updating = false;
+        m_unbindAllDuringUpdate = false;
+        m_unboundDuringUpdate.clear();
+
+        // Bindings that were added by the setters come after the existing ones
+        bindings.insert(bindings.end(), std::make_move_iterator(m_bindings.begin()), std::make_move_iterator(m_bindings.end()));
+        m_bindings.swap(bindings);
+        return updateCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Bindings::addBinding(const Widget* widget, std::function<UpdateResult()> update)
+    {
+        m_bindings.push_back({widget, std::move(update)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
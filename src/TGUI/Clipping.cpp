@@ -24,65 +24,89 @@
 
 
 #include <TGUI/Clipping.hpp>
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    Clipping* Clipping::m_currentClipping = nullptr;
     sf::View Clipping::m_originalView;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Clipping::Clipping(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f topLeft, Vector2f size) :
-        m_target {target},
-        m_oldView{target.getView()}
+    namespace
     {
-        Vector2f bottomRight = Vector2f(states.transform.transformPoint(topLeft + size));
-        topLeft = Vector2f(states.transform.transformPoint(topLeft));
+        // Converts a rectangle in the coordinates of the gui view to pixels of the render target
+        sf::IntRect mapGuiRectToPixels(const sf::View& guiView, const sf::IntRect& guiViewport, const sf::FloatRect& rect)
+        {
+            const float viewLeft = guiView.getCenter().x - (guiView.getSize().x / 2.f);
+            const float viewTop = guiView.getCenter().y - (guiView.getSize().y / 2.f);
+            const float scaleX = guiViewport.width / guiView.getSize().x;
+            const float scaleY = guiViewport.height / guiView.getSize().y;
+
+            const int left = guiViewport.left + static_cast<int>(std::round((rect.left - viewLeft) * scaleX));
+            const int top = guiViewport.top + static_cast<int>(std::round((rect.top - viewTop) * scaleY));
+            const int right = guiViewport.left + static_cast<int>(std::round((rect.left + rect.width - viewLeft) * scaleX));
+            const int bottom = guiViewport.top + static_cast<int>(std::round((rect.top + rect.height - viewTop) * scaleY));
+            return {left, top, right - left, bottom - top};
+        }
 
-        Vector2f viewTopLeft = topLeft;
-        size = bottomRight - topLeft;
+        // Converts a rectangle in pixels of the render target to the coordinates of the gui view
+        sf::FloatRect mapPixelsToGuiRect(const sf::View& guiView, const sf::IntRect& guiViewport, const sf::IntRect& rect)
+        {
+            if ((guiViewport.width <= 0) || (guiViewport.height <= 0))
+                return {};
+
+            const float viewLeft = guiView.getCenter().x - (guiView.getSize().x / 2.f);
+            const float viewTop = guiView.getCenter().y - (guiView.getSize().y / 2.f);
+            const float scaleX = guiView.getSize().x / guiViewport.width;
+            const float scaleY = guiView.getSize().y / guiViewport.height;
+
+            return {viewLeft + (rect.left - guiViewport.left) * scaleX,
+                    viewTop + (rect.top - guiViewport.top) * scaleY,
+                    rect.width * scaleX,
+                    rect.height * scaleY};
+        }
+    }
 
-        topLeft.x -= m_originalView.getCenter().x - (m_originalView.getSize().x / 2.f);
-        topLeft.y -= m_originalView.getCenter().y - (m_originalView.getSize().y / 2.f);
-        bottomRight.x -= m_originalView.getCenter().x - (m_originalView.getSize().x / 2.f);
-        bottomRight.y -= m_originalView.getCenter().y - (m_originalView.getSize().y / 2.f);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        topLeft.x *= m_originalView.getViewport().width / m_originalView.getSize().x;
-        topLeft.y *= m_originalView.getViewport().height / m_originalView.getSize().y;
-        size.x *= m_originalView.getViewport().width / m_originalView.getSize().x;
-        size.y *= m_originalView.getViewport().height / m_originalView.getSize().y;
+    Clipping::Clipping(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f topLeft, Vector2f size) :
+        m_target  {target},
+        m_parent  {m_currentClipping},
+        m_clipRect{}
+    {
+        const sf::IntRect guiViewport = target.getViewport(m_originalView);
 
-        topLeft.x += m_originalView.getViewport().left;
-        topLeft.y += m_originalView.getViewport().top;
+        // A clipping object that was created while drawing to a different target doesn't restrict this one
+        const bool hasParent = (m_parent != nullptr) && (&m_parent->m_target == &target);
+        const sf::IntRect parentRect = hasParent ? m_parent->m_clipRect : guiViewport;
 
-        if (topLeft.x < m_oldView.getViewport().left)
-        {
-            size.x -= m_oldView.getViewport().left - topLeft.x;
-            viewTopLeft.x += (m_oldView.getViewport().left - topLeft.x) * (m_originalView.getSize().x / m_originalView.getViewport().width);
-            topLeft.x = m_oldView.getViewport().left;
-        }
-        if (topLeft.y < m_oldView.getViewport().top)
+        if ((size.x > 0) && (size.y > 0))
         {
-            size.y -= m_oldView.getViewport().top - topLeft.y;
-            viewTopLeft.y += (m_oldView.getViewport().top - topLeft.y) * (m_originalView.getSize().y / m_originalView.getViewport().height);
-            topLeft.y = m_oldView.getViewport().top;
+            const sf::IntRect rect = mapGuiRectToPixels(m_originalView, guiViewport, states.transform.transformRect({topLeft, size}));
+            if (!rect.intersects(parentRect, m_clipRect))
+                m_clipRect = {};
         }
 
-        if (size.x > m_oldView.getViewport().left + m_oldView.getViewport().width - topLeft.x)
-            size.x = m_oldView.getViewport().left + m_oldView.getViewport().width - topLeft.x;
-        if (size.y > m_oldView.getViewport().top + m_oldView.getViewport().height - topLeft.y)
-            size.y = m_oldView.getViewport().top + m_oldView.getViewport().height - topLeft.y;
+        m_currentClipping = this;
+
+        // Nothing has to change when the parent was already clipping to exactly the same area
+        if (hasParent && (m_clipRect == parentRect))
+            return;
+
+        m_oldView = target.getView();
+        m_viewChanged = true;
 
-        if ((size.x >= 0) && (size.y >= 0))
+        if ((m_clipRect.width > 0) && (m_clipRect.height > 0))
         {
-            sf::View view{{std::round(viewTopLeft.x),
-                           std::round(viewTopLeft.y),
-                           std::round(size.x * m_originalView.getSize().x / m_originalView.getViewport().width),
-                           std::round(size.y * m_originalView.getSize().y / m_originalView.getViewport().height)}};
+            const sf::Vector2f targetSize{target.getSize()};
 
-            view.setViewport({topLeft.x, topLeft.y, size.x, size.y});
+            sf::View view{mapPixelsToGuiRect(m_originalView, guiViewport, m_clipRect)};
+            view.setViewport({m_clipRect.left / targetSize.x, m_clipRect.top / targetSize.y,
+                              m_clipRect.width / targetSize.x, m_clipRect.height / targetSize.y});
             target.setView(view);
         }
         else // The clipping area lies outside the viewport
@@ -97,7 +121,32 @@ namespace tgui
 
     Clipping::~Clipping()
     {
-        m_target.setView(m_oldView);
+        m_currentClipping = m_parent;
+
+        if (m_viewChanged)
+            m_target.setView(m_oldView);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::IntRect Clipping::getClipRect(const sf::RenderTarget& target)
+    {
+        if (m_currentClipping && (&m_currentClipping->m_target == &target))
+            return m_currentClipping->m_clipRect;
+        else
+            return target.getViewport(m_originalView);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect Clipping::getVisibleArea(const sf::RenderTarget& target, const sf::RenderStates& states)
+    {
+        const sf::IntRect clipRect = getClipRect(target);
+        if ((clipRect.width <= 0) || (clipRect.height <= 0))
+            return {};
+
+        const sf::FloatRect area = mapPixelsToGuiRect(m_originalView, target.getViewport(m_originalView), clipRect);
+        return states.transform.getInverse().transformRect(area);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
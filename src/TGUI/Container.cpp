@@ -27,9 +27,13 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/to_string.hpp>
 
 #include <cassert>
+#include <cstdio>
 #include <fstream>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -41,55 +45,69 @@ namespace tgui
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void getAllRenderers(std::map<RendererData*, std::vector<const Widget*>>& renderers, const Container* container)
+        // Lists the renderer of every widget in the order in which the widgets are saved and counts how often each renderer is used
+        void getAllRenderers(std::vector<std::pair<const Widget*, const RendererData*>>& widgetRenderers,
+                             std::unordered_map<const RendererData*, std::size_t>& rendererUseCount, const Container* container)
         {
             for (const auto& child : container->getWidgets())
             {
-                renderers[child->getSharedRenderer()->getData().get()].push_back(child.get());
+                widgetRenderers.emplace_back(child.get(), child->getSharedRenderer()->getData().get());
+                ++rendererUseCount[widgetRenderers.back().second];
 
                 if (child->getToolTip())
-                    renderers[child->getToolTip()->getSharedRenderer()->getData().get()].push_back(child->getToolTip().get());
+                {
+                    widgetRenderers.emplace_back(child->getToolTip().get(), child->getToolTip()->getSharedRenderer()->getData().get());
+                    ++rendererUseCount[widgetRenderers.back().second];
+                }
 
-                Container* childContainer = dynamic_cast<Container*>(child.get());
-                if (childContainer)
-                    getAllRenderers(renderers, childContainer);
+                if (child->isContainer())
+                    getAllRenderers(widgetRenderers, rendererUseCount, static_cast<const Container*>(child.get()));
             }
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::unique_ptr<DataIO::Node> saveRenderer(RendererData* renderer, const std::string& name)
+        std::unique_ptr<DataIO::Node> saveRenderer(const RendererData& renderer, const std::string& name)
         {
             auto node = std::make_unique<DataIO::Node>();
             node->name = name;
-            for (const auto& pair : renderer->propertyValuePairs)
+            for (const auto& pair : renderer.propertyValuePairs)
             {
-                // Skip "font = null"
-                if (pair.first == "font" && ObjectConverter{pair.second}.getString() == "null")
-                    continue;
-
+                // Nested renderers are saved directly instead of serializing them to a string and parsing that string again
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString()};
-                    auto rendererRootNode = DataIO::parse(ss);
+                    node->children.push_back(saveRenderer(*ObjectConverter{pair.second}.getRenderer(), pair.first));
+                    continue;
+                }
 
-                    // If there are braces around the renderer string, then the child node is the one we need
-                    if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
-                        rendererRootNode = std::move(rendererRootNode->children[0]);
+                // Skip "font = null"
+                const sf::String value = ObjectConverter{pair.second}.getString();
+                if (pair.first == "font" && value == "null")
+                    continue;
 
-                    rendererRootNode->name = pair.first;
-                    node->children.push_back(std::move(rendererRootNode));
-                }
-                else
-                    node->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(ObjectConverter{pair.second}.getString());
+                node->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(value);
             }
 
             return node;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns a filename next to the given file that doesn't exist yet, so that saving never overwrites an unrelated file
+        std::string getUnusedTemporaryFilename(const std::string& filename)
+        {
+            std::string temporaryFilename = filename + ".tmp";
+            for (unsigned int i = 1; std::ifstream{temporaryFilename}.is_open(); ++i)
+                temporaryFilename = filename + ".tmp" + to_string(i);
+
+            return temporaryFilename;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
+    std::size_t Container::m_hitTestCount = 0;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container()
@@ -102,9 +120,7 @@ namespace tgui
     Container::Container(const Container& other) :
         Widget{other}
     {
-        // Copy all the widgets
-        for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
-            add(other.m_widgets[i]->clone(), other.m_widgetNames[i]);
+        addClonedWidgets(other);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -115,6 +131,7 @@ namespace tgui
         m_widgetNames         {std::move(other.m_widgetNames)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
+        m_updatedWidgets      {std::move(other.m_updatedWidgets)},
         m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
     {
         for (auto& widget : m_widgets)
@@ -150,11 +167,7 @@ namespace tgui
             Container::removeAllWidgets();
 
             // Copy all the widgets
-            for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
-            {
-                // Don't allow the 'add' function of a derived class to be called, since its members are not copied yet
-                Container::add(right.m_widgets[i]->clone(), right.m_widgetNames[i]);
-            }
+            addClonedWidgets(right);
         }
 
         return *this;
@@ -172,6 +185,7 @@ namespace tgui
             m_widgetNames          = std::move(right.m_widgetNames);
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
+            m_updatedWidgets       = std::move(right.m_updatedWidgets);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
 
             for (auto& widget : m_widgets)
@@ -190,6 +204,7 @@ namespace tgui
         assert(widgetPtr != nullptr);
 
         widgetPtr->setParent(this);
+        widgetPtr->m_indexInParent = m_widgets.size();
         m_widgets.push_back(widgetPtr);
         m_widgetNames.push_back(widgetName);
 
@@ -198,6 +213,9 @@ namespace tgui
 
         if (m_opacityCached < 1)
             widgetPtr->setInheritedOpacity(m_opacityCached);
+
+        if (widgetPtr->isUpdateRequired())
+            childUpdateRequiredChanged(*widgetPtr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,33 +245,40 @@ namespace tgui
 
     bool Container::remove(const Widget::Ptr& widget)
     {
-        // Loop through every widget
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        if (!widget)
+            return false;
+
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index == m_widgets.size())
+            return false;
+
+        if (m_widgetBelowMouse == widget)
         {
-            // Check if the pointer matches
-            if (m_widgets[i] == widget)
-            {
-                if (m_widgetBelowMouse == widget)
-                {
-                    widget->mouseNoLongerOnWidget();
-                    m_widgetBelowMouse = nullptr;
-                }
+            widget->mouseNoLongerOnWidget();
+            m_widgetBelowMouse = nullptr;
+        }
 
-                if (widget == m_focusedWidget)
-                {
-                    m_focusedWidget = nullptr;
-                    widget->setFocused(false);
-                }
+        if (widget == m_focusedWidget)
+        {
+            m_focusedWidget = nullptr;
+            widget->setFocused(false);
+        }
 
-                // Remove the widget
-                widget->setParent(nullptr);
-                m_widgets.erase(m_widgets.begin() + i);
-                m_widgetNames.erase(m_widgetNames.begin() + i);
-                return true;
-            }
+        // Remove the widget
+        widget->setParent(nullptr);
+        m_widgets.erase(m_widgets.begin() + index);
+        m_widgetNames.erase(m_widgetNames.begin() + index);
+        updateWidgetIndices(index);
+
+        const auto updatedIt = std::find(m_updatedWidgets.begin(), m_updatedWidgets.end(), widget);
+        if (updatedIt != m_updatedWidgets.end())
+        {
+            m_updatedWidgets.erase(updatedIt);
+            if (!isUpdateRequired())
+                updateRequiredChanged();
         }
 
-        return false;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,35 +293,155 @@ namespace tgui
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
+
+        if (!m_updatedWidgets.empty())
+        {
+            m_updatedWidgets.clear();
+            if (!isUpdateRequired())
+                updateRequiredChanged();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool Container::setWidgetName(const Widget::Ptr& widget, const std::string& name)
+    void Container::addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames)
     {
+        if (!widgetNames.empty() && (widgetNames.size() != widgets.size()))
+            throw Exception{"The amount of widget names passed to addWidgets doesn't match the amount of widgets."};
+
+        if (widgets.empty())
+            return;
+
+        m_widgets.reserve(m_widgets.size() + widgets.size());
+        m_widgetNames.reserve(m_widgetNames.size() + widgets.size());
+
+        m_changingWidgetsInBatch = true;
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+            add(widgets[i], widgetNames.empty() ? sf::String{} : widgetNames[i]);
+
+        m_changingWidgetsInBatch = false;
+        widgetsChangedInBatch();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::removeWidgets(const std::function<bool(const Widget::Ptr&)>& predicate)
+    {
+        // Move the widgets that are kept to the front and take out the ones that have to be removed
+        std::vector<Widget::Ptr> removedWidgets;
+        std::size_t newSize = 0;
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (m_widgets[i] == widget)
+            if (predicate(m_widgets[i]))
             {
-                m_widgetNames[i] = name;
-                return true;
+                removedWidgets.push_back(std::move(m_widgets[i]));
+                continue;
+            }
+
+            if (newSize != i)
+            {
+                m_widgets[newSize] = std::move(m_widgets[i]);
+                m_widgetNames[newSize] = std::move(m_widgetNames[i]);
             }
+
+            m_widgets[newSize]->m_indexInParent = newSize;
+            ++newSize;
         }
 
-        return false;
+        if (removedWidgets.empty())
+            return 0;
+
+        m_widgets.erase(m_widgets.begin() + newSize, m_widgets.end());
+        m_widgetNames.erase(m_widgetNames.begin() + newSize, m_widgetNames.end());
+
+        const bool wasUpdateRequired = isUpdateRequired();
+        for (const auto& widget : removedWidgets)
+        {
+            if (m_widgetBelowMouse == widget)
+            {
+                widget->mouseNoLongerOnWidget();
+                m_widgetBelowMouse = nullptr;
+            }
+
+            if (widget == m_focusedWidget)
+            {
+                m_focusedWidget = nullptr;
+                widget->setFocused(false);
+            }
+
+            widget->setParent(nullptr);
+        }
+
+        m_updatedWidgets.erase(std::remove_if(m_updatedWidgets.begin(), m_updatedWidgets.end(),
+                                              [this](const Widget::Ptr& widget){ return widget->getParent() != this; }),
+                               m_updatedWidgets.end());
+
+        if (wasUpdateRequired && !isUpdateRequired())
+            updateRequiredChanged();
+
+        widgetsChangedInBatch();
+        return removedWidgets.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::string Container::getWidgetName(const Widget::ConstPtr& widget) const
+    bool Container::reorder(const std::vector<Widget::Ptr>& widgets)
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        if (widgets.size() != m_widgets.size())
+            return false;
+
+        // Find the old position of every widget and make sure that each child occurs exactly once
+        std::vector<std::size_t> oldIndices(widgets.size());
+        std::vector<bool> used(widgets.size(), false);
+        for (std::size_t i = 0; i < widgets.size(); ++i)
         {
-            if (m_widgets[i] == widget)
-                return m_widgetNames[i];
+            const std::size_t index = widgets[i] ? findWidgetIndex(widgets[i].get()) : m_widgets.size();
+            if ((index == m_widgets.size()) || used[index])
+                return false;
+
+            used[index] = true;
+            oldIndices[i] = index;
         }
 
-        return "";
+        std::vector<sf::String> widgetNames(widgets.size());
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+            widgetNames[i] = std::move(m_widgetNames[oldIndices[i]]);
+
+        m_widgets = widgets;
+        m_widgetNames = std::move(widgetNames);
+        updateWidgetIndices(0);
+
+        widgetsChangedInBatch();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::setWidgetName(const Widget::Ptr& widget, const std::string& name)
+    {
+        if (!widget)
+            return false;
+
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index == m_widgets.size())
+            return false;
+
+        m_widgetNames[index] = name;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Container::getWidgetName(const Widget::ConstPtr& widget) const
+    {
+        if (!widget)
+            return "";
+
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index == m_widgets.size())
+            return "";
+
+        return m_widgetNames[index];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -328,14 +473,35 @@ namespace tgui
 
     void Container::saveWidgetsToFile(const std::string& filename)
     {
-        std::stringstream stream;
-        saveWidgetsToStream(stream);
+        // The widgets are written to a temporary file first, so that the existing file is kept when saving fails halfway
+        const std::string temporaryFilename = getUnusedTemporaryFilename(filename);
+        {
+            std::ofstream out{temporaryFilename};
+            if (!out.is_open())
+                throw Exception{"Failed to open '" + temporaryFilename + "' for saving the widgets to it."};
 
-        std::ofstream out{filename};
-        if (!out.is_open())
-            throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
+            try
+            {
+                saveWidgetsToStream(out);
+                out.close();
+                if (out.fail())
+                    throw Exception{"Failed to write the widgets to '" + temporaryFilename + "'."};
+            }
+            catch (...)
+            {
+                out.close();
+                std::remove(temporaryFilename.c_str());
+                throw;
+            }
+        }
 
-        out << stream.rdbuf();
+        // Renaming doesn't replace an existing file on all platforms, so the old file is only removed when the first attempt fails
+        if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+        {
+            std::remove(filename.c_str());
+            if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+                throw Exception{"Failed to rename '" + temporaryFilename + "' to '" + filename + "' after saving the widgets."};
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -349,6 +515,74 @@ namespace tgui
         if (rootNode->propertyValuePairs.size() != 0)
             Widget::load(rootNode, {});
 
+        DetachedWidgets detachedWidgets = createWidgetsFromNode(rootNode);
+        for (std::size_t i = 0; i < detachedWidgets.widgets.size(); ++i)
+            add(detachedWidgets.widgets[i], detachedWidgets.widgetNames[i]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromStream(std::stringstream&& stream)
+    {
+        loadWidgetsFromStream(stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Container::DetachedWidgets Container::loadDetachedWidgetsFromFile(const std::string& filename)
+    {
+        std::ifstream in{filename};
+        if (!in.is_open())
+            throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
+
+        std::stringstream stream;
+        stream << in.rdbuf();
+        return loadDetachedWidgetsFromStream(stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Container::DetachedWidgets Container::loadDetachedWidgetsFromStream(std::stringstream& stream)
+    {
+        auto rootNode = DataIO::parse(stream);
+
+        // Textures that are loaded on this thread only load their image, the texture is created in addDetachedWidgets
+        std::vector<std::shared_ptr<TextureData>> pendingTextures;
+        TextureManager::setDeferredUploadList(&pendingTextures);
+
+        DetachedWidgets detachedWidgets;
+        try
+        {
+            detachedWidgets = createWidgetsFromNode(rootNode);
+        }
+        catch (...)
+        {
+            TextureManager::setDeferredUploadList(nullptr);
+            throw;
+        }
+
+        TextureManager::setDeferredUploadList(nullptr);
+        detachedWidgets.pendingTextures = std::move(pendingTextures);
+        return detachedWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addDetachedWidgets(DetachedWidgets&& detachedWidgets)
+    {
+        TextureManager::uploadDeferredTextures(detachedWidgets.pendingTextures);
+
+        for (std::size_t i = 0; i < detachedWidgets.widgets.size(); ++i)
+            add(detachedWidgets.widgets[i], detachedWidgets.widgetNames[i]);
+
+        detachedWidgets = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Container::DetachedWidgets Container::createWidgetsFromNode(const std::unique_ptr<DataIO::Node>& rootNode)
+    {
+        DetachedWidgets detachedWidgets;
         std::map<std::string, std::shared_ptr<RendererData>> availableRenderers;
         for (const auto& node : rootNode->children)
         {
@@ -371,97 +605,94 @@ namespace tgui
                 {
                     Widget::Ptr widget = constructor();
                     widget->load(node, availableRenderers);
-                    add(widget, objectName);
+                    detachedWidgets.widgets.push_back(widget);
+                    detachedWidgets.widgetNames.push_back(objectName);
                 }
                 else
                     throw Exception{"No construct function exists for widget type '" + widgetType + "'."};
             }
         }
-    }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void Container::loadWidgetsFromStream(std::stringstream&& stream)
-    {
-        loadWidgetsFromStream(stream);
+        return detachedWidgets;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::saveWidgetsToStream(std::stringstream& stream) const
+    void Container::saveWidgetsToStream(std::ostream& stream) const
     {
-        auto node = std::make_unique<DataIO::Node>();
-
-        std::map<RendererData*, std::vector<const Widget*>> renderers;
-        getAllRenderers(renderers, this);
+        std::vector<std::pair<const Widget*, const RendererData*>> widgetRenderers;
+        std::unordered_map<const RendererData*, std::size_t> rendererUseCount;
+        getAllRenderers(widgetRenderers, rendererUseCount, this);
 
-        unsigned int id = 0;
+        bool firstSection = true;
+        std::unordered_map<const RendererData*, std::string> rendererIds;
         SavingRenderersMap renderersMap;
-        for (const auto& renderer : renderers)
+        for (const auto& widgetRenderer : widgetRenderers)
         {
             // The renderer can remain inside the widget if it is not shared, so provide the node to be included inside the widget
-            if (renderer.second.size() == 1)
+            if (rendererUseCount[widgetRenderer.second] == 1)
             {
-                renderersMap[renderer.second[0]] = {saveRenderer(renderer.first, "Renderer"), ""};
+                renderersMap[widgetRenderer.first] = {saveRenderer(*widgetRenderer.second, "Renderer"), ""};
                 continue;
             }
 
-            // When the widget is shared, only provide the id instead of the node itself
-            ++id;
-            const std::string idStr = to_string(id);
-            node->children.push_back(saveRenderer(renderer.first, "Renderer." + idStr));
-            for (const auto& child : renderer.second)
-                renderersMap[child] = std::make_pair(nullptr, idStr); // Did not compile with VS2015 Update 2 when using braces
+            // When the renderer is shared, it is written before the widgets and the widgets only get its id
+            std::string& idStr = rendererIds[widgetRenderer.second];
+            if (idStr.empty())
+            {
+                idStr = to_string(rendererIds.size());
+
+                if (!firstSection)
+                    stream << "\n";
+
+                DataIO::emitSection(saveRenderer(*widgetRenderer.second, "Renderer." + idStr), stream);
+                firstSection = false;
+            }
+
+            renderersMap[widgetRenderer.first] = std::make_pair(nullptr, idStr); // Did not compile with VS2015 Update 2 when using braces
         }
 
+        // Each widget is written as soon as it is saved, the nodes of the different widgets never exist at the same time
         for (const auto& child : getWidgets())
-            node->children.emplace_back(child->save(renderersMap));
+        {
+            if (!firstSection)
+                stream << "\n";
 
-        DataIO::emit(node, stream);
+            DataIO::emitSection(child->save(renderersMap), stream);
+            firstSection = false;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::moveWidgetToFront(const Widget::Ptr& widget)
     {
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] != widget)
-                continue;
+        if (!widget)
+            return;
 
-            // Copy the widget
-            m_widgets.push_back(m_widgets[i]);
-            m_widgetNames.push_back(m_widgetNames[i]);
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index == m_widgets.size())
+            return;
 
-            // Remove the old widget
-            m_widgets.erase(m_widgets.begin() + i);
-            m_widgetNames.erase(m_widgetNames.begin() + i);
-            break;
-        }
+        std::rotate(m_widgets.begin() + index, m_widgets.begin() + index + 1, m_widgets.end());
+        std::rotate(m_widgetNames.begin() + index, m_widgetNames.begin() + index + 1, m_widgetNames.end());
+        updateWidgetIndices(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::moveWidgetToBack(const Widget::Ptr& widget)
     {
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] != widget)
-                continue;
+        if (!widget)
+            return;
 
-            // Copy the widget
-            const Widget::Ptr obj = m_widgets[i];
-            const std::string name = m_widgetNames[i];
-            m_widgets.insert(m_widgets.begin(), obj);
-            m_widgetNames.insert(m_widgetNames.begin(), name);
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index == m_widgets.size())
+            return;
 
-            // Remove the old widget
-            m_widgets.erase(m_widgets.begin() + i + 1);
-            m_widgetNames.erase(m_widgetNames.begin() + i + 1);
-            break;
-        }
+        std::rotate(m_widgets.begin(), m_widgets.begin() + index, m_widgets.begin() + index + 1);
+        std::rotate(m_widgetNames.begin(), m_widgetNames.begin() + index, m_widgetNames.begin() + index + 1);
+        updateWidgetIndices(0);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -576,6 +807,85 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Container::findWidgetIndex(const Widget* widget) const
+    {
+        const std::size_t index = widget->m_indexInParent;
+        if ((index < m_widgets.size()) && (m_widgets[index].get() == widget))
+            return index;
+
+        // The hint is outdated when a derived class changed the order of the widgets without updating the indices
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgets[i].get() == widget)
+                return i;
+        }
+
+        return m_widgets.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateWidgetIndices(std::size_t firstIndex)
+    {
+        for (std::size_t i = firstIndex; i < m_widgets.size(); ++i)
+            m_widgets[i]->m_indexInParent = i;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetsChangedInBatch()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addClonedWidgets(const Container& other)
+    {
+        m_widgets.reserve(m_widgets.size() + other.m_widgets.size());
+        m_widgetNames.reserve(m_widgetNames.size() + other.m_widgetNames.size());
+
+        for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
+        {
+            const auto& original = other.m_widgets[i];
+            const auto widget = original->clone();
+
+            // The clone already uses the same font and opacity as the original, so unlike in 'add' they don't have to be
+            // passed down the entire subtree again. Only the values inherited from this container still have to be copied.
+            widget->m_inheritedFont = original->m_inheritedFont;
+            widget->m_inheritedOpacity = original->m_inheritedOpacity;
+
+            widget->setParent(this);
+            widget->m_indexInParent = m_widgets.size();
+            m_widgets.push_back(widget);
+            m_widgetNames.push_back(other.m_widgetNames[i]);
+
+            if (widget->isUpdateRequired())
+                childUpdateRequiredChanged(*widget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childUpdateRequiredChanged(Widget& child)
+    {
+        const bool wasUpdateRequired = isUpdateRequired();
+
+        const auto it = std::find_if(m_updatedWidgets.begin(), m_updatedWidgets.end(), [&child](const Widget::Ptr& widget){ return widget.get() == &child; });
+        if (child.isUpdateRequired())
+        {
+            if ((it == m_updatedWidgets.end()) && (child.getParent() == this))
+                m_updatedWidgets.push_back(child.shared_from_this());
+        }
+        else if (it != m_updatedWidgets.end())
+            m_updatedWidgets.erase(it);
+
+        // Our own parent only has to be informed when the container starts or stops requiring updates
+        if (wasUpdateRequired != isUpdateRequired())
+            updateRequiredChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::leftMousePressed(Vector2f pos)
     {
         sf::Event event;
@@ -700,7 +1010,7 @@ namespace tgui
                     return toolTip;
             }
 
-            if (m_toolTip)
+            if (m_coldData && m_coldData->toolTip)
                 return getToolTip();
         }
 
@@ -709,6 +1019,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::addToMemoryReport(MemoryReport& report) const
+    {
+        Widget::addToMemoryReport(report);
+
+        std::size_t bytes = sizeof(Container) - sizeof(Widget);
+        bytes += (m_widgets.capacity() + m_updatedWidgets.capacity() + m_updatedWidgetsCopy.capacity()) * sizeof(Widget::Ptr);
+        bytes += m_widgetNames.capacity() * sizeof(sf::String);
+        for (const auto& name : m_widgetNames)
+            bytes += name.getSize() * sizeof(sf::Uint32);
+
+        report.subsystems["Containers"] += bytes;
+        report.widgetTypes[getWidgetType()].bytes += bytes;
+        report.totalBytes += bytes;
+
+        for (const auto& widget : m_widgets)
+            widget->addToMemoryReport(report);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::rendererChanged(const std::string& property)
     {
         Widget::rendererChanged(property);
@@ -773,12 +1103,19 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        // Only the widgets that asked for it are updated. The list is copied because widgets
+        // may stop requiring updates (or even be removed) while they are being updated.
+        // The copy reuses the memory of the previous frame, so updating doesn't allocate.
+        if (!m_updatedWidgets.empty())
         {
-            // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                m_widgets[i]->update(elapsedTime);
+            m_updatedWidgetsCopy.assign(m_updatedWidgets.begin(), m_updatedWidgets.end());
+            for (const auto& widget : m_updatedWidgetsCopy)
+            {
+                if ((widget->getParent() == this) && widget->isVisible())
+                    widget->update(elapsedTime);
+            }
+
+            m_updatedWidgetsCopy.clear();
         }
 
         m_animationTimeElapsed = {};
@@ -786,6 +1123,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::isUpdateRequired() const
+    {
+        return Widget::isUpdateRequired() || !m_updatedWidgets.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
         // Check if a mouse button has moved
@@ -964,6 +1308,7 @@ namespace tgui
         {
             if ((*it)->isVisible())
             {
+                ++m_hitTestCount;
                 if ((*it)->mouseOnWidget(mousePos))
                 {
                     if ((*it)->isEnabled())
@@ -984,6 +1329,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Container::getHitTestCount()
+    {
+        return m_hitTestCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
         // Draw all widgets when they are visible
@@ -998,13 +1350,14 @@ namespace tgui
 
     std::size_t Container::getFocusedWidgetIndex() const
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_focusedWidget == m_widgets[i])
-                return i+1;
-        }
+        if (!m_focusedWidget)
+            return 0;
+
+        const std::size_t index = findWidgetIndex(m_focusedWidget.get());
+        if (index == m_widgets.size())
+            return 0;
 
-        return 0;
+        return index + 1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1046,6 +1399,26 @@ namespace tgui
         return true;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateAbsolutePosition()
+    {
+        // When the cache of the container was already invalid then the caches of its child widgets are invalid as well
+        if (!m_absolutePositionCacheValid)
+            return;
+
+        Widget::invalidateAbsolutePosition();
+        childWidgetsOffsetChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetsOffsetChanged()
+    {
+        for (auto& widget : m_widgets)
+            widget->invalidateAbsolutePosition();
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
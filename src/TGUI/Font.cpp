@@ -25,14 +25,92 @@
 
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Exception.hpp>
 
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/Clock.hpp>
+
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cmath>
+#include <deque>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Characters that never have a visible glyph
+        bool isDistanceFieldWhitespace(std::uint32_t codePoint)
+        {
+            return (codePoint == ' ') || (codePoint == '\t') || (codePoint == '\n');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint64_t getDistanceFieldGlyphKey(std::uint32_t codePoint, bool bold)
+        {
+            return (static_cast<std::uint64_t>(bold) << 32) | codePoint;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds a character size to a sorted list, unless it is already in the list
+        void insertCharacterSize(std::vector<unsigned int>& characterSizes, unsigned int characterSize)
+        {
+            const auto it = std::lower_bound(characterSizes.begin(), characterSizes.end(), characterSize);
+            if ((it == characterSizes.end()) || (*it != characterSize))
+                characterSizes.insert(it, characterSize);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Font::DistanceField
+    {
+        unsigned int referenceSize = 0;
+        unsigned int spread = 0;
+        std::map<std::uint64_t, sf::Glyph> glyphs;
+
+        sf::Texture texture;
+        unsigned int textureWidth = 0;
+        unsigned int textureHeight = 0;
+
+        // Glyphs are packed in rows, new glyphs are added to the right of the last row
+        unsigned int rowLeft = 0;
+        unsigned int rowTop = 0;
+        unsigned int rowHeight = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Font::GlyphCache
+    {
+        // Characters that still have to be rasterized for one character size and style.
+        // A character size of 0 means that the glyphs are loaded in the distance field.
+        struct WarmUpTask
+        {
+            sf::String characters;
+            unsigned int characterSize = 0;
+            bool bold = false;
+            std::size_t nextCharacter = 0;
+        };
+
+        std::recursive_mutex mutex; // Recursive because continueWarmUp rasterizes glyphs while holding it
+        std::atomic<unsigned int> lastCharacterSize{0}; // Avoids locking the mutex when the same size is used repeatedly
+        std::atomic<unsigned int> lastRasterizedSize{0};
+        std::vector<unsigned int> characterSizes; // Sorted
+        std::vector<unsigned int> rasterizedSizes; // Sorted, the sf::Font has a glyph page for each of these sizes
+        std::deque<WarmUpTask> warmUpQueue;
+        std::size_t glyphsWarmedUp = 0;
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(std::nullptr_t)
@@ -42,8 +120,9 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const std::string& id) :
-        m_font(Deserializer::deserialize(ObjectConverter::Type::Font, id).getFont()), // Did not compile with clang 3.6 when using braces
-        m_id  (Deserializer::deserialize(ObjectConverter::Type::String, id).getString()) // Did not compile with clang 3.6 when using braces
+        m_font      (Deserializer::deserialize(ObjectConverter::Type::Font, id).getFont()), // Did not compile with clang 3.6 when using braces
+        m_id        (Deserializer::deserialize(ObjectConverter::Type::String, id).getString()), // Did not compile with clang 3.6 when using braces
+        m_glyphCache(getGlyphCache(m_font))
     {
     }
 
@@ -57,21 +136,24 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const std::shared_ptr<sf::Font>& font) :
-        m_font{font}
+        m_font      {font},
+        m_glyphCache{getGlyphCache(m_font)}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const sf::Font& font) :
-        m_font{std::make_shared<sf::Font>(font)}
+        m_font      {std::make_shared<sf::Font>(font)},
+        m_glyphCache{getGlyphCache(m_font)}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const void* data, std::size_t sizeInBytes) :
-        m_font{std::make_shared<sf::Font>()}
+        m_font      {std::make_shared<sf::Font>()},
+        m_glyphCache{getGlyphCache(m_font)}
     {
         m_font->loadFromMemory(data, sizeInBytes);
     }
@@ -88,6 +170,8 @@ namespace tgui
 
             m_font = other.m_font;
             m_id = other.m_id;
+            m_distanceField = other.m_distanceField;
+            m_glyphCache = other.m_glyphCache;
         }
 
         return *this;
@@ -105,6 +189,8 @@ namespace tgui
 
             m_font = std::move(other.m_font);
             m_id = std::move(other.m_id);
+            m_distanceField = std::move(other.m_distanceField);
+            m_glyphCache = std::move(other.m_glyphCache);
         }
 
         return *this;
@@ -165,22 +251,43 @@ namespace tgui
 
     bool Font::operator==(const Font& right) const
     {
-        return m_font == right.m_font;
+        return (m_font == right.m_font) && (m_distanceField == right.m_distanceField);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Font::operator!=(const Font& right) const
     {
-        return m_font != right.m_font;
+        return !(*this == right);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const sf::Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+    sf::Glyph Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
     {
         assert(m_font != nullptr);
 
+        addUsedCharacterSize(characterSize);
+
+        if (m_distanceField)
+        {
+            // Scale the metrics of the reference size instead of rasterizing the glyph at the requested size
+            const float scale = static_cast<float>(characterSize) / m_distanceField->referenceSize;
+            addRasterizedCharacterSize(m_distanceField->referenceSize);
+
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            sf::Glyph glyph = m_font->getGlyph(codePoint, m_distanceField->referenceSize, bold, outlineThickness / scale);
+        #else
+            sf::Glyph glyph = m_font->getGlyph(codePoint, m_distanceField->referenceSize, bold);
+        #endif
+
+            glyph.advance *= scale;
+            glyph.bounds = {glyph.bounds.left * scale, glyph.bounds.top * scale, glyph.bounds.width * scale, glyph.bounds.height * scale};
+            return glyph;
+        }
+
+        addRasterizedCharacterSize(characterSize);
+
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         return m_font->getGlyph(codePoint, characterSize, bold, outlineThickness);
     #else
@@ -193,23 +300,451 @@ namespace tgui
 
     float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize) const
     {
-        if (m_font)
-            return m_font->getKerning(first, second, characterSize);
-        else
+        if (!m_font)
             return 0;
+
+        if (m_distanceField)
+            return m_font->getKerning(first, second, m_distanceField->referenceSize) * characterSize / m_distanceField->referenceSize;
+        else
+            return m_font->getKerning(first, second, characterSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float Font::getLineSpacing(unsigned int characterSize) const
     {
-        if (m_font)
+        if (!m_font)
+            return 0;
+
+        if (m_distanceField)
+            return m_font->getLineSpacing(m_distanceField->referenceSize) * characterSize / m_distanceField->referenceSize;
+        else
             return m_font->getLineSpacing(characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::setDistanceFieldEnabled(bool enabled, unsigned int referenceSize)
+    {
+        // Copies that were made earlier keep using the old distance field, the state is never changed in place
+        if (enabled)
+        {
+            if (referenceSize == 0)
+                throw Exception{"The reference size of a distance field font can't be 0."};
+
+            m_distanceField = std::make_shared<DistanceField>();
+            m_distanceField->referenceSize = referenceSize;
+            m_distanceField->spread = std::max(2u, referenceSize / 8);
+        }
+        else
+            m_distanceField = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::isDistanceFieldEnabled() const
+    {
+        return m_distanceField != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Font::getDistanceFieldReferenceSize() const
+    {
+        if (m_distanceField)
+            return m_distanceField->referenceSize;
         else
             return 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::warmUp(const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool includeBold) const
+    {
+        if (!m_font)
+            return;
+
+        std::size_t glyphCount = 0;
+        for (const bool bold : {false, true})
+        {
+            if (bold && !includeBold)
+                break;
+
+            if (m_distanceField)
+            {
+                // The glyphs are rasterized together, so that the glyph page only has to be copied from the graphics card once
+                loadDistanceFieldGlyphs(characters, bold);
+                glyphCount += characters.getSize();
+                continue;
+            }
+
+            for (const unsigned int characterSize : characterSizes)
+            {
+                if (characters.isEmpty())
+                    break;
+
+                addRasterizedCharacterSize(characterSize);
+                for (std::size_t i = 0; i < characters.getSize(); ++i)
+                    m_font->getGlyph(characters[i], characterSize, bold);
+
+                glyphCount += characters.getSize();
+            }
+        }
+
+        for (const unsigned int characterSize : characterSizes)
+            addUsedCharacterSize(characterSize);
+
+        std::lock_guard<std::recursive_mutex> lock(m_glyphCache->mutex);
+        m_glyphCache->glyphsWarmedUp += glyphCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::queueWarmUp(const sf::String& characters, const std::vector<unsigned int>& characterSizes, bool includeBold) const
+    {
+        if (!m_font || characters.isEmpty())
+            return;
+
+        for (const unsigned int characterSize : characterSizes)
+            addUsedCharacterSize(characterSize);
+
+        std::lock_guard<std::recursive_mutex> lock(m_glyphCache->mutex);
+        for (const bool bold : {false, true})
+        {
+            if (bold && !includeBold)
+                break;
+
+            if (m_distanceField)
+                m_glyphCache->warmUpQueue.push_back({characters, 0, bold, 0});
+            else
+            {
+                for (const unsigned int characterSize : characterSizes)
+                    m_glyphCache->warmUpQueue.push_back({characters, characterSize, bold, 0});
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::continueWarmUp(sf::Time timeBudget) const
+    {
+        if (!m_font)
+            return true;
+
+        const sf::Clock clock;
+        std::lock_guard<std::recursive_mutex> lock(m_glyphCache->mutex);
+
+        auto& queue = m_glyphCache->warmUpQueue;
+        while (!queue.empty())
+        {
+            auto& task = queue.front();
+            if (task.characterSize == 0)
+            {
+                // The queue was filled before distance field rendering was disabled
+                if (!m_distanceField)
+                {
+                    queue.pop_front();
+                    continue;
+                }
+
+                // A few glyphs are loaded together so that the glyph page doesn't have to be copied for every glyph
+                const std::size_t count = std::min<std::size_t>(8, task.characters.getSize() - task.nextCharacter);
+                loadDistanceFieldGlyphs(task.characters.substring(task.nextCharacter, count), task.bold);
+                task.nextCharacter += count;
+                m_glyphCache->glyphsWarmedUp += count;
+            }
+            else
+            {
+                addRasterizedCharacterSize(task.characterSize);
+                m_font->getGlyph(task.characters[task.nextCharacter], task.characterSize, task.bold);
+                ++task.nextCharacter;
+                ++m_glyphCache->glyphsWarmedUp;
+            }
+
+            if (task.nextCharacter >= task.characters.getSize())
+                queue.pop_front();
+
+            if (clock.getElapsedTime() >= timeBudget)
+                break;
+        }
+
+        return queue.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::isWarmUpPending() const
+    {
+        if (!m_glyphCache)
+            return false;
+
+        std::lock_guard<std::recursive_mutex> lock(m_glyphCache->mutex);
+        return !m_glyphCache->warmUpQueue.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<unsigned int> Font::getUsedCharacterSizes() const
+    {
+        if (!m_glyphCache)
+            return {};
+
+        std::lock_guard<std::recursive_mutex> lock(m_glyphCache->mutex);
+        return m_glyphCache->characterSizes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Font::GlyphCacheStatistics Font::getGlyphCacheStatistics() const
+    {
+        GlyphCacheStatistics statistics;
+        if (!m_font)
+            return statistics;
+
+        // Asking the font for the texture of a character size would create a page when it didn't exist yet,
+        // so only the sizes at which glyphs were actually rasterized are looked up
+        std::vector<unsigned int> rasterizedSizes;
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_glyphCache->mutex);
+            rasterizedSizes = m_glyphCache->rasterizedSizes;
+        }
+
+        for (const unsigned int characterSize : rasterizedSizes)
+        {
+            const sf::Vector2u pageSize = m_font->getTexture(characterSize).getSize();
+            ++statistics.pageCount;
+            statistics.textureBytes += static_cast<std::size_t>(pageSize.x) * pageSize.y * 4;
+        }
+
+        if (m_distanceField)
+            statistics.textureBytes += static_cast<std::size_t>(m_distanceField->textureWidth) * m_distanceField->textureHeight * 4;
+
+        std::lock_guard<std::recursive_mutex> lock(m_glyphCache->mutex);
+        statistics.glyphsWarmedUp = m_glyphCache->glyphsWarmedUp;
+        for (const auto& task : m_glyphCache->warmUpQueue)
+            statistics.glyphsPending += task.characters.getSize() - task.nextCharacter;
+
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::loadDistanceFieldGlyphs(const sf::String& string, bool bold) const
+    {
+        assert(m_font != nullptr);
+        assert(m_distanceField != nullptr);
+
+        DistanceField& field = *m_distanceField;
+
+        std::vector<std::uint32_t> missingCodePoints;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            const std::uint32_t codePoint = string[i];
+            if (field.glyphs.find(getDistanceFieldGlyphKey(codePoint, bold)) != field.glyphs.end())
+                continue;
+            if (std::find(missingCodePoints.begin(), missingCodePoints.end(), codePoint) != missingCodePoints.end())
+                continue;
+
+            missingCodePoints.push_back(codePoint);
+        }
+
+        if (missingCodePoints.empty())
+            return;
+
+        // Rasterize all missing glyphs before downloading the glyph page, so that it only has to be copied once
+        addRasterizedCharacterSize(field.referenceSize);
+
+        std::vector<sf::Glyph> referenceGlyphs;
+        referenceGlyphs.reserve(missingCodePoints.size());
+        for (const std::uint32_t codePoint : missingCodePoints)
+            referenceGlyphs.push_back(m_font->getGlyph(codePoint, field.referenceSize, bold));
+
+        const bool anyVisibleGlyph = std::any_of(missingCodePoints.begin(), missingCodePoints.end(),
+                                                 [](std::uint32_t codePoint){ return !isDistanceFieldWhitespace(codePoint); });
+        const sf::Image page = anyVisibleGlyph ? m_font->getTexture(field.referenceSize).copyToImage() : sf::Image{};
+
+        if ((field.textureWidth == 0) && anyVisibleGlyph)
+        {
+            field.textureWidth = std::min(512u, sf::Texture::getMaximumSize());
+            field.textureHeight = field.textureWidth;
+
+            // The top left corner is reserved for a block that lies completely inside a glyph, to draw lines with
+            sf::Image image;
+            image.create(field.textureWidth, field.textureHeight, {255, 255, 255, 0});
+            for (unsigned int y = 0; y < 4; ++y)
+            {
+                for (unsigned int x = 0; x < 4; ++x)
+                    image.setPixel(x, y, {255, 255, 255, 255});
+            }
+
+            field.texture.loadFromImage(image);
+            field.texture.setSmooth(true);
+            field.rowLeft = 5;
+            field.rowTop = 0;
+            field.rowHeight = 5;
+        }
+
+        const int spread = static_cast<int>(field.spread);
+        for (std::size_t i = 0; i < missingCodePoints.size(); ++i)
+        {
+            sf::Glyph glyph = referenceGlyphs[i];
+            const sf::IntRect sourceRect = glyph.textureRect;
+            if (isDistanceFieldWhitespace(missingCodePoints[i]) || (sourceRect.width <= 0) || (sourceRect.height <= 0))
+            {
+                glyph.textureRect = {};
+                field.glyphs[getDistanceFieldGlyphKey(missingCodePoints[i], bold)] = glyph;
+                continue;
+            }
+
+            const unsigned int width = static_cast<unsigned int>(sourceRect.width + 2 * spread);
+            const unsigned int height = static_cast<unsigned int>(sourceRect.height + 2 * spread);
+
+            // Find a place in the texture, leaving a pixel between the glyphs
+            if (field.rowLeft + width + 1 > field.textureWidth)
+            {
+                field.rowLeft = 0;
+                field.rowTop += field.rowHeight;
+                field.rowHeight = 0;
+            }
+
+            if (field.rowTop + height + 1 > field.textureHeight)
+            {
+                const unsigned int newTextureHeight = field.textureHeight * 2;
+                if (newTextureHeight > sf::Texture::getMaximumSize())
+                    throw Exception{"Failed to add glyph to distance field, the texture can't become any larger."};
+
+                sf::Image image;
+                image.create(field.textureWidth, newTextureHeight, {255, 255, 255, 0});
+                image.copy(field.texture.copyToImage(), 0, 0);
+                field.texture.loadFromImage(image);
+                field.textureHeight = newTextureHeight;
+            }
+
+            // Calculate the distance to the nearest pixel on the other side of the edge, within the spread around each pixel
+            const sf::Uint8* pagePixels = page.getPixelsPtr();
+            const int pageWidth = static_cast<int>(page.getSize().x);
+            const auto isInside = [&](int x, int y){
+                if ((x < 0) || (y < 0) || (x >= sourceRect.width) || (y >= sourceRect.height))
+                    return false;
+                return pagePixels[((sourceRect.top + y) * pageWidth + sourceRect.left + x) * 4 + 3] >= 128;
+            };
+
+            std::vector<sf::Uint8> pixels(width * height * 4, 255);
+            for (int y = 0; y < static_cast<int>(height); ++y)
+            {
+                for (int x = 0; x < static_cast<int>(width); ++x)
+                {
+                    const int sourceX = x - spread;
+                    const int sourceY = y - spread;
+                    const bool inside = isInside(sourceX, sourceY);
+
+                    int minDistanceSquared = (spread + 1) * (spread + 1);
+                    for (int offsetY = -spread; offsetY <= spread; ++offsetY)
+                    {
+                        for (int offsetX = -spread; offsetX <= spread; ++offsetX)
+                        {
+                            const int distanceSquared = offsetX * offsetX + offsetY * offsetY;
+                            if ((distanceSquared < minDistanceSquared) && (isInside(sourceX + offsetX, sourceY + offsetY) != inside))
+                                minDistanceSquared = distanceSquared;
+                        }
+                    }
+
+                    // The edge lies halfway between the two pixels
+                    const float distance = std::min(std::sqrt(static_cast<float>(minDistanceSquared)) - 0.5f, static_cast<float>(spread));
+                    const float value = 127.5f + (inside ? distance : -distance) * 127.5f / spread;
+                    pixels[(y * width + x) * 4 + 3] = static_cast<sf::Uint8>(std::max(0.f, std::min(255.f, std::round(value))));
+                }
+            }
+
+            field.texture.update(pixels.data(), width, height, field.rowLeft, field.rowTop);
+
+            glyph.textureRect = {static_cast<int>(field.rowLeft), static_cast<int>(field.rowTop), static_cast<int>(width), static_cast<int>(height)};
+            glyph.bounds = {glyph.bounds.left - spread, glyph.bounds.top - spread, glyph.bounds.width + 2 * spread, glyph.bounds.height + 2 * spread};
+            field.glyphs[getDistanceFieldGlyphKey(missingCodePoints[i], bold)] = glyph;
+
+            field.rowLeft += width + 1;
+            field.rowHeight = std::max(field.rowHeight, height + 1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Glyph& Font::getDistanceFieldGlyph(std::uint32_t codePoint, bool bold) const
+    {
+        assert(m_distanceField != nullptr);
+
+        const auto it = m_distanceField->glyphs.find(getDistanceFieldGlyphKey(codePoint, bold));
+        if (it != m_distanceField->glyphs.end())
+            return it->second;
+
+        loadDistanceFieldGlyphs(sf::String{codePoint}, bold);
+        return m_distanceField->glyphs[getDistanceFieldGlyphKey(codePoint, bold)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Texture* Font::getDistanceFieldTexture() const
+    {
+        if (m_distanceField)
+            return &m_distanceField->texture;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::addUsedCharacterSize(unsigned int characterSize) const
+    {
+        if (!m_glyphCache || (m_glyphCache->lastCharacterSize == characterSize))
+            return;
+
+        std::lock_guard<std::recursive_mutex> lock(m_glyphCache->mutex);
+        insertCharacterSize(m_glyphCache->characterSizes, characterSize);
+        m_glyphCache->lastCharacterSize = characterSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::addRasterizedCharacterSize(unsigned int characterSize) const
+    {
+        if (!m_glyphCache || (m_glyphCache->lastRasterizedSize == characterSize))
+            return;
+
+        std::lock_guard<std::recursive_mutex> lock(m_glyphCache->mutex);
+        insertCharacterSize(m_glyphCache->rasterizedSizes, characterSize);
+        m_glyphCache->lastRasterizedSize = characterSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<Font::GlyphCache> Font::getGlyphCache(const std::shared_ptr<sf::Font>& font)
+    {
+        if (!font)
+            return nullptr;
+
+        static std::mutex mutex;
+        static std::map<const sf::Font*, std::weak_ptr<GlyphCache>> glyphCaches;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto glyphCache = glyphCaches[font.get()].lock();
+        if (glyphCache)
+            return glyphCache;
+
+        // The cache is only destroyed together with the last font that holds the sf::Font, so expired entries can be removed
+        for (auto it = glyphCaches.begin(); it != glyphCaches.end();)
+        {
+            if (it->second.expired())
+                it = glyphCaches.erase(it);
+            else
+                ++it;
+        }
+
+        glyphCache = std::make_shared<GlyphCache>();
+        glyphCaches[font.get()] = glyphCache;
+        return glyphCache;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -153,6 +153,8 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        ++m_inputStatistics.handledEvents;
+
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -246,7 +248,72 @@ namespace tgui
         #endif
         }
 
-        return m_container->handleEvent(event);
+        const std::size_t oldHitTestCount = Container::getHitTestCount();
+        const bool eventHandled = m_container->handleEvent(event);
+        m_inputStatistics.hitTests += Container::getHitTestCount() - oldHitTestCount;
+        return eventHandled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::queueEvent(const sf::Event& event)
+    {
+        ++m_inputStatistics.queuedEvents;
+
+        // Replace the previous event if it was a move of the same pointer. Only the last event is checked, as a move event
+        // can't be moved past any other event without changing the order in which things happen.
+        if (!m_queuedEvents.empty() && (m_queuedEvents.back().type == event.type))
+        {
+            if ((event.type == sf::Event::MouseMoved)
+             || ((event.type == sf::Event::TouchMoved) && (m_queuedEvents.back().touch.finger == event.touch.finger)))
+            {
+                m_queuedEvents.back() = event;
+                ++m_inputStatistics.coalescedEvents;
+                return;
+            }
+        }
+
+        m_queuedEvents.push_back(event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::handleQueuedEvents()
+    {
+        // Events that are queued by callbacks while handling these events will only be handled the next time
+        std::vector<sf::Event> events;
+        events.swap(m_queuedEvents);
+
+        for (const auto& event : events)
+            handleEvent(event);
+
+        // Reuse the memory of the vector next time
+        if (m_queuedEvents.empty())
+        {
+            events.clear();
+            m_queuedEvents.swap(events);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Gui::InputStatistics& Gui::getInputStatistics() const
+    {
+        return m_inputStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::resetInputStatistics()
+    {
+        m_inputStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::MemoryReport Gui::getMemoryReport() const
+    {
+        return m_container->getMemoryReport();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -276,6 +343,11 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        handleQueuedEvents();
+
+        // Pass the values that changed on other threads to the widgets
+        m_bindings.update();
+
         // Update the time
         if (m_windowFocused)
             updateTime(m_clock.restart());
@@ -358,6 +430,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::addWidgets(const std::vector<Widget::Ptr>& widgets, const std::vector<sf::String>& widgetNames)
+    {
+        m_container->addWidgets(widgets, widgetNames);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::removeWidgets(const std::function<bool(const Widget::Ptr&)>& predicate)
+    {
+        return m_container->removeWidgets(predicate);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::reorder(const std::vector<Widget::Ptr>& widgets)
+    {
+        return m_container->reorder(widgets);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Gui::setWidgetName(const Widget::Ptr& widget, const std::string& name)
     {
         return m_container->setWidgetName(widget, name);
@@ -442,17 +535,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::saveWidgetsToStream(std::stringstream& stream) const
+    void Gui::addDetachedWidgets(Container::DetachedWidgets&& detachedWidgets)
+    {
+        m_container->addDetachedWidgets(std::move(detachedWidgets));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::saveWidgetsToStream(std::ostream& stream) const
     {
         m_container->saveWidgetsToStream(stream);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Animator& Gui::getAnimator()
+    {
+        return m_animator;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Bindings& Gui::getBindings()
+    {
+        return m_bindings;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
         m_container->m_animationTimeElapsed = elapsedTime;
         m_container->update(elapsedTime);
+        m_animator.update(elapsedTime);
 
         if (m_tooltipPossible)
         {
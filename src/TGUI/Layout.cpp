@@ -28,265 +28,348 @@
 #include <TGUI/Gui.hpp>
 #include <TGUI/to_string.hpp>
 #include <SFML/System/Err.hpp>
+#include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <cstring>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    Layout::Layout(std::string expression)
+    namespace
     {
-        // Empty strings have value 0 (although this might indicate a mistake in the expression, it is valid for unary minus)
-        expression = trim(expression);
-        if (expression.empty())
-            return;
+        bool isBindingOperation(Layout::Operation operation)
+        {
+            return (operation == Layout::Operation::BindingLeft) || (operation == Layout::Operation::BindingTop)
+                || (operation == Layout::Operation::BindingWidth) || (operation == Layout::Operation::BindingHeight);
+        }
 
-        auto searchPos = expression.find_first_of("+-*/()");
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Extract the value from the string when there are no more operators
-        if (searchPos == std::string::npos)
+        bool isMathOperation(Layout::Operation operation)
         {
-            // Convert percentages to references to the parent widget
-            if (expression.back() == '%')
-            {
-                // We don't know if we have to bind the width or height, so bind "size" and let the connectWidget function figure it out later
-                if (expression == "100%")
-                {
-                    m_boundString = "&.size";
-                    m_operation = Operation::BindingString;
-                }
-                else // value is a fraction of parent size
-                {
-                    *this = Layout{Layout::Operation::Multiplies,
-                                   std::make_unique<Layout>(tgui::stof(expression.substr(0, expression.length()-1)) / 100.f),
-                                   std::make_unique<Layout>("&.size")};
-                }
-            }
-            else
+            return (operation == Layout::Operation::Plus) || (operation == Layout::Operation::Minus)
+                || (operation == Layout::Operation::Multiplies) || (operation == Layout::Operation::Divides);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool layoutStringEndsWith(const std::string& str, const char* suffix, std::size_t suffixLength)
+        {
+            return (str.size() >= suffixLength) && (str.compare(str.size() - suffixLength, suffixLength, suffix) == 0);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Checks whether the lowercase operand refers to the position or size of a widget
+        bool isLayoutBindingString(const std::string& operand)
+        {
+            return layoutStringEndsWith(operand, "x", 1)
+                || layoutStringEndsWith(operand, "y", 1)
+                || layoutStringEndsWith(operand, "w", 1) // width
+                || layoutStringEndsWith(operand, "h", 1) // height
+                || layoutStringEndsWith(operand, "left", 4)
+                || layoutStringEndsWith(operand, "top", 3)
+                || layoutStringEndsWith(operand, "width", 5)
+                || layoutStringEndsWith(operand, "height", 6)
+                || layoutStringEndsWith(operand, "size", 4)
+                || layoutStringEndsWith(operand, "pos", 3)
+                || layoutStringEndsWith(operand, "position", 8);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Compares a widget name with a lowercase part of a binding string
+        bool layoutNameEquals(const std::string& widgetName, const char* name, std::size_t nameLength)
+        {
+            if (widgetName.size() != nameLength)
+                return false;
+
+            for (std::size_t i = 0; i < nameLength; ++i)
             {
-                // The expression might reference to a widget instead of being a constant
-                expression = toLower(expression);
-                if ((expression.substr(expression.size()-1) == "x")
-                 || (expression.substr(expression.size()-1) == "y")
-                 || (expression.substr(expression.size()-1) == "w") // width
-                 || (expression.substr(expression.size()-1) == "h") // height
-                 || (expression.size() >= 4 && expression.substr(expression.size()-4) == "left")
-                 || (expression.size() >= 3 && expression.substr(expression.size()-3) == "top")
-                 || (expression.size() >= 5 && expression.substr(expression.size()-5) == "width")
-                 || (expression.size() >= 6 && expression.substr(expression.size()-6) == "height")
-                 || (expression.size() >= 4 && expression.substr(expression.size()-4) == "size")
-                 || (expression.size() >= 3 && expression.substr(expression.size()-3) == "pos")
-                 || (expression.size() >= 8 && expression.substr(expression.size()-8) == "position"))
-                {
-                    // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
-                    m_boundString = expression;
-                    m_operation = Operation::BindingString;
-                }
-                else if (expression.size() >= 5 && expression.substr(expression.size()-5) == "right")
-                {
-                    *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "left"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "width")};
-                }
-                else if (expression.size() >= 6 && expression.substr(expression.size()-6) == "bottom")
-                {
-                    *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "top"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "height")};
-                }
-                else // Constant value
-                    m_value = tgui::stof(expression);
+                if (std::tolower(static_cast<unsigned char>(widgetName[i])) != name[i])
+                    return false;
             }
 
-            return;
+            return true;
         }
 
-        // The string contains an expression, so split it up in multiple layouts
-        std::list<Layout> operands;
-        std::vector<Operation> operators;
-        decltype(searchPos) prevSearchPos = 0;
-        while (searchPos != std::string::npos)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Find the widget corresponding to the lowercase binding string and the operation to perform on it
+        bool resolveLayoutBindingString(const char* expression, std::size_t length, Widget* widget, bool xAxis,
+                                        Layout::Operation& operation, Widget*& boundWidget)
         {
-            switch (expression[searchPos])
-            {
-            case '+':
-                operators.push_back(Operation::Plus);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
-                break;
-            case '-':
-                operators.push_back(Operation::Minus);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
-                break;
-            case '*':
-                operators.push_back(Operation::Multiplies);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
-                break;
-            case '/':
-                operators.push_back(Operation::Divides);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
-                break;
-            case '(':
+            const auto equals = [&](const char* str){ return (std::strlen(str) == length) && (std::strncmp(expression, str, length) == 0); };
+            while (true)
             {
-                // Find corresponding closing bracket
-                unsigned int bracketCount = 0;
-                auto bracketPos = expression.find_first_of("()", searchPos + 1);
-                while (bracketPos != std::string::npos)
+                if (equals("x") || equals("left") || ((equals("pos") || equals("position")) && xAxis))
+                    operation = Layout::Operation::BindingLeft;
+                else if (equals("y") || equals("top") || equals("pos") || equals("position"))
+                    operation = Layout::Operation::BindingTop;
+                else if (equals("w") || equals("width") || (equals("size") && xAxis))
+                    operation = Layout::Operation::BindingWidth;
+                else if (equals("h") || equals("height") || equals("size"))
+                    operation = Layout::Operation::BindingHeight;
+                else
                 {
-                    if (expression[bracketPos] == '(')
-                        bracketCount++;
-                    else if (bracketCount > 0)
-                        bracketCount--;
+                    const char* dot = static_cast<const char*>(std::memchr(expression, '.', length));
+                    if (!dot || (dot == expression))
+                        return false;
+
+                    const std::size_t nameLength = static_cast<std::size_t>(dot - expression);
+                    Widget* nextWidget = nullptr;
+                    if (((nameLength == 6) && (std::strncmp(expression, "parent", 6) == 0)) || ((nameLength == 1) && (expression[0] == '&')))
+                        nextWidget = widget->getParent();
                     else
                     {
-                        // If the entire layout was in brackets then remove these brackets
-                        if ((searchPos == 0) && (bracketPos == expression.size()-1))
+                        // If the widget is a container, search in its children first
+                        const Container* container = dynamic_cast<Container*>(widget);
+                        if (container != nullptr)
                         {
-                            *this = Layout{expression.substr(1, expression.size()-2)};
-                            return;
+                            const auto& widgets = container->getWidgets();
+                            const auto& widgetNames = container->getWidgetNames();
+                            for (std::size_t i = 0; (i < widgets.size()) && !nextWidget; ++i)
+                            {
+                                if (layoutNameEquals(widgetNames[i], expression, nameLength))
+                                    nextWidget = widgets[i].get();
+                            }
                         }
-                        else // The brackets form a sub-expression
-                            searchPos = bracketPos;
 
-                        break;
+                        // If the widget has a parent, look for a sibling
+                        if (!nextWidget && widget->getParent())
+                        {
+                            const auto& widgets = widget->getParent()->getWidgets();
+                            const auto& widgetNames = widget->getParent()->getWidgetNames();
+                            for (std::size_t i = 0; (i < widgets.size()) && !nextWidget; ++i)
+                            {
+                                if (layoutNameEquals(widgetNames[i], expression, nameLength))
+                                    nextWidget = widgets[i].get();
+                            }
+                        }
                     }
 
-                    bracketPos = expression.find_first_of("()", bracketPos + 1);
-                }
+                    // The referred widget was not found
+                    if (!nextWidget)
+                        return false;
 
-                if (bracketPos == std::string::npos)
-                {
-                    TGUI_PRINT_WARNING("bracket mismatch while parsing layout string '" << expression << "'.");
-                    return;
-                }
-                else
-                {
-                    // Search for the next operator, starting from the closing bracket, but keeping prevSearchPos before the opening bracket
-                    searchPos = expression.find_first_of("+-*/()", searchPos + 1);
+                    widget = nextWidget;
+                    length -= nameLength + 1;
+                    expression = dot + 1;
                     continue;
                 }
+
+                boundWidget = widget;
+                return true;
             }
-            case ')':
-                TGUI_PRINT_WARNING("bracket mismatch while parsing layout string '" << expression << "'.");
-                return;
-            };
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            prevSearchPos = searchPos + 1;
-            searchPos = expression.find_first_of("+-*/()", searchPos + 1);
+        int getLayoutOperatorPrecedence(char operatorChar)
+        {
+            if ((operatorChar == '*') || (operatorChar == '/'))
+                return 2;
+            else if ((operatorChar == '+') || (operatorChar == '-'))
+                return 1;
+            else // Opening bracket
+                return 0;
         }
 
-        operands.emplace_back(expression.substr(prevSearchPos));
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // First perform all * and / operations
-        auto operandIt = operands.begin();
-        for (std::size_t i = 0; i < operators.size(); ++i)
+        Layout::Operation getLayoutOperation(char operatorChar)
         {
-            if ((operators[i] == Operation::Multiplies) || (operators[i] == Operation::Divides))
-            {
-                auto nextOperandIt = operandIt;
-                std::advance(nextOperandIt, 1);
+            if (operatorChar == '+')
+                return Layout::Operation::Plus;
+            else if (operatorChar == '-')
+                return Layout::Operation::Minus;
+            else if (operatorChar == '*')
+                return Layout::Operation::Multiplies;
+            else
+                return Layout::Operation::Divides;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                (*operandIt) = Layout{operators[i],
-                                      std::make_unique<Layout>(*operandIt),
-                                      std::make_unique<Layout>(*nextOperandIt)};
+    Layout::Layout(std::string expression)
+    {
+        // Empty strings have value 0 (although this might indicate a mistake in the expression, it is valid for unary minus)
+        expression = trim(expression);
+        if (expression.empty())
+            return;
 
-                operands.erase(nextOperandIt);
+        // Constants don't need any nodes
+        if (expression.find_first_of("+-*/()%") == std::string::npos)
+        {
+            expression = toLower(expression);
+            if (!isLayoutBindingString(expression) && !layoutStringEndsWith(expression, "right", 5) && !layoutStringEndsWith(expression, "bottom", 6))
+            {
+                m_value = tgui::stof(expression);
+                return;
             }
-            else
-                ++operandIt;
         }
 
-        // Now perform all + and - operations
-        operandIt = operands.begin();
-        for (std::size_t i = 0; i < operators.size(); ++i)
+        // Parse the expression in a single pass with the shunting-yard algorithm. Nodes are added in postfix order, with
+        // the operand stack holding the indices of the nodes that still have to be used by an operation.
+        std::vector<std::uint32_t> operandStack;
+        std::string operatorStack;
+        const auto applyOperator = [&]{
+            const std::uint32_t rightOperand = operandStack.back();
+            operandStack.pop_back();
+            const std::uint32_t leftOperand = operandStack.back();
+            operandStack.back() = addOperationNode(getLayoutOperation(operatorStack.back()), leftOperand, rightOperand);
+            operatorStack.pop_back();
+        };
+
+        bool expectOperand = true;
+        std::size_t pos = 0;
+        while (pos < expression.size())
         {
-            if ((operators[i] == Operation::Plus) || (operators[i] == Operation::Minus))
+            const char c = expression[pos];
+            if ((c == '+') || (c == '-') || (c == '*') || (c == '/'))
+            {
+                // A missing operand has value 0, which is what makes unary minus work
+                if (expectOperand)
+                    operandStack.push_back(addOperandNodes(""));
+
+                while (!operatorStack.empty() && (getLayoutOperatorPrecedence(operatorStack.back()) >= getLayoutOperatorPrecedence(c)))
+                    applyOperator();
+
+                operatorStack.push_back(c);
+                expectOperand = true;
+                ++pos;
+            }
+            else if (c == '(')
+            {
+                if (!expectOperand)
+                {
+                    TGUI_PRINT_WARNING("unexpected bracket while parsing layout string '" << expression << "'.");
+                    *this = Layout{};
+                    return;
+                }
+
+                operatorStack.push_back(c);
+                ++pos;
+            }
+            else if (c == ')')
             {
-                assert(operandIt != operands.end());
+                if (expectOperand)
+                    operandStack.push_back(addOperandNodes(""));
 
-                auto nextOperandIt = operandIt;
-                std::advance(nextOperandIt, 1);
+                while (!operatorStack.empty() && (operatorStack.back() != '('))
+                    applyOperator();
 
-                assert(nextOperandIt != operands.end());
+                if (operatorStack.empty())
+                {
+                    TGUI_PRINT_WARNING("bracket mismatch while parsing layout string '" << expression << "'.");
+                    *this = Layout{};
+                    return;
+                }
 
-                (*operandIt) = Layout{operators[i],
-                                      std::make_unique<Layout>(*operandIt),
-                                      std::make_unique<Layout>(*nextOperandIt)};
+                operatorStack.pop_back();
+                expectOperand = false;
+                ++pos;
+            }
+            else
+            {
+                const std::size_t endPos = std::min(expression.find_first_of("+-*/()", pos), expression.size());
+                operandStack.push_back(addOperandNodes(trim(expression.substr(pos, endPos - pos))));
+                expectOperand = false;
+                pos = endPos;
+            }
+        }
+
+        if (expectOperand)
+            operandStack.push_back(addOperandNodes(""));
 
-                operands.erase(nextOperandIt);
+        while (!operatorStack.empty())
+        {
+            if (operatorStack.back() == '(')
+            {
+                TGUI_PRINT_WARNING("bracket mismatch while parsing layout string '" << expression << "'.");
+                *this = Layout{};
+                return;
             }
+
+            applyOperator();
         }
 
-        assert(operands.size() == 1);
-        *this = operands.front();
+        assert(operandStack.size() == 1);
+        assert(operandStack.back() == m_nodes.size() - 1);
+
+        // Don't keep any nodes when the expression turned out to be constant, e.g. "(2)"
+        if ((m_nodes.size() == 1) && (m_nodes[0].operation == Operation::Value))
+        {
+            m_value = m_nodes[0].value;
+            m_nodes.clear();
+            m_nodes.shrink_to_fit();
+            return;
+        }
+
+        recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, Widget* boundWidget) :
-        m_operation  {operation},
-        m_boundWidget{boundWidget}
+    Layout::Layout(Operation operation, Widget* boundWidget)
     {
-        assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop) || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight));
-        assert(m_boundWidget != nullptr);
+        assert(isBindingOperation(operation));
+        assert(boundWidget != nullptr);
 
-        if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
+        Node node;
+        node.operation = operation;
+        node.boundWidget = boundWidget;
+        m_nodes.push_back(node);
 
-        resetPointers();
+        bindLayout();
         recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand) :
-        m_operation   {operation},
-        m_leftOperand {std::move(leftOperand)},
-        m_rightOperand{std::move(rightOperand)}
+        Layout{operation, std::move(*leftOperand), std::move(*rightOperand)}
     {
-        assert(m_leftOperand != nullptr);
-        assert(m_rightOperand != nullptr);
-        resetPointers();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(Operation operation, Layout leftOperand, Layout rightOperand)
+    {
+        assert(isMathOperation(operation));
+
+        const std::uint32_t leftIndex = appendLayout(std::move(leftOperand));
+        const std::uint32_t rightIndex = appendLayout(std::move(rightOperand));
+        addOperationNode(operation, leftIndex, rightIndex);
+
+        bindLayout();
         recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(const Layout& other) :
-        m_value          {other.m_value},
-        m_parent         {other.m_parent},
-        m_operation      {other.m_operation},
-        m_leftOperand    {other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr},
-        m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {other.m_boundString}
+        m_value       {other.m_value},
+        m_nodes       {other.m_nodes},
+        m_boundStrings{other.m_boundStrings ? std::make_unique<std::string>(*other.m_boundStrings) : nullptr}
     {
-        // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-        if (!m_boundString.empty())
-            m_boundWidget = nullptr;
-
-        resetPointers();
+        resetBoundStrings();
+        bindLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(Layout&& other) :
-        m_value          {std::move(other.m_value)},
-        m_parent         {std::move(other.m_parent)},
-        m_operation      {other.m_operation},
-        m_leftOperand    {std::move(other.m_leftOperand)},
-        m_rightOperand   {std::move(other.m_rightOperand)},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {std::move(other.m_boundString)}
+        m_value{other.m_value}
     {
-        resetPointers();
+        other.unbindLayout();
+        m_nodes = std::move(other.m_nodes);
+        m_boundStrings = std::move(other.m_boundStrings);
+        other.m_nodes.clear();
+        bindLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -297,19 +380,12 @@ namespace tgui
         {
             unbindLayout();
 
-            m_value           = other.m_value;
-            m_parent          = other.m_parent;
-            m_operation       = other.m_operation;
-            m_leftOperand     = other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr;
-            m_rightOperand    = other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr;
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = other.m_boundString;
+            m_value        = other.m_value;
+            m_nodes        = other.m_nodes;
+            m_boundStrings = other.m_boundStrings ? std::make_unique<std::string>(*other.m_boundStrings) : nullptr;
 
-            // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-            if (!m_boundString.empty())
-                m_boundWidget = nullptr;
-
-            resetPointers();
+            resetBoundStrings();
+            bindLayout();
         }
 
         return *this;
@@ -322,16 +398,14 @@ namespace tgui
         if (this != &other)
         {
             unbindLayout();
+            other.unbindLayout();
 
-            m_value           = std::move(other.m_value);
-            m_parent          = std::move(other.m_parent);
-            m_operation       = other.m_operation;
-            m_leftOperand     = std::move(other.m_leftOperand);
-            m_rightOperand    = std::move(other.m_rightOperand);
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = std::move(other.m_boundString);
+            m_value        = other.m_value;
+            m_nodes        = std::move(other.m_nodes);
+            m_boundStrings = std::move(other.m_boundStrings);
+            other.m_nodes.clear();
 
-            resetPointers();
+            bindLayout();
         }
 
         return *this;
@@ -348,86 +422,52 @@ namespace tgui
 
     std::string Layout::toString() const
     {
-        if (m_operation == Operation::Value)
-        {
+        if (m_nodes.empty())
             return to_string(m_value);
-        }
-        else if ((m_operation == Operation::Plus) || (m_operation == Operation::Minus) || (m_operation == Operation::Multiplies) || (m_operation == Operation::Divides))
-        {
-            char operatorChar;
-            if (m_operation == Operation::Plus)
-                operatorChar = '+';
-            else if (m_operation == Operation::Minus)
-                operatorChar = '-';
-            else if (m_operation == Operation::Multiplies)
-                operatorChar = '*';
-            else // if (m_operation == Operation::Divides)
-                operatorChar = '/';
-
-            if ((m_leftOperand->m_leftOperand) && (m_rightOperand->m_leftOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " (" + m_rightOperand->toString() + ")";
-            else if (m_leftOperand->m_leftOperand)
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " " + m_rightOperand->toString();
-            else if (m_rightOperand->m_leftOperand)
-                return m_leftOperand->toString() + " " + operatorChar + " (" + m_rightOperand->toString() + ")";
-            else
-                return m_leftOperand->toString() + " " + operatorChar + " " + m_rightOperand->toString();
-        }
         else
-        {
-            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
-            return m_boundString;
-        }
+            return nodeToString(m_nodes.size() - 1);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindLayout()
+    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
     {
-        if (m_boundWidget)
-        {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop) || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight));
-
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->unbindPositionLayout(this);
-            else // if ((m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight))
-                m_boundWidget->unbindSizeLayout(this);
-        }
-    }
+        const float oldValue = m_value;
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // No callbacks must be made while parsing, a single callback will be made when done if needed
+        m_connectedWidgetCallback = nullptr;
 
-    void Layout::resetPointers()
-    {
-        if (m_leftOperand != nullptr)
+        // Parse the string bindings even when the referred widget was already found. The widget may be added to a different parent
+        std::vector<Widget*> oldBoundWidgets;
+        for (auto& node : m_nodes)
         {
-            assert(m_rightOperand != nullptr);
+            if (node.boundStringLength == 0)
+                continue;
 
-            m_leftOperand->m_parent = this;
-            m_rightOperand->m_parent = this;
+            Operation operation;
+            Widget* boundWidget = nullptr;
+            if (resolveLayoutBindingString(&(*m_boundStrings)[node.boundStringStart], node.boundStringLength, widget, xAxis, operation, boundWidget))
+            {
+                if (node.boundWidget && (node.boundWidget != boundWidget))
+                    oldBoundWidgets.push_back(node.boundWidget);
+
+                node.operation = operation;
+                node.boundWidget = boundWidget;
+            }
         }
 
-        if (m_boundWidget)
+        // Widgets that are no longer referred to by any node no longer have to inform this layout about changes
+        for (Widget* oldBoundWidget : oldBoundWidgets)
         {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop) || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight));
-
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->bindPositionLayout(this);
-            else // if ((m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight))
-                m_boundWidget->bindSizeLayout(this);
+            if (std::none_of(m_nodes.begin(), m_nodes.end(), [oldBoundWidget](const Node& node){ return node.boundWidget == oldBoundWidget; }))
+            {
+                oldBoundWidget->unbindPositionLayout(this);
+                oldBoundWidget->unbindSizeLayout(this);
+            }
         }
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
-    {
-        const float oldValue = m_value;
 
-        // No callbacks must be made while parsing, a single callback will be made when done if needed
-        m_connectedWidgetCallback = nullptr;
-
-        parseBindingStringRecursive(widget, xAxis);
+        bindLayout();
+        recalculateValue();
 
         // Restore the callback function
         m_connectedWidgetCallback = valueChangedCallbackHandler;
@@ -441,16 +481,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindWidget()
+    void Layout::unbindWidget(Widget* widget)
     {
-        m_boundWidget = nullptr;
-
-        if (!m_boundString.empty())
-            m_operation = Operation::BindingString;
-        else
+        for (auto& node : m_nodes)
         {
-            m_value = 0;
-            m_operation = Operation::Value;
+            if (node.boundWidget != widget)
+                continue;
+
+            node.boundWidget = nullptr;
+            if (node.boundStringLength > 0)
+                node.operation = Operation::BindingString;
+            else
+            {
+                node.value = 0;
+                node.operation = Operation::Value;
+            }
         }
 
         recalculateValue();
@@ -460,158 +505,282 @@ namespace tgui
 
     void Layout::recalculateValue()
     {
-        const float oldValue = m_value;
+        if (m_nodes.empty())
+            return;
 
-        switch (m_operation)
-        {
-            case Operation::Value:
-                break;
-            case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
-            case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
-            case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
-            case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
-                break;
-            case Operation::BindingLeft:
-                m_value = m_boundWidget->getPosition().x;
-                break;
-            case Operation::BindingTop:
-                m_value = m_boundWidget->getPosition().y;
-                break;
-            case Operation::BindingWidth:
-                m_value = m_boundWidget->getSize().x;
-                break;
-            case Operation::BindingHeight:
-                m_value = m_boundWidget->getSize().y;
-                break;
-            case Operation::BindingString:
-                // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet
-                break;
-        };
+        // Operands always precede the node that uses them, so a single loop evaluates the whole expression
+        for (auto& node : m_nodes)
+        {
+            switch (node.operation)
+            {
+                case Operation::Value:
+                    break;
+                case Operation::Plus:
+                    node.value = m_nodes[node.leftOperand].value + m_nodes[node.rightOperand].value;
+                    break;
+                case Operation::Minus:
+                    node.value = m_nodes[node.leftOperand].value - m_nodes[node.rightOperand].value;
+                    break;
+                case Operation::Multiplies:
+                    node.value = m_nodes[node.leftOperand].value * m_nodes[node.rightOperand].value;
+                    break;
+                case Operation::Divides:
+                    if (m_nodes[node.rightOperand].value != 0)
+                        node.value = m_nodes[node.leftOperand].value / m_nodes[node.rightOperand].value;
+                    else
+                        node.value = 0;
+                    break;
+                case Operation::BindingLeft:
+                    node.value = node.boundWidget->getPosition().x;
+                    break;
+                case Operation::BindingTop:
+                    node.value = node.boundWidget->getPosition().y;
+                    break;
+                case Operation::BindingWidth:
+                    node.value = node.boundWidget->getSize().x;
+                    break;
+                case Operation::BindingHeight:
+                    node.value = node.boundWidget->getSize().y;
+                    break;
+                case Operation::BindingString:
+                    // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet
+                    break;
+            };
+        }
 
+        const float oldValue = m_value;
+        m_value = m_nodes.back().value;
         if (m_value != oldValue)
         {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
+            if (m_connectedWidgetCallback)
+                m_connectedWidgetCallback();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Layout::getAllocatedMemory() const
+    {
+        std::size_t bytes = m_nodes.capacity() * sizeof(Node);
+        if (m_boundStrings)
+            bytes += sizeof(std::string) + m_boundStrings->capacity();
+
+        return bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::unbindLayout()
+    {
+        for (const auto& node : m_nodes)
+        {
+            if (node.boundWidget)
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                node.boundWidget->unbindPositionLayout(this);
+                node.boundWidget->unbindSizeLayout(this);
             }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
+    void Layout::bindLayout()
     {
-        if (m_leftOperand)
+        for (const auto& node : m_nodes)
         {
-            assert(m_rightOperand != nullptr);
+            if (!node.boundWidget)
+                continue;
+
+            assert(isBindingOperation(node.operation));
 
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
+            if ((node.operation == Operation::BindingLeft) || (node.operation == Operation::BindingTop))
+                node.boundWidget->bindPositionLayout(this);
+            else // if ((node.operation == Operation::BindingWidth) || (node.operation == Operation::BindingHeight))
+                node.boundWidget->bindSizeLayout(this);
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
-        if (!m_boundString.empty())
-            parseBindingString(m_boundString, widget, xAxis);
+    void Layout::resetBoundStrings()
+    {
+        for (auto& node : m_nodes)
+        {
+            if (node.boundStringLength > 0)
+            {
+                node.boundWidget = nullptr;
+                node.operation = Operation::BindingString;
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis)
+    std::uint32_t Layout::addOperandNodes(std::string operand)
     {
-        if (expression == "x" || expression == "left")
+        if (!operand.empty() && (operand.back() == '%'))
         {
-            m_operation = Operation::BindingLeft;
-            m_boundWidget = widget;
+            // We don't know if we have to bind the width or height, so bind "size" and let the connectWidget function figure it out later
+            if (operand == "100%")
+                return addBindingStringNode("&.size");
+
+            // Value is a fraction of parent size
+            Node node;
+            node.value = tgui::stof(operand.substr(0, operand.length()-1)) / 100.f;
+            m_nodes.push_back(node);
+            const std::uint32_t fractionIndex = static_cast<std::uint32_t>(m_nodes.size() - 1);
+            return addOperationNode(Operation::Multiplies, fractionIndex, addBindingStringNode("&.size"));
         }
-        else if (expression == "y" || expression == "top")
+
+        // The operand might reference to a widget instead of being a constant
+        operand = toLower(operand);
+        if (isLayoutBindingString(operand))
         {
-            m_operation = Operation::BindingTop;
-            m_boundWidget = widget;
+            // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
+            return addBindingStringNode(operand);
         }
-        else if (expression == "w" || expression == "width")
+        else if (layoutStringEndsWith(operand, "right", 5))
         {
-            m_operation = Operation::BindingWidth;
-            m_boundWidget = widget;
+            const std::string prefix = operand.substr(0, operand.size()-5);
+            const std::uint32_t leftIndex = addBindingStringNode(prefix + "left");
+            return addOperationNode(Operation::Plus, leftIndex, addBindingStringNode(prefix + "width"));
         }
-        else if (expression == "h" || expression == "height")
+        else if (layoutStringEndsWith(operand, "bottom", 6))
         {
-            m_operation = Operation::BindingHeight;
-            m_boundWidget = widget;
+            const std::string prefix = operand.substr(0, operand.size()-6);
+            const std::uint32_t topIndex = addBindingStringNode(prefix + "top");
+            return addOperationNode(Operation::Plus, topIndex, addBindingStringNode(prefix + "height"));
         }
-        else if (expression == "size")
+        else // Constant value
         {
-            if (xAxis)
-                return parseBindingString("width", widget, xAxis);
-            else
-                return parseBindingString("height", widget, xAxis);
+            Node node;
+            if (!operand.empty())
+                node.value = tgui::stof(operand);
+
+            m_nodes.push_back(node);
+            return static_cast<std::uint32_t>(m_nodes.size() - 1);
         }
-        else if ((expression == "pos") || (expression == "position"))
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t Layout::addBindingStringNode(const std::string& expression)
+    {
+        if (!m_boundStrings)
+            m_boundStrings = std::make_unique<std::string>();
+
+        Node node;
+        node.operation = Operation::BindingString;
+        node.boundStringStart = static_cast<std::uint32_t>(m_boundStrings->size());
+        node.boundStringLength = static_cast<std::uint32_t>(expression.size());
+        *m_boundStrings += expression;
+        m_nodes.push_back(node);
+        return static_cast<std::uint32_t>(m_nodes.size() - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t Layout::addOperationNode(Operation operation, std::uint32_t leftOperand, std::uint32_t rightOperand)
+    {
+        Node node;
+        node.operation = operation;
+        node.leftOperand = leftOperand;
+        node.rightOperand = rightOperand;
+        m_nodes.push_back(node);
+        return static_cast<std::uint32_t>(m_nodes.size() - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t Layout::appendLayout(Layout&& other)
+    {
+        if (other.m_nodes.empty())
         {
-            if (xAxis)
-                return parseBindingString("x", widget, xAxis);
-            else
-                return parseBindingString("y", widget, xAxis);
+            Node node;
+            node.value = other.m_value;
+            m_nodes.push_back(node);
+            return static_cast<std::uint32_t>(m_nodes.size() - 1);
         }
-        else
+
+        // The other layout will no longer exist, so the bound widgets have to stop informing it
+        other.unbindLayout();
+
+        if (m_nodes.empty())
         {
-            const auto dotPos = expression.find('.');
-            if (dotPos != std::string::npos)
-            {
-                const std::string widgetName = expression.substr(0, dotPos);
-                if (widgetName == "parent" || widgetName == "&")
-                {
-                    if (widget->getParent())
-                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis);
-                }
-                else if (!widgetName.empty())
-                {
-                    // If the widget is a container, search in its children first
-                    Container* container = dynamic_cast<Container*>(widget);
-                    if (container != nullptr)
-                    {
-                        const auto& widgets = container->getWidgets();
-                        const auto& widgetNames = container->getWidgetNames();
-                        for (std::size_t i = 0; i < widgets.size(); ++i)
-                        {
-                            if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
-                        }
-                    }
+            m_nodes = std::move(other.m_nodes);
+            m_boundStrings = std::move(other.m_boundStrings);
+            other.m_nodes.clear();
+            return static_cast<std::uint32_t>(m_nodes.size() - 1);
+        }
 
-                    // If the widget has a parent, look for a sibling
-                    if (widget->getParent())
-                    {
-                        const auto& widgets = widget->getParent()->getWidgets();
-                        const auto& widgetNames = widget->getParent()->getWidgetNames();
-                        for (std::size_t i = 0; i < widgets.size(); ++i)
-                        {
-                            if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
-                        }
-                    }
-                }
+        const auto nodeOffset = static_cast<std::uint32_t>(m_nodes.size());
+        const auto stringOffset = static_cast<std::uint32_t>(m_boundStrings ? m_boundStrings->size() : 0);
+        m_nodes.reserve(m_nodes.size() + other.m_nodes.size());
+        for (Node node : other.m_nodes)
+        {
+            if (isMathOperation(node.operation))
+            {
+                node.leftOperand += nodeOffset;
+                node.rightOperand += nodeOffset;
             }
 
-            // The referred widget was not found or there was something wrong with the string
-            return;
+            if (node.boundStringLength > 0)
+                node.boundStringStart += stringOffset;
+
+            m_nodes.push_back(node);
         }
 
-        resetPointers();
-        recalculateValue();
+        if (other.m_boundStrings)
+        {
+            if (m_boundStrings)
+                *m_boundStrings += *other.m_boundStrings;
+            else
+                m_boundStrings = std::move(other.m_boundStrings);
+        }
+
+        other.m_nodes.clear();
+        return static_cast<std::uint32_t>(m_nodes.size() - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Layout::nodeToString(std::size_t index) const
+    {
+        const Node& node = m_nodes[index];
+        if (node.operation == Operation::Value)
+        {
+            return to_string(node.value);
+        }
+        else if (isMathOperation(node.operation))
+        {
+            char operatorChar;
+            if (node.operation == Operation::Plus)
+                operatorChar = '+';
+            else if (node.operation == Operation::Minus)
+                operatorChar = '-';
+            else if (node.operation == Operation::Multiplies)
+                operatorChar = '*';
+            else // if (node.operation == Operation::Divides)
+                operatorChar = '/';
+
+            std::string left = nodeToString(node.leftOperand);
+            if (isMathOperation(m_nodes[node.leftOperand].operation))
+                left = "(" + left + ")";
+
+            std::string right = nodeToString(node.rightOperand);
+            if (isMathOperation(m_nodes[node.rightOperand].operation))
+                right = "(" + right + ")";
+
+            return left + " " + operatorChar + " " + right;
+        }
+        else
+        {
+            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
+            if (m_boundStrings)
+                return m_boundStrings->substr(node.boundStringStart, node.boundStringLength);
+            else
+                return "";
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -619,35 +788,35 @@ namespace tgui
 
     Layout operator-(Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, Layout{}, std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator+(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Plus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Plus, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator-(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator*(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Multiplies, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Multiplies, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator/(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Divides, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Divides, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -730,8 +899,8 @@ namespace tgui
         Layout bindRight(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingLeft, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingWidth, widget.get())};
+                          Layout{Layout::Operation::BindingLeft, widget.get()},
+                          Layout{Layout::Operation::BindingWidth, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -739,8 +908,8 @@ namespace tgui
         Layout bindBottom(Widget::Ptr widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingTop, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingHeight, widget.get())};
+                          Layout{Layout::Operation::BindingTop, widget.get()},
+                          Layout{Layout::Operation::BindingHeight, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -448,37 +448,29 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::vector<std::string> convertNodesToLines(const std::unique_ptr<DataIO::Node>& node)
+        void emitNode(const std::unique_ptr<DataIO::Node>& node, std::ostream& stream, const std::string& indentation)
         {
-            std::vector<std::string> output;
             if (node->name.empty())
-                output.emplace_back("{");
+                stream << indentation << "{\n";
             else
-                output.emplace_back(node->name + " {");
+                stream << indentation << node->name << " {\n";
 
-            if (!node->propertyValuePairs.empty())
-            {
-                for (const auto& pair : node->propertyValuePairs)
-                    output.emplace_back("    " + pair.first + " = " + pair.second->value + ";");
-            }
+            for (const auto& pair : node->propertyValuePairs)
+                stream << indentation << "    " << pair.first << " = " << pair.second->value.toAnsiString() << ";\n";
 
             if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
-                output.emplace_back("");
+                stream << indentation << "\n";
 
-            if (!node->children.empty())
+            const std::string childIndentation = indentation + "    ";
+            for (std::size_t i = 0; i < node->children.size(); ++i)
             {
-                for (std::size_t i = 0; i < node->children.size(); ++i)
-                {
-                    for (const auto& line : convertNodesToLines(node->children[i]))
-                        output.emplace_back("    " + line);
+                emitNode(node->children[i], stream, childIndentation);
 
-                    if (i < node->children.size() - 1)
-                        output.emplace_back("");
-                }
+                if (i < node->children.size() - 1)
+                    stream << indentation << "\n";
             }
 
-            output.emplace_back("}");
-            return output;
+            stream << indentation << "}\n";
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -516,23 +508,25 @@ namespace tgui
     void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
     {
         for (const auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << " = " << pair.second->value.toAnsiString() << ";" << std::endl;
+            stream << pair.first << " = " << pair.second->value.toAnsiString() << ";\n";
 
         if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
-            stream << std::endl;
+            stream << "\n";
 
-        std::vector<std::string> output;
         for (std::size_t i = 0; i < rootNode->children.size(); ++i)
         {
-            for (const auto& line : convertNodesToLines(rootNode->children[i]))
-                output.emplace_back(std::move(line));
+            emitSection(rootNode->children[i], stream);
 
             if (i < rootNode->children.size()-1)
-                output.emplace_back("");
+                stream << "\n";
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        for (const auto& line : output)
-            stream << line << std::endl;
+    void DataIO::emitSection(const std::unique_ptr<Node>& node, std::ostream& stream)
+    {
+        emitNode(node, stream, "");
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,8 +25,13 @@
 
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Global.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -136,6 +141,19 @@ namespace tgui
                                                       {"backgroundcolorhover", Color::White},
                                                       {"selectedbackgroundcolor", Color{0, 110, 255}},
                                                       {"selectedbackgroundcolorhover", Color{30, 150, 255}}})},
+                    {"listview", RendererData::create({{"borders", Borders{1}},
+                                                       {"padding", Padding{0}},
+                                                       {"bordercolor", Color::Black},
+                                                       {"textcolor", Color{60, 60, 60}},
+                                                       {"textcolorhover", Color::Black},
+                                                       {"selectedtextcolor", Color::White},
+                                                       {"backgroundcolor", Color{245, 245, 245}},
+                                                       {"backgroundcolorhover", Color::White},
+                                                       {"selectedbackgroundcolor", Color{0, 110, 255}},
+                                                       {"selectedbackgroundcolorhover", Color{30, 150, 255}},
+                                                       {"headerbackgroundcolor", Color{230, 230, 230}},
+                                                       {"headertextcolor", Color::Black},
+                                                       {"separatorcolor", Color{200, 200, 200}}})},
                     {"menubar", RendererData::create({{"textcolor", Color{60, 60, 60}},
                                                       {"selectedtextcolor", Color::White},
                                                       {"backgroundcolor", Color::White},
@@ -222,6 +240,16 @@ namespace tgui
                                                       {"selectedtextcolor", Color::White},
                                                       {"selectedtextbackgroundcolor", Color{0, 110, 255}},
                                                       {"backgroundcolor", Color::White}})},
+                    {"treeview", RendererData::create({{"borders", Borders{1}},
+                                                       {"padding", Padding{0}},
+                                                       {"bordercolor", Color::Black},
+                                                       {"textcolor", Color{60, 60, 60}},
+                                                       {"textcolorhover", Color::Black},
+                                                       {"selectedtextcolor", Color::White},
+                                                       {"backgroundcolor", Color{245, 245, 245}},
+                                                       {"backgroundcolorhover", Color::White},
+                                                       {"selectedbackgroundcolor", Color{0, 110, 255}},
+                                                       {"selectedbackgroundcolorhover", Color{30, 150, 255}}})},
                     {"verticallayout", RendererData::create({})}
                };
             }
@@ -230,6 +258,176 @@ namespace tgui
 
 
         DefaultTheme defaultTheme;
+
+        // Widgets may be created on multiple threads, so the renderers of themes are only accessed while this mutex is locked
+        std::recursive_mutex themeRenderersMutex;
+
+        // Textures and fonts that were already loaded, mapped by their type and serialized value
+        using LoadedThemeResources = std::map<std::pair<ObjectConverter::Type, std::string>, ObjectConverter>;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addLoadedThemeResource(LoadedThemeResources& resources, const ObjectConverter& value)
+        {
+            if ((value.getType() != ObjectConverter::Type::Texture) && (value.getType() != ObjectConverter::Type::Font))
+                return;
+
+            // Textures and fonts without an id can't be found back by their string
+            ObjectConverter copy = value;
+            const std::string serialized = copy.getString();
+            if ((serialized != "None") && (serialized != "null"))
+                resources.emplace(std::make_pair(value.getType(), serialized), value);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isThemeValueUnchanged(const ObjectConverter& oldValue, const sf::String& newString, ObjectConverter& newValue,
+                                   LoadedThemeResources& resources, Theme::ReloadStatistics& statistics);
+
+        bool isThemeRendererUnchanged(const RendererData& oldData, const RendererData& newData,
+                                      LoadedThemeResources& resources, Theme::ReloadStatistics& statistics)
+        {
+            if (oldData.propertyValuePairs.size() != newData.propertyValuePairs.size())
+                return false;
+
+            auto oldIt = oldData.propertyValuePairs.begin();
+            for (const auto& pair : newData.propertyValuePairs)
+            {
+                if (oldIt->first != pair.first)
+                    return false;
+
+                ObjectConverter newValue = pair.second;
+                ObjectConverter convertedValue;
+                if (!isThemeValueUnchanged(oldIt->second, newValue.getString(), convertedValue, resources, statistics))
+                    return false;
+
+                ++oldIt;
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Compares the old value with the new one by converting the new string to the type that the old value already has.
+        // When the values differ, newValue will contain the value that has to be stored in the renderer.
+        bool isThemeValueUnchanged(const ObjectConverter& oldValue, const sf::String& newString, ObjectConverter& newValue,
+                                   LoadedThemeResources& resources, Theme::ReloadStatistics& statistics)
+        {
+            newValue = ObjectConverter{newString};
+
+            const auto type = oldValue.getType();
+            if (type == ObjectConverter::Type::None)
+                return false;
+
+            // When the text is identical then there is no need to deserialize anything
+            ObjectConverter oldCopy = oldValue;
+            if (oldCopy.getString() == newString)
+                return true;
+
+            // If no widget requested the value yet then we don't know to which type it has to be converted
+            if (type == ObjectConverter::Type::String)
+                return false;
+
+            try
+            {
+                if (type == ObjectConverter::Type::RendererData)
+                {
+                    const auto newData = Deserializer::deserialize(type, newString).getRenderer();
+                    if (isThemeRendererUnchanged(*oldCopy.getRenderer(), *newData, resources, statistics))
+                        return true;
+
+                    newValue = ObjectConverter{newData};
+                    return false;
+                }
+                else if ((type == ObjectConverter::Type::Texture) || (type == ObjectConverter::Type::Font))
+                {
+                    const auto key = std::make_pair(type, newString.toAnsiString());
+                    const auto it = resources.find(key);
+                    if (it != resources.end())
+                    {
+                        newValue = it->second;
+                        ++statistics.resourcesReused;
+                    }
+                    else
+                    {
+                        newValue = Deserializer::deserialize(type, newString);
+                        resources.emplace(key, newValue);
+                    }
+                }
+                else
+                    newValue = Deserializer::deserialize(type, newString);
+            }
+            catch (const Exception&)
+            {
+                // Keep the invalid value as a string, the widget will report the error when it tries to use the value
+                newValue = ObjectConverter{newString};
+                return false;
+            }
+
+            return newValue == oldValue;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Rasterizes the glyphs of the fonts in the renderers at the sizes at which the old fonts were used
+        void warmUpThemeFonts(std::map<std::string, std::shared_ptr<RendererData>>& renderers, const LoadedThemeResources& oldResources,
+                              const sf::String& characters, bool includeBold, Theme::ReloadStatistics& statistics)
+        {
+            std::vector<Font> fonts;
+            const auto addFont = [&fonts](const Font& font){
+                    if (font && (std::find(fonts.begin(), fonts.end(), font) == fonts.end()))
+                        fonts.push_back(font);
+                };
+
+            if (getGlobalFont())
+                addFont(getGlobalFont());
+
+            for (auto& pair : renderers)
+            {
+                const auto it = pair.second->propertyValuePairs.find("font");
+                if ((it == pair.second->propertyValuePairs.end())
+                 || ((it->second.getType() != ObjectConverter::Type::Font) && (it->second.getType() != ObjectConverter::Type::String)))
+                    continue;
+
+                try
+                {
+                    addFont(it->second.getFont());
+                }
+                catch (const Exception&)
+                {
+                    // The widget will report the error when it tries to use the font
+                }
+            }
+
+            // The fonts that were replaced by the new theme tell at which sizes the text of the widgets is drawn
+            std::vector<unsigned int> characterSizes{getGlobalTextSize()};
+            for (const auto& resource : oldResources)
+            {
+                if (resource.first.first != ObjectConverter::Type::Font)
+                    continue;
+
+                ObjectConverter oldFont = resource.second;
+                const auto usedSizes = oldFont.getFont().getUsedCharacterSizes();
+                characterSizes.insert(characterSizes.end(), usedSizes.begin(), usedSizes.end());
+            }
+
+            for (const auto& font : fonts)
+            {
+                const auto usedSizes = font.getUsedCharacterSizes();
+                characterSizes.insert(characterSizes.end(), usedSizes.begin(), usedSizes.end());
+            }
+
+            std::sort(characterSizes.begin(), characterSizes.end());
+            characterSizes.erase(std::unique(characterSizes.begin(), characterSizes.end()), characterSizes.end());
+
+            for (const auto& font : fonts)
+            {
+                const std::size_t glyphsWarmedUpBefore = font.getGlyphCacheStatistics().glyphsWarmedUp;
+                font.warmUp(characters, characterSizes, includeBold);
+                statistics.glyphsWarmedUp += font.getGlyphCacheStatistics().glyphsWarmedUp - glyphsWarmedUpBefore;
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -258,68 +456,113 @@ namespace tgui
 
     void Theme::load(const std::string& primary)
     {
+        std::lock_guard<std::recursive_mutex> lock(themeRenderersMutex);
+
         m_primary = primary;
         m_themeLoader->preload(primary);
 
+        m_reloadStatistics = {};
+
+        // Textures and fonts of the old theme may be used by other properties or renderers in the new theme
+        LoadedThemeResources loadedResources;
+        for (const auto& pair : m_renderers)
+        {
+            for (const auto& property : pair.second->propertyValuePairs)
+                addLoadedThemeResource(loadedResources, property.second);
+        }
+
         // Update the existing renderers
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            const auto oldData = renderer;
 
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
 
             auto& properties = m_themeLoader->load(m_primary, pair.first);
 
-            // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            // Update the property-value pairs of the renderer, keeping the old values when they didn't change
+            std::map<std::string, ObjectConverter> oldValues;
+            oldValues.swap(renderer->propertyValuePairs);
+
+            const auto oldLoadedPropertiesIt = m_loadedProperties.find(pair.first);
+            std::set<std::string> loadedProperties;
 
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
-            auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
+            std::vector<std::string> changedProperties;
+            for (const auto& property : properties)
             {
-                if (oldIt->first < newIt->first)
+                const std::string name = property.first;
+                loadedProperties.insert(name);
+
+                const auto oldIt = oldValues.find(name);
+                if (oldIt == oldValues.end())
                 {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
+                    renderer->propertyValuePairs[name] = ObjectConverter(property.second);
+                    changedProperties.push_back(name);
+                    continue;
+                }
 
-                    ++oldIt;
+                ObjectConverter newValue;
+                if (isThemeValueUnchanged(oldIt->second, property.second, newValue, loadedResources, m_reloadStatistics))
+                {
+                    renderer->propertyValuePairs[name] = std::move(oldIt->second);
+                    ++m_reloadStatistics.propertiesUnchanged;
                 }
                 else
                 {
-                    // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
-
-                    if (newIt->first < oldIt->first)
-                        ++newIt;
-                    else
-                    {
-                        ++oldIt;
-                        ++newIt;
-                    }
+                    renderer->propertyValuePairs[name] = std::move(newValue);
+                    changedProperties.push_back(name);
                 }
+
+                oldValues.erase(oldIt);
             }
-            while (oldIt != oldData->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
 
-                ++oldIt;
+            // Properties that no longer exist in the new renderer are now reset to their default value.
+            // Properties that weren't part of the old theme either are left untouched.
+            for (auto& oldValue : oldValues)
+            {
+                if ((oldLoadedPropertiesIt != m_loadedProperties.end()) && (oldLoadedPropertiesIt->second.count(oldValue.first) == 0))
+                    renderer->propertyValuePairs[oldValue.first] = std::move(oldValue.second);
+                else
+                    changedProperties.push_back(oldValue.first);
             }
-            while (newIt != renderer->propertyValuePairs.end())
+
+            m_loadedProperties[pair.first] = std::move(loadedProperties);
+
+            if (changedProperties.empty())
+                continue;
+
+            ++m_reloadStatistics.renderersChanged;
+            m_reloadStatistics.propertiesChanged += changedProperties.size();
+
+            // Tell the widgets that were using this renderer about the properties that changed
+            for (const auto& property : changedProperties)
             {
                 for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
-
-                ++newIt;
+                {
+                    observer.second(property);
+                    ++m_reloadStatistics.notifications;
+                }
             }
         }
+
+        if (!m_fontWarmUpCharacters.isEmpty())
+            warmUpThemeFonts(m_renderers, loadedResources, m_fontWarmUpCharacters, m_fontWarmUpBold, m_reloadStatistics);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Theme::ReloadStatistics& Theme::getReloadStatistics() const
+    {
+        return m_reloadStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Theme::setFontWarmUp(const sf::String& characters, bool includeBold)
+    {
+        m_fontWarmUpCharacters = characters;
+        m_fontWarmUpBold = includeBold;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -328,6 +571,8 @@ namespace tgui
     {
         std::string lowercaseSecondary = toLower(id);
 
+        std::lock_guard<std::recursive_mutex> lock(themeRenderersMutex);
+
         // If we already have this renderer in cache then just return it
         auto it = m_renderers.find(lowercaseSecondary);
         if (it != m_renderers.end())
@@ -335,8 +580,12 @@ namespace tgui
 
         m_renderers[lowercaseSecondary] = RendererData::create();
         auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
+        auto& loadedProperties = m_loadedProperties[lowercaseSecondary];
         for (const auto& property : properties)
+        {
             m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            loadedProperties.insert(property.first);
+        }
 
         return m_renderers[lowercaseSecondary];
     }
@@ -347,6 +596,8 @@ namespace tgui
     {
         std::string lowercaseSecondary = toLower(id);
 
+        std::lock_guard<std::recursive_mutex> lock(themeRenderersMutex);
+
         // If we already have this renderer in cache then just return it
         auto it = m_renderers.find(lowercaseSecondary);
         if (it != m_renderers.end())
@@ -358,8 +609,12 @@ namespace tgui
             return nullptr;
 
         auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
+        auto& loadedProperties = m_loadedProperties[lowercaseSecondary];
         for (const auto& property : properties)
+        {
             m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            loadedProperties.insert(property.first);
+        }
 
         return m_renderers[lowercaseSecondary];
     }
@@ -368,16 +623,20 @@ namespace tgui
 
     void Theme::addRenderer(const std::string& id, std::shared_ptr<RendererData> renderer)
     {
+        std::lock_guard<std::recursive_mutex> lock(themeRenderersMutex);
         m_renderers[toLower(id)] = renderer;
+        m_loadedProperties.erase(toLower(id));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Theme::removeRenderer(const std::string& id)
     {
+        std::lock_guard<std::recursive_mutex> lock(themeRenderersMutex);
         auto it = m_renderers.find(toLower(id));
         if (it != m_renderers.end())
         {
+            m_loadedProperties.erase(it->first);
             m_renderers.erase(it);
             return true;
         }
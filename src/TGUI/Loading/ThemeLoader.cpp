@@ -31,6 +31,7 @@
 #include <cassert>
 #include <sstream>
 #include <fstream>
+#include <mutex>
 #include <set>
 
 #ifdef SFML_SYSTEM_ANDROID
@@ -50,6 +51,13 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Themes can be loaded from multiple threads, the properties cache may only be accessed while this mutex is locked.
+        // The mutex is recursive because the load function calls preload.
+        std::recursive_mutex propertiesCacheMutex;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> DefaultThemeLoader::m_propertiesCache;
@@ -145,6 +153,8 @@ namespace tgui
 
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
+        std::lock_guard<std::recursive_mutex> lock(propertiesCacheMutex);
+
         if (filename != "")
         {
             auto propertiesCacheIt = m_propertiesCache.find(filename);
@@ -164,6 +174,8 @@ namespace tgui
         if (filename == "")
             return;
 
+        std::lock_guard<std::recursive_mutex> lock(propertiesCacheMutex);
+
         // Load the file when not already in cache
         if (m_propertiesCache.find(filename) == m_propertiesCache.end())
         {
@@ -220,6 +232,8 @@ namespace tgui
 
     const std::map<sf::String, sf::String>& DefaultThemeLoader::load(const std::string& filename, const std::string& section)
     {
+        std::lock_guard<std::recursive_mutex> lock(propertiesCacheMutex);
+
         preload(filename);
 
         const std::string lowercaseClassName = toLower(section);
@@ -240,8 +254,9 @@ namespace tgui
     {
         if (filename.empty())
             return true;
-        else
-            return m_propertiesCache[filename].find(toLower(section)) != m_propertiesCache[filename].end();
+
+        std::lock_guard<std::recursive_mutex> lock(propertiesCacheMutex);
+        return m_propertiesCache[filename].find(toLower(section)) != m_propertiesCache[filename].end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
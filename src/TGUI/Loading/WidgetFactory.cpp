@@ -39,6 +39,7 @@
 #include <TGUI/Widgets/Knob.hpp>
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/ListView.hpp>
 #include <TGUI/Widgets/MenuBar.hpp>
 #include <TGUI/Widgets/MessageBox.hpp>
 #include <TGUI/Widgets/Panel.hpp>
@@ -53,12 +54,21 @@
 #include <TGUI/Widgets/SpinButton.hpp>
 #include <TGUI/Widgets/Tabs.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/Widgets/TreeView.hpp>
 #include <TGUI/Widgets/VerticalLayout.hpp>
 
+#include <mutex>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Widgets can be loaded from multiple threads, so the construct functions are only accessed while this mutex is locked
+        std::mutex constructFunctionsMutex;
+    }
+
     std::map<std::string, std::function<Widget::Ptr()>> WidgetFactory::m_constructFunctions =
     {
         {"bitmapbutton", std::make_shared<BitmapButton>},
@@ -77,6 +87,7 @@ namespace tgui
         {"knob", std::make_shared<Knob>},
         {"label", std::make_shared<Label>},
         {"listbox", std::make_shared<ListBox>},
+        {"listview", std::make_shared<ListView>},
         {"menubar", std::make_shared<MenuBar>},
         {"messagebox", std::make_shared<MessageBox>},
         {"panel", std::make_shared<Panel>},
@@ -91,6 +102,7 @@ namespace tgui
         {"spinbutton", std::make_shared<SpinButton>},
         {"tabs", std::make_shared<Tabs>},
         {"textbox", std::make_shared<TextBox>},
+        {"treeview", std::make_shared<TreeView>},
         {"verticallayout", std::make_shared<VerticalLayout>}
     };
 
@@ -98,14 +110,24 @@ namespace tgui
 
     void WidgetFactory::setConstructFunction(const std::string& type, const std::function<Widget::Ptr()>& constructor)
     {
-        m_constructFunctions[toLower(type)] = constructor;
+        const std::string lowercaseType = toLower(type);
+
+        std::lock_guard<std::mutex> lock(constructFunctionsMutex);
+        m_constructFunctions[lowercaseType] = constructor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::function<Widget::Ptr()>& WidgetFactory::getConstructFunction(const std::string& type)
+    std::function<Widget::Ptr()> WidgetFactory::getConstructFunction(const std::string& type)
     {
-        return m_constructFunctions[toLower(type)];
+        const std::string lowercaseType = toLower(type);
+
+        std::lock_guard<std::mutex> lock(constructFunctionsMutex);
+        const auto it = m_constructFunctions.find(lowercaseType);
+        if (it != m_constructFunctions.end())
+            return it->second;
+        else
+            return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,13 +28,14 @@
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <atomic>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace
 {
-    unsigned int lastId = 0;
+    std::atomic<unsigned int> lastId{0};
 
     unsigned int generateUniqueId()
     {
@@ -58,7 +59,30 @@ namespace tgui
 {
     namespace internal_signal
     {
-        std::deque<const void*> parameters;
+        namespace
+        {
+            thread_local std::deque<const void*> threadParameters;
+        }
+
+        ParameterList parameters;
+
+        const void*& ParameterList::operator[](std::size_t index)
+        {
+            if (index >= threadParameters.size())
+                threadParameters.resize(index + 1);
+
+            return threadParameters[index];
+        }
+
+        std::size_t ParameterList::size() const
+        {
+            return threadParameters.size();
+        }
+
+        void ParameterList::resize(std::size_t size)
+        {
+            threadParameters.resize(size);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -128,7 +152,7 @@ namespace tgui
         if (unboundParameters.size() == 0)
             return 0;
         else
-            throw Exception{"Signal '" + m_name + "' could not provide data for unbound parameters."};
+            throw Exception{"Signal '" + m_name.getString() + "' could not provide data for unbound parameters."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
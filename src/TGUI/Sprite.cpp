@@ -27,7 +27,10 @@
 #include <TGUI/Color.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <map>
+#include <mutex>
 
 #ifdef TGUI_USE_CPP17
     #include <optional>
@@ -94,10 +97,6 @@ namespace tgui
     void Sprite::setColor(const Color& color)
     {
         m_vertexColor = color;
-
-        const sf::Color vertexColor = Color::calcColorOpacity(m_vertexColor, m_opacity);
-        for (auto& vertex : m_vertices)
-            vertex.color = vertexColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -112,7 +111,6 @@ namespace tgui
     void Sprite::setOpacity(float opacity)
     {
         m_opacity = opacity;
-        setColor(getColor());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,7 +169,7 @@ namespace tgui
         sf::Vector2u pixel;
         sf::IntRect middleRect = m_texture.getMiddleRect();
         const sf::Texture& texture = m_texture.getData()->texture;
-        switch (m_scalingType)
+        switch (getScalingType())
         {
             case ScalingType::Normal:
             {
@@ -252,51 +250,92 @@ namespace tgui
 
     Sprite::ScalingType Sprite::getScalingType() const
     {
-        return m_scalingType;
+        if (m_geometry)
+            return m_geometry->scalingType;
+        else
+            return ScalingType::Normal;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Sprite::updateVertices()
     {
+        m_geometry = getGeometry(m_texture.getImageSize(), FloatRect{sf::FloatRect{m_texture.getMiddleRect()}}, m_size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const Sprite::Geometry> Sprite::getGeometry(Vector2f textureSize, FloatRect middleRect, Vector2f size)
+    {
+        // Widgets of the same size that use the same texture (or textures of the same size) share their vertices
+        static std::map<std::array<float, 8>, std::weak_ptr<const Geometry>> cache;
+        static std::size_t cacheSizeAfterCleanup = 0;
+        static std::mutex cacheMutex; // Sprites can be created on multiple threads when widgets are loaded in the background
+
+        const std::array<float, 8> key{{textureSize.x, textureSize.y, middleRect.left, middleRect.top, middleRect.width, middleRect.height, size.x, size.y}};
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto& cachedGeometry = cache[key];
+        if (auto geometry = cachedGeometry.lock())
+            return geometry;
+
+        auto geometry = std::make_shared<Geometry>();
+        cachedGeometry = geometry;
+
+        // Remove geometry that is no longer used by any sprite, when the cache has doubled in size since the last cleanup
+        if (cache.size() > std::max<std::size_t>(64, 2 * cacheSizeAfterCleanup))
+        {
+            for (auto it = cache.begin(); it != cache.end();)
+            {
+                if (it->second.expired())
+                    it = cache.erase(it);
+                else
+                    ++it;
+            }
+
+            cacheSizeAfterCleanup = cache.size();
+        }
+
+        const sf::Color vertexColor = sf::Color::White;
+        auto& vertices = geometry->vertices;
+
         // Figure out how the image is scaled best
-        Vector2f textureSize{m_texture.getImageSize()};
-        FloatRect middleRect{sf::FloatRect{m_texture.getMiddleRect()}};
+        ScalingType& scalingType = geometry->scalingType;
         if (middleRect == FloatRect(0, 0, textureSize.x, textureSize.y))
         {
-            m_scalingType = ScalingType::Normal;
+            scalingType = ScalingType::Normal;
         }
         else if (middleRect.height == textureSize.y)
         {
-            if (m_size.x >= (textureSize.x - middleRect.width) * (m_size.y / textureSize.y))
-                m_scalingType = ScalingType::Horizontal;
+            if (size.x >= (textureSize.x - middleRect.width) * (size.y / textureSize.y))
+                scalingType = ScalingType::Horizontal;
             else
-                m_scalingType = ScalingType::Normal;
+                scalingType = ScalingType::Normal;
         }
         else if (middleRect.width == textureSize.x)
         {
-            if (m_size.y >= (textureSize.y - middleRect.height) * (m_size.x / textureSize.x))
-                m_scalingType = ScalingType::Vertical;
+            if (size.y >= (textureSize.y - middleRect.height) * (size.x / textureSize.x))
+                scalingType = ScalingType::Vertical;
             else
-                m_scalingType = ScalingType::Normal;
+                scalingType = ScalingType::Normal;
         }
         else
         {
-            if (m_size.x >= textureSize.x - middleRect.width)
+            if (size.x >= textureSize.x - middleRect.width)
             {
-                if (m_size.y >= textureSize.y - middleRect.height)
-                    m_scalingType = ScalingType::NineSlice;
+                if (size.y >= textureSize.y - middleRect.height)
+                    scalingType = ScalingType::NineSlice;
                 else
-                    m_scalingType = ScalingType::Horizontal;
+                    scalingType = ScalingType::Horizontal;
             }
-            else if (m_size.y >= (textureSize.y - middleRect.height) * (m_size.x / textureSize.x))
-                m_scalingType = ScalingType::Vertical;
+            else if (size.y >= (textureSize.y - middleRect.height) * (size.x / textureSize.x))
+                scalingType = ScalingType::Vertical;
             else
-                m_scalingType = ScalingType::Normal;
+                scalingType = ScalingType::Normal;
         }
 
         // Calculate the vertices based on the way we are scaling
-        switch (m_scalingType)
+        switch (scalingType)
         {
         case ScalingType::Normal:
             ///////////
@@ -304,11 +343,11 @@ namespace tgui
             // |   | //
             // 2---3 //
             ///////////
-            m_vertices.resize(4);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[3] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            geometry->vertexCount = 4;
+            vertices[0] = {{0, 0}, vertexColor, {0, 0}};
+            vertices[1] = {{size.x, 0}, vertexColor, {textureSize.x, 0}};
+            vertices[2] = {{0, size.y}, vertexColor, {0, textureSize.y}};
+            vertices[3] = {{size.x, size.y}, vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::Horizontal:
@@ -317,15 +356,15 @@ namespace tgui
             // |   |       |   | //
             // 1---3-------5---7 //
             ///////////////////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[2] = {{middleRect.left * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[3] = {{middleRect.left * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[4] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[5] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[6] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            geometry->vertexCount = 8;
+            vertices[0] = {{0, 0}, vertexColor, {0, 0}};
+            vertices[1] = {{0, size.y}, vertexColor, {0, textureSize.y}};
+            vertices[2] = {{middleRect.left * (size.y / textureSize.y), 0}, vertexColor, {middleRect.left, 0}};
+            vertices[3] = {{middleRect.left * (size.y / textureSize.y), size.y}, vertexColor, {middleRect.left, textureSize.y}};
+            vertices[4] = {{size.x - (textureSize.x - middleRect.left - middleRect.width) * (size.y / textureSize.y), 0}, vertexColor, {middleRect.left + middleRect.width, 0}};
+            vertices[5] = {{size.x - (textureSize.x - middleRect.left - middleRect.width) * (size.y / textureSize.y), size.y}, vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
+            vertices[6] = {{size.x, 0}, vertexColor, {textureSize.x, 0}};
+            vertices[7] = {{size.x, size.y}, vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::Vertical:
@@ -340,15 +379,15 @@ namespace tgui
             // |   | //
             // 6---7-//
             ///////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{m_size.x, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            geometry->vertexCount = 8;
+            vertices[0] = {{0, 0}, vertexColor, {0, 0}};
+            vertices[1] = {{size.x, 0}, vertexColor, {textureSize.x, 0}};
+            vertices[2] = {{0, middleRect.top * (size.x / textureSize.x)}, vertexColor, {0, middleRect.top}};
+            vertices[3] = {{size.x, middleRect.top * (size.x / textureSize.x)}, vertexColor, {textureSize.x, middleRect.top}};
+            vertices[4] = {{0, size.y - (textureSize.y - middleRect.top - middleRect.height) * (size.x / textureSize.x)}, vertexColor, {0, middleRect.top + middleRect.height}};
+            vertices[5] = {{size.x, size.y - (textureSize.y - middleRect.top - middleRect.height) * (size.x / textureSize.x)}, vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
+            vertices[6] = {{0, size.y}, vertexColor, {0, textureSize.y}};
+            vertices[7] = {{size.x, size.y}, vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::NineSlice:
@@ -363,64 +402,104 @@ namespace tgui
             // |    |              |     |  //
             // 6----7-------------8/20---21 //
             //////////////////////////////////
-            m_vertices.resize(22);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{middleRect.left, 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[2] = {{0, middleRect.top}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{middleRect.left, middleRect.top}, m_vertexColor, {middleRect.left, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{middleRect.left, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{middleRect.left, m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[8] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[9] = m_vertices[5];
-            m_vertices[10] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
-            m_vertices[11] = m_vertices[3];
-            m_vertices[12] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top}};
-            m_vertices[13] = m_vertices[1];
-            m_vertices[14] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[15] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[16] = m_vertices[12];
-            m_vertices[17] = {{m_size.x, middleRect.top}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[18] = m_vertices[10];
-            m_vertices[19] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[20] = m_vertices[8];
-            m_vertices[21] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            geometry->vertexCount = 22;
+            vertices[0] = {{0, 0}, vertexColor, {0, 0}};
+            vertices[1] = {{middleRect.left, 0}, vertexColor, {middleRect.left, 0}};
+            vertices[2] = {{0, middleRect.top}, vertexColor, {0, middleRect.top}};
+            vertices[3] = {{middleRect.left, middleRect.top}, vertexColor, {middleRect.left, middleRect.top}};
+            vertices[4] = {{0, size.y - (textureSize.y - middleRect.top - middleRect.height)}, vertexColor, {0, middleRect.top + middleRect.height}};
+            vertices[5] = {{middleRect.left, size.y - (textureSize.y - middleRect.top - middleRect.height)}, vertexColor, {middleRect.left, middleRect.top + middleRect.height}};
+            vertices[6] = {{0, size.y}, vertexColor, {0, textureSize.y}};
+            vertices[7] = {{middleRect.left, size.y}, vertexColor, {middleRect.left, textureSize.y}};
+            vertices[8] = {{size.x - (textureSize.x - middleRect.left - middleRect.width), size.y}, vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
+            vertices[9] = vertices[5];
+            vertices[10] = {{size.x - (textureSize.x - middleRect.left - middleRect.width), size.y - (textureSize.y - middleRect.top - middleRect.height)}, vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
+            vertices[11] = vertices[3];
+            vertices[12] = {{size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, vertexColor, {middleRect.left + middleRect.width, middleRect.top}};
+            vertices[13] = vertices[1];
+            vertices[14] = {{size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, vertexColor, {middleRect.left + middleRect.width, 0}};
+            vertices[15] = {{size.x, 0}, vertexColor, {textureSize.x, 0}};
+            vertices[16] = vertices[12];
+            vertices[17] = {{size.x, middleRect.top}, vertexColor, {textureSize.x, middleRect.top}};
+            vertices[18] = vertices[10];
+            vertices[19] = {{size.x, size.y - (textureSize.y - middleRect.top - middleRect.height)}, vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
+            vertices[20] = vertices[8];
+            vertices[21] = {{size.x, size.y}, vertexColor, {textureSize.x, textureSize.y}};
             break;
         };
+
+        return geometry;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Sprite::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        if (!isSet() || !m_geometry)
+            return;
+
         // A rotation can cause the image to be shifted, so we move it upfront so that it ends at the correct location
         if (getRotation() != 0)
         {
-            Vector2f pos = {getTransform().transformRect(FloatRect({}, getSize())).left,
-                            getTransform().transformRect(FloatRect({}, getSize())).top};
-
-            states.transform.translate(getPosition() - pos);
+            const sf::FloatRect rotatedRect = getTransform().transformRect(FloatRect({}, getSize()));
+            states.transform.translate(getPosition() - Vector2f{rotatedRect.left, rotatedRect.top});
         }
 
         states.transform *= getTransform();
 
-        if (isSet())
-        {
-            // Apply clipping when needed
+        // Apply clipping when needed
         #ifdef TGUI_USE_CPP17
-            std::optional<Clipping> clipping;
-            if (m_visibleRect != FloatRect{})
-                clipping.emplace(target, states, Vector2f{m_visibleRect.left, m_visibleRect.top}, Vector2f{m_visibleRect.width, m_visibleRect.height});
+        std::optional<Clipping> clipping;
+        if (m_visibleRect != FloatRect{})
+            clipping.emplace(target, states, Vector2f{m_visibleRect.left, m_visibleRect.top}, Vector2f{m_visibleRect.width, m_visibleRect.height});
         #else
-            std::unique_ptr<Clipping> clipping;
-            if (m_visibleRect != FloatRect{0, 0, 0, 0})
-                clipping = std::make_unique<Clipping>(target, states, Vector2f{m_visibleRect.left, m_visibleRect.top}, Vector2f{m_visibleRect.width, m_visibleRect.height});
+        std::unique_ptr<Clipping> clipping;
+        if (m_visibleRect != FloatRect{0, 0, 0, 0})
+            clipping = std::make_unique<Clipping>(target, states, Vector2f{m_visibleRect.left, m_visibleRect.top}, Vector2f{m_visibleRect.width, m_visibleRect.height});
         #endif
 
-            states.shader = m_texture.getData()->shader;
-            states.texture = &m_texture.getData()->texture;
-            target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+        states.shader = m_texture.getData()->shader;
+        states.texture = &m_texture.getData()->texture;
+
+        // The shared vertices are white, other colors are applied to a copy on the stack
+        const sf::Color vertexColor = Color::calcColorOpacity(m_vertexColor, m_opacity);
+        if (vertexColor == sf::Color::White)
+            target.draw(m_geometry->vertices.data(), m_geometry->vertexCount, sf::PrimitiveType::TrianglesStrip, states);
+        else
+        {
+            std::array<sf::Vertex, 22> vertices;
+            for (std::size_t i = 0; i < m_geometry->vertexCount; ++i)
+                vertices[i] = {m_geometry->vertices[i].position, vertexColor, m_geometry->vertices[i].texCoords};
+
+            target.draw(vertices.data(), m_geometry->vertexCount, sf::PrimitiveType::TrianglesStrip, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Sprite::addTriangles(std::vector<sf::Vertex>& vertices, Vector2f offset) const
+    {
+        if (!isSet() || !m_geometry || (m_geometry->vertexCount < 3))
+            return;
+
+        // The same shift as in the draw function is applied when the sprite is rotated
+        sf::Transform transform;
+        if (getRotation() != 0)
+        {
+            const sf::FloatRect rotatedRect = getTransform().transformRect(FloatRect({}, getSize()));
+            offset += getPosition() - Vector2f{rotatedRect.left, rotatedRect.top};
+        }
+        transform.translate(offset);
+        transform *= getTransform();
+
+        const sf::Color vertexColor = Color::calcColorOpacity(m_vertexColor, m_opacity);
+
+        // Every three consecutive vertices of the triangle strip form a triangle, the degenerate ones are harmless
+        vertices.reserve(vertices.size() + (m_geometry->vertexCount - 2) * 3);
+        for (std::size_t i = 2; i < m_geometry->vertexCount; ++i)
+        {
+            for (std::size_t j = i - 2; j <= i; ++j)
+                vertices.emplace_back(transform.transformPoint(m_geometry->vertices[j].position), vertexColor, m_geometry->vertices[j].texCoords);
         }
     }
 
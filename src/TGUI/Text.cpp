@@ -26,12 +26,106 @@
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <cmath>
+#include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        const char* const distanceFieldShaderSource = R"(
+            uniform sampler2D texture;
+
+            void main()
+            {
+                float distance = texture2D(texture, gl_TexCoord[0].xy).a;
+                float smoothing = max(fwidth(distance) * 0.7, 0.001);
+                float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+                gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);
+            }
+        )";
+    #endif
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the shader that renders glyphs from a distance field, or nullptr when shaders aren't supported
+        const sf::Shader* getDistanceFieldShader()
+        {
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            static std::unique_ptr<sf::Shader> shader;
+            static bool shaderLoaded = false;
+            if (!shaderLoaded)
+            {
+                shaderLoaded = true;
+                if (sf::Shader::isAvailable())
+                {
+                    shader = std::make_unique<sf::Shader>();
+                    if (shader->loadFromMemory(distanceFieldShaderSource, sf::Shader::Fragment))
+                        shader->setUniform("texture", sf::Shader::CurrentTexture);
+                    else
+                        shader = nullptr;
+                }
+            }
+
+            return shader.get();
+        #else
+            return nullptr;
+        #endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addDistanceFieldQuad(sf::VertexArray& vertices, Vector2f position, sf::Color color, const sf::Glyph& glyph, float scale, float italicShear)
+        {
+            const float left = glyph.bounds.left * scale;
+            const float top = glyph.bounds.top * scale;
+            const float right = (glyph.bounds.left + glyph.bounds.width) * scale;
+            const float bottom = (glyph.bounds.top + glyph.bounds.height) * scale;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left);
+            const float v1 = static_cast<float>(glyph.textureRect.top);
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width);
+            const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height);
+
+            vertices.append({{position.x + left - italicShear * top, position.y + top}, color, {u1, v1}});
+            vertices.append({{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}});
+            vertices.append({{position.x + left - italicShear * bottom, position.y + bottom}, color, {u1, v2}});
+            vertices.append({{position.x + left - italicShear * bottom, position.y + bottom}, color, {u1, v2}});
+            vertices.append({{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}});
+            vertices.append({{position.x + right - italicShear * bottom, position.y + bottom}, color, {u2, v2}});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addDistanceFieldLine(sf::VertexArray& vertices, float lineLength, float lineTop, sf::Color color, float offset, float thickness)
+        {
+            const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+            const float bottom = top + std::floor(thickness + 0.5f);
+
+            // The top left corner of the distance field texture lies completely inside a glyph
+            const sf::Vector2f texCoords{2, 2};
+
+            vertices.append({{0, top}, color, texCoords});
+            vertices.append({{lineLength, top}, color, texCoords});
+            vertices.append({{0, bottom}, color, texCoords});
+            vertices.append({{0, bottom}, color, texCoords});
+            vertices.append({{lineLength, top}, color, texCoords});
+            vertices.append({{lineLength, bottom}, color, texCoords});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Text::Text() :
+        m_data{getEmptyData()}
+    {
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Text::getSize() const
@@ -43,7 +137,13 @@ namespace tgui
 
     void Text::setString(const sf::String& string)
     {
-        m_text.setString(string);
+        // Don't stop sharing the data with other texts when nothing changes
+        if (string == m_data->text.getString())
+            return;
+
+        SharedData& data = getMutableData();
+        data.text.setString(string);
+        data.distanceFieldVerticesOutdated = true;
         recalculateSize();
     }
 
@@ -51,14 +151,19 @@ namespace tgui
 
     const sf::String& Text::getString() const
     {
-        return m_text.getString();
+        return m_data->text.getString();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::setCharacterSize(unsigned int size)
     {
-        m_text.setCharacterSize(size);
+        if (size == m_data->text.getCharacterSize())
+            return;
+
+        SharedData& data = getMutableData();
+        data.text.setCharacterSize(size);
+        data.distanceFieldVerticesOutdated = true;
         recalculateSize();
     }
 
@@ -66,19 +171,25 @@ namespace tgui
 
     unsigned int Text::getCharacterSize() const
     {
-        return m_text.getCharacterSize();
+        return m_data->text.getCharacterSize();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::setColor(Color color)
     {
+        if (color == m_color)
+            return;
+
         m_color = color;
 
+        SharedData& data = getMutableData();
+        data.distanceFieldVerticesOutdated = true;
+
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
+        data.text.setFillColor(Color::calcColorOpacity(color, m_opacity));
     #else
-        m_text.setColor(Color::calcColorOpacity(color, m_opacity));
+        data.text.setColor(Color::calcColorOpacity(color, m_opacity));
     #endif
     }
 
@@ -93,12 +204,18 @@ namespace tgui
 
     void Text::setOpacity(float opacity)
     {
+        if (opacity == m_opacity)
+            return;
+
         m_opacity = opacity;
 
+        SharedData& data = getMutableData();
+        data.distanceFieldVerticesOutdated = true;
+
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
+        data.text.setFillColor(Color::calcColorOpacity(m_color, opacity));
     #else
-        m_text.setColor(Color::calcColorOpacity(m_color, opacity));
+        data.text.setColor(Color::calcColorOpacity(m_color, opacity));
     #endif
     }
 
@@ -113,24 +230,34 @@ namespace tgui
 
     void Text::setFont(Font font)
     {
+        if (font == m_font)
+            return;
+
         m_font = font;
 
+        SharedData& data = getMutableData();
+        data.distanceFieldVerticesOutdated = true;
+
         if (font)
-            m_text.setFont(*font.getFont());
+            data.text.setFont(*font.getFont());
         else
         {
             // We can't keep using a pointer to the old font (it might be destroyed), but sf::Text has no function to pass an empty font
-            if (m_text.getFont())
+            if (data.text.getFont())
             {
-                m_text = sf::Text();
-                m_text.setString(getString());
-                m_text.setCharacterSize(getCharacterSize());
-                m_text.setStyle(getStyle());
+                const sf::String string = data.text.getString();
+                const unsigned int characterSize = data.text.getCharacterSize();
+                const sf::Uint32 style = data.text.getStyle();
+
+                data.text = sf::Text();
+                data.text.setString(string);
+                data.text.setCharacterSize(characterSize);
+                data.text.setStyle(style);
 
             #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-                m_text.setFillColor(Color::calcColorOpacity(getColor(), getOpacity()));
+                data.text.setFillColor(Color::calcColorOpacity(getColor(), getOpacity()));
             #else
-                m_text.setColor(Color::calcColorOpacity(getColor(), getOpacity()));
+                data.text.setColor(Color::calcColorOpacity(getColor(), getOpacity()));
             #endif
             }
         }
@@ -149,9 +276,11 @@ namespace tgui
 
     void Text::setStyle(TextStyle style)
     {
-        if (style != m_text.getStyle())
+        if (style != m_data->text.getStyle())
         {
-            m_text.setStyle(style);
+            SharedData& data = getMutableData();
+            data.text.setStyle(style);
+            data.distanceFieldVerticesOutdated = true;
             recalculateSize();
         }
     }
@@ -160,14 +289,54 @@ namespace tgui
 
     TextStyle Text::getStyle() const
     {
-        return m_text.getStyle();
+        return m_data->text.getStyle();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Text::findCharacterPos(std::size_t index) const
     {
-        return m_text.findCharacterPos(index);
+        if (!m_font || !m_font.isDistanceFieldEnabled())
+            return m_data->text.findCharacterPos(index);
+
+        // Use the scaled metrics of the font, sf::Text would rasterize the glyphs at the character size
+        const sf::String& string = m_data->text.getString();
+        index = std::min(index, string.getSize());
+
+        const unsigned int characterSize = m_data->text.getCharacterSize();
+        const bool bold = (m_data->text.getStyle() & sf::Text::Bold) != 0;
+        const float whitespaceWidth = m_font.getGlyph(' ', characterSize, bold).advance;
+        const float lineSpacing = m_font.getLineSpacing(characterSize);
+
+        Vector2f position;
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < index; ++i)
+        {
+            const std::uint32_t curChar = string[i];
+            position.x += m_font.getKerning(prevChar, curChar, characterSize);
+            prevChar = curChar;
+
+            if (curChar == ' ')
+                position.x += whitespaceWidth;
+            else if (curChar == '\t')
+                position.x += whitespaceWidth * 4;
+            else if (curChar == '\n')
+            {
+                position.y += lineSpacing;
+                position.x = 0;
+            }
+            else
+                position.x += m_font.getGlyph(curChar, characterSize, bold).advance;
+        }
+
+        return position;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Text::isSharingDataWith(const Text& other) const
+    {
+        return m_data == other.m_data;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,15 +351,124 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        if (m_font && m_font.isDistanceFieldEnabled())
+        {
+            const sf::Shader* shader = getDistanceFieldShader();
+            if (shader)
+            {
+                if (m_data->distanceFieldVerticesOutdated)
+                    updateDistanceFieldVertices();
+
+                states.texture = m_font.getDistanceFieldTexture();
+                states.shader = shader;
+                target.draw(m_data->distanceFieldVertices, states);
+                return;
+            }
+        }
+
+        target.draw(m_data->text, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::updateDistanceFieldVertices() const
+    {
+        m_data->distanceFieldVertices.clear();
+        m_data->distanceFieldVerticesOutdated = false;
+
+        const sf::String& string = m_data->text.getString();
+        if (string.isEmpty())
+            return;
+
+        const unsigned int characterSize = m_data->text.getCharacterSize();
+        const unsigned int style = m_data->text.getStyle();
+        const bool bold = (style & sf::Text::Bold) != 0;
+        const bool underlined = (style & sf::Text::Underlined) != 0;
+        const bool strikeThrough = (style & sf::Text::StrikeThrough) != 0;
+        const float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees
+
+        const unsigned int referenceSize = m_font.getDistanceFieldReferenceSize();
+        const float scale = static_cast<float>(characterSize) / referenceSize;
+        const sf::Color color = Color::calcColorOpacity(m_color, m_opacity);
+
+        m_font.loadDistanceFieldGlyphs(string, bold);
+
+        const float underlineOffset = m_font.getFont()->getUnderlinePosition(referenceSize) * scale;
+        const float underlineThickness = m_font.getFont()->getUnderlineThickness(referenceSize) * scale;
+        const sf::FloatRect xBounds = m_font.getGlyph('x', characterSize, bold).bounds;
+        const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+        const float whitespaceWidth = m_font.getGlyph(' ', characterSize, bold).advance;
+        const float lineSpacing = m_font.getLineSpacing(characterSize);
+
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            const std::uint32_t curChar = string[i];
+            x += m_font.getKerning(prevChar, curChar, characterSize);
+
+            if ((curChar == '\n') && (prevChar != '\n'))
+            {
+                if (underlined)
+                    addDistanceFieldLine(m_data->distanceFieldVertices, x, y, color, underlineOffset, underlineThickness);
+                if (strikeThrough)
+                    addDistanceFieldLine(m_data->distanceFieldVertices, x, y, color, strikeThroughOffset, underlineThickness);
+            }
+
+            prevChar = curChar;
+
+            if (curChar == ' ')
+                x += whitespaceWidth;
+            else if (curChar == '\t')
+                x += whitespaceWidth * 4;
+            else if (curChar == '\n')
+            {
+                y += lineSpacing;
+                x = 0;
+            }
+            else
+            {
+                const sf::Glyph& glyph = m_font.getDistanceFieldGlyph(curChar, bold);
+                if ((glyph.textureRect.width > 0) && (glyph.textureRect.height > 0))
+                    addDistanceFieldQuad(m_data->distanceFieldVertices, {x, y}, color, glyph, scale, italicShear);
+
+                x += glyph.advance * scale;
+            }
+        }
+
+        if (x > 0)
+        {
+            if (underlined)
+                addDistanceFieldLine(m_data->distanceFieldVertices, x, y, color, underlineOffset, underlineThickness);
+            if (strikeThrough)
+                addDistanceFieldLine(m_data->distanceFieldVertices, x, y, color, strikeThroughOffset, underlineThickness);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Text::SharedData& Text::getMutableData()
+    {
+        if (m_data.use_count() > 1)
+            m_data = std::make_shared<SharedData>(*m_data);
+
+        return *m_data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::shared_ptr<Text::SharedData>& Text::getEmptyData()
+    {
+        static const auto emptyData = std::make_shared<SharedData>();
+        return emptyData;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::recalculateSize()
     {
-        const std::shared_ptr<sf::Font> font = m_font;
-        if (font == nullptr)
+        if (m_font == nullptr)
         {
             m_size = {0, 0};
             return;
@@ -200,12 +478,12 @@ namespace tgui
         float maxWidth = 0;
         unsigned int lines = 1;
         std::uint32_t prevChar = 0;
-        const sf::String& string = m_text.getString();
-        const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
-        const unsigned int textSize = m_text.getCharacterSize();
+        const sf::String& string = m_data->text.getString();
+        const bool bold = (m_data->text.getStyle() & sf::Text::Bold) != 0;
+        const unsigned int textSize = m_data->text.getCharacterSize();
         for (std::size_t i = 0; i < string.getSize(); ++i)
         {
-            const float kerning = font->getKerning(prevChar, string[i], textSize);
+            const float kerning = m_font.getKerning(prevChar, string[i], textSize);
             if (string[i] == '\n')
             {
                 maxWidth = std::max(maxWidth, width);
@@ -213,15 +491,15 @@ namespace tgui
                 lines++;
             }
             else if (string[i] == '\t')
-                width += (static_cast<float>(font->getGlyph(' ', textSize, bold).advance) * 4) + kerning;
+                width += (static_cast<float>(m_font.getGlyph(' ', textSize, bold).advance) * 4) + kerning;
             else
-                width += static_cast<float>(font->getGlyph(string[i], textSize, bold).advance) + kerning;
+                width += static_cast<float>(m_font.getGlyph(string[i], textSize, bold).advance) + kerning;
 
             prevChar = string[i];
         }
 
-        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
-        const float height = lines * font->getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace;
+        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_data->text.getCharacterSize(), m_data->text.getStyle());
+        const float height = lines * m_font.getLineSpacing(m_data->text.getCharacterSize()) + extraVerticalSpace;
         m_size = {std::max(maxWidth, width), height};
     }
 
@@ -263,9 +541,8 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int Text::findBestTextSize(Font fontWrapper, float height, int fit)
+    unsigned int Text::findBestTextSize(Font font, float height, int fit)
     {
-        const std::shared_ptr<sf::Font> font = fontWrapper.getFont();
         if (!font)
             return 0;
 
@@ -277,16 +554,16 @@ namespace tgui
             textSizes[i] = i + 1;
 
         const auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height,
-                                           [&](unsigned int charSize, float h) { return font->getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(font, charSize) < h; });
+                                           [&](unsigned int charSize, float h) { return font.getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(font, charSize) < h; });
         if (high == textSizes.end())
             return static_cast<unsigned int>(height);
 
-        const float highLineSpacing = font->getLineSpacing(*high);
+        const float highLineSpacing = font.getLineSpacing(*high);
         if (highLineSpacing == height)
             return *high;
 
         const auto low = high - 1;
-        const float lowLineSpacing = font->getLineSpacing(*low);
+        const float lowLineSpacing = font.getLineSpacing(*low);
 
         if (fit < 0)
             return *low;
@@ -312,11 +589,11 @@ namespace tgui
 
         // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
         const float lineHeight = characterSize
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
+                                 + font.getGlyph('g', characterSize, bold).bounds.height
+                                 + font.getGlyph('g', characterSize, bold).bounds.top;
 
         // Get the line spacing sfml returns
-        const float lineSpacing = font.getFont()->getLineSpacing(characterSize);
+        const float lineSpacing = font.getLineSpacing(characterSize);
 
         // Calculate the offset of the text
         return lineHeight - lineSpacing;
@@ -348,11 +625,11 @@ namespace tgui
                     break;
                 }
                 else if (curChar == '\t')
-                    charWidth = font.getFont()->getGlyph(' ', textSize, bold).advance * 4;
+                    charWidth = font.getGlyph(' ', textSize, bold).advance * 4;
                 else
-                    charWidth = font.getFont()->getGlyph(curChar, textSize, bold).advance;
+                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
 
-                const float kerning = font.getFont()->getKerning(prevChar, curChar, textSize);
+                const float kerning = font.getKerning(prevChar, curChar, textSize);
                 if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
                 {
                     width += kerning + charWidth;
@@ -34,6 +34,21 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // The size is taken from the image when possible, because the texture isn't created yet when the texture was loaded
+        // on a thread that doesn't draw the gui
+        sf::Vector2u getTextureDataSize(const TextureData& data)
+        {
+            if (!data.image)
+                return data.texture.getSize();
+            else if (data.rect == sf::IntRect{})
+                return data.image->getSize();
+            else
+                return {static_cast<unsigned int>(data.rect.width), static_cast<unsigned int>(data.rect.height)};
+        }
+    }
+
     Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
     Texture::ImageLoaderFunc Texture::m_imageLoader = [](const sf::String& filename) -> std::unique_ptr<sf::Image>
         {
@@ -208,7 +223,7 @@ namespace tgui
     Vector2f Texture::getImageSize() const
     {
         if (m_data)
-            return sf::Vector2f{m_data->texture.getSize()};
+            return sf::Vector2f{getTextureDataSize(*m_data)};
         else
             return {0,0};
     }
@@ -342,7 +357,10 @@ namespace tgui
         m_data = data;
 
         if (middleRect == sf::IntRect{})
-            m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+        {
+            const sf::Vector2u size = getTextureDataSize(*m_data);
+            m_middleRect = {0, 0, static_cast<int>(size.x), static_cast<int>(size.y)};
+        }
         else
             m_middleRect = middleRect;
     }
@@ -27,16 +27,37 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <mutex>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Textures can be loaded from multiple threads, the image map may only be accessed while this mutex is locked
+        std::mutex imageMapMutex;
+
+        // When set, textures loaded on this thread are added to this list instead of being uploaded to the graphics card
+        thread_local std::vector<std::shared_ptr<TextureData>>* deferredUploadList = nullptr;
+
+        bool uploadTexture(TextureData& data)
+        {
+            if (data.rect == sf::IntRect{})
+                return data.texture.loadFromImage(*data.image);
+            else
+                return data.texture.loadFromImage(*data.image, data.rect);
+        }
+    }
+
     std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const std::string& filename, const sf::IntRect& partRect)
     {
+        std::lock_guard<std::mutex> lock(imageMapMutex);
+
         // Look if we already had this image
         auto imageIt = m_imageMap.find(filename);
         if (imageIt != m_imageMap.end())
@@ -53,6 +74,16 @@ namespace tgui
                     // Let the texture alert the texture manager when it is being copied or destroyed
                     texture.setCopyCallback(&TextureManager::copyTexture);
                     texture.setDestructCallback(&TextureManager::removeTexture);
+
+                    // The texture might have been loaded on another thread and still be waiting to be uploaded
+                    if (dataIt->data->image && (dataIt->data->texture.getSize() == sf::Vector2u{}))
+                    {
+                        if (deferredUploadList)
+                            deferredUploadList->push_back(dataIt->data);
+                        else
+                            uploadTexture(*dataIt->data);
+                    }
+
                     return dataIt->data;
                 }
             }
@@ -80,14 +111,15 @@ namespace tgui
         data->image = texture.getImageLoader()(filename);
         if (data->image != nullptr)
         {
-            // Create a texture from the image
-            bool loadFromImageSuccess;
-            if (partRect == sf::IntRect{})
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image);
-            else
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
+            // The texture will be created later when the image is being loaded on a thread that doesn't draw the gui
+            if (deferredUploadList)
+            {
+                deferredUploadList->push_back(data);
+                return data;
+            }
 
-            if (loadFromImageSuccess)
+            // Create a texture from the image
+            if (uploadTexture(*data))
                 return data;
             else
                 return nullptr;
@@ -102,6 +134,8 @@ namespace tgui
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
+        std::lock_guard<std::mutex> lock(imageMapMutex);
+
         // Loop all our textures to check if we already have this one
         for (auto& dataHolder : m_imageMap)
         {
@@ -124,6 +158,8 @@ namespace tgui
 
     void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
     {
+        std::lock_guard<std::mutex> lock(imageMapMutex);
+
         // Loop all our textures to check which one it is
         for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
         {
@@ -149,6 +185,26 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setDeferredUploadList(std::vector<std::shared_ptr<TextureData>>* pendingTextures)
+    {
+        deferredUploadList = pendingTextures;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::uploadDeferredTextures(const std::vector<std::shared_ptr<TextureData>>& pendingTextures)
+    {
+        std::lock_guard<std::mutex> lock(imageMapMutex);
+        for (const auto& data : pendingTextures)
+        {
+            // The same texture may be in the list multiple times or may already have been uploaded by getTexture
+            if (data->image && (data->texture.getSize() == sf::Vector2u{}))
+                uploadTexture(*data);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
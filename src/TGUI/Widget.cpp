@@ -76,10 +76,10 @@ namespace tgui
             m_renderer->unsubscribe(this);
 
         for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,12 +97,17 @@ namespace tgui
         m_parent                       {nullptr},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
-        m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {other.m_showAnimations},
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached}
     {
+        // The tool tip and animations are copied, the user data isn't
+        if (other.m_coldData && (other.m_coldData->toolTip || !other.m_coldData->showAnimations.empty()))
+        {
+            getColdData().toolTip = other.m_coldData->toolTip ? other.m_coldData->toolTip->clone() : nullptr;
+            getColdData().showAnimations = other.m_coldData->showAnimations;
+        }
+
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
@@ -136,11 +141,10 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
-        m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {std::move(other.m_showAnimations)},
         m_fontCached                   {std::move(other.m_fontCached)},
-        m_opacityCached                {std::move(other.m_opacityCached)}
+        m_opacityCached                {std::move(other.m_opacityCached)},
+        m_coldData                     {std::move(other.m_coldData)}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -185,12 +189,22 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
-            m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
-            m_showAnimations       = {};
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
 
+            // The tool tip is copied, the user data is kept
+            if (m_coldData)
+            {
+                m_coldData->toolTip = nullptr;
+                m_coldData->showAnimations.clear();
+            }
+            if (other.m_coldData && other.m_coldData->toolTip)
+                getColdData().toolTip = other.m_coldData->toolTip->clone();
+
+            // The widget no longer has a parent, so its absolute position has to be recalculated
+            invalidateAbsolutePosition();
+
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
@@ -234,12 +248,25 @@ namespace tgui
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
-            m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
-            m_showAnimations       = std::move(other.m_showAnimations);
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
 
+            // The tool tip and animations are taken from the other widget, the user data is kept
+            if (m_coldData)
+            {
+                m_coldData->toolTip = nullptr;
+                m_coldData->showAnimations.clear();
+            }
+            if (other.m_coldData)
+            {
+                getColdData().toolTip = std::move(other.m_coldData->toolTip);
+                getColdData().showAnimations = std::move(other.m_coldData->showAnimations);
+            }
+
+            // The widget no longer has a parent, so its absolute position has to be recalculated
+            invalidateAbsolutePosition();
+
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
@@ -362,6 +389,7 @@ namespace tgui
         if (getPosition() != m_prevPosition)
         {
             m_prevPosition = getPosition();
+            invalidateAbsolutePosition();
             onPositionChange.emit(this, getPosition());
 
             for (auto& layout : m_boundPositionLayouts)
@@ -398,10 +426,17 @@ namespace tgui
 
     Vector2f Widget::getAbsolutePosition() const
     {
-        if (m_parent)
-            return m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset() + getPosition();
-        else
-            return getPosition();
+        if (!m_absolutePositionCacheValid)
+        {
+            if (m_parent)
+                m_absolutePositionCached = m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset() + getPosition();
+            else
+                m_absolutePositionCached = getPosition();
+
+            m_absolutePositionCacheValid = true;
+        }
+
+        return m_absolutePositionCached;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -421,21 +456,21 @@ namespace tgui
         {
             case ShowAnimationType::Fade:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), 0.f, getInheritedOpacity(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                addAnimation(getColdData().showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), 0.f, getInheritedOpacity(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                 setInheritedOpacity(0);
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                addAnimation(getColdData().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
+                addAnimation(getColdData().showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                 setPosition(getPosition() + (getSize() / 2.f));
                 setSize(0, 0);
                 break;
             }
             case ShowAnimationType::SlideFromLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                addAnimation(getColdData().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                 setPosition({-getFullSize().x, getPosition().y});
                 break;
             }
@@ -443,7 +478,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                    addAnimation(getColdData().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                     setPosition({getParent()->getSize().x + getWidgetOffset().x, getPosition().y});
                 }
                 else
@@ -455,7 +490,7 @@ namespace tgui
             }
             case ShowAnimationType::SlideFromTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                addAnimation(getColdData().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                 setPosition({getPosition().x, -getFullSize().y});
                 break;
             }
@@ -463,7 +498,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                    addAnimation(getColdData().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                     setPosition({getPosition().x, getParent()->getSize().y + getWidgetOffset().y});
                 }
                 else
@@ -474,6 +509,8 @@ namespace tgui
                 break;
             }
         }
+
+        updateRequiredChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -488,14 +525,14 @@ namespace tgui
             case ShowAnimationType::Fade:
             {
                 float opacity = getInheritedOpacity();
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), getInheritedOpacity(), 0.f, duration,
+                addAnimation(getColdData().showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), getInheritedOpacity(), 0.f, duration,
                     [=](){ setVisible(false); setInheritedOpacity(opacity); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
+                addAnimation(getColdData().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
+                addAnimation(getColdData().showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
                     [=](){ setVisible(false); setPosition(position); setSize(size); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
@@ -503,7 +540,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
+                    addAnimation(getColdData().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
                         [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 }
                 else
@@ -513,7 +550,7 @@ namespace tgui
             }
             case ShowAnimationType::SlideToLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
+                addAnimation(getColdData().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
                     [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
@@ -521,7 +558,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
+                    addAnimation(getColdData().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
                         [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 }
                 else
@@ -531,11 +568,13 @@ namespace tgui
             }
             case ShowAnimationType::SlideToTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
+                addAnimation(getColdData().showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
                     [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
         }
+
+        updateRequiredChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -645,14 +684,18 @@ namespace tgui
 
     void Widget::setToolTip(Widget::Ptr toolTip)
     {
-        m_toolTip = toolTip;
+        if (toolTip || m_coldData)
+            getColdData().toolTip = toolTip;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Widget::getToolTip() const
     {
-        return m_toolTip;
+        if (m_coldData)
+            return m_coldData->toolTip;
+        else
+            return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -674,6 +717,7 @@ namespace tgui
     void Widget::setParent(Container* parent)
     {
         m_parent = parent;
+        invalidateAbsolutePosition();
 
         // Give the layouts another chance to find widgets to which it refers
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
@@ -688,13 +732,42 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
-        for (unsigned int i = 0; i < m_showAnimations.size();)
+        if (!m_coldData || m_coldData->showAnimations.empty())
+            return;
+
+        auto& showAnimations = m_coldData->showAnimations;
+        for (unsigned int i = 0; i < showAnimations.size();)
         {
-            if (m_showAnimations[i]->update(elapsedTime))
-                m_showAnimations.erase(m_showAnimations.begin() + i);
+            if (showAnimations[i]->update(elapsedTime))
+                showAnimations.erase(showAnimations.begin() + i);
             else
                 i++;
         }
+
+        if (showAnimations.empty())
+            updateRequiredChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isUpdateRequired() const
+    {
+        return m_coldData && !m_coldData->showAnimations.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateRequiredChanged()
+    {
+        if (m_parent)
+            m_parent->childUpdateRequiredChanged(*this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateAbsolutePosition()
+    {
+        m_absolutePositionCacheValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -767,7 +840,7 @@ namespace tgui
 
     Widget::Ptr Widget::askToolTip(Vector2f mousePos)
     {
-        if (m_toolTip && mouseOnWidget(mousePos))
+        if (m_coldData && m_coldData->toolTip && mouseOnWidget(mousePos))
             return getToolTip();
         else
             return nullptr;
@@ -1005,6 +1078,67 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::MemoryReport Widget::getMemoryReport() const
+    {
+        MemoryReport report;
+        addToMemoryReport(report);
+        return report;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::addToMemoryReport(MemoryReport& report) const
+    {
+        const std::size_t layoutBytes = m_position.x.getAllocatedMemory() + m_position.y.getAllocatedMemory()
+                                      + m_size.x.getAllocatedMemory() + m_size.y.getAllocatedMemory();
+
+        const std::size_t signalBytes = onPositionChange.getAllocatedMemory() + onSizeChange.getAllocatedMemory()
+                                      + onFocus.getAllocatedMemory() + onUnfocus.getAllocatedMemory()
+                                      + onMouseEnter.getAllocatedMemory() + onMouseLeave.getAllocatedMemory()
+                                      + onAnimationFinished.getAllocatedMemory();
+
+        // The buckets of an unordered_set are an array of pointers, each element is stored in a node together with a pointer
+        const std::size_t boundLayoutBytes = (m_boundPositionLayouts.bucket_count() + m_boundSizeLayouts.bucket_count()) * sizeof(void*)
+                                           + (m_boundPositionLayouts.size() + m_boundSizeLayouts.size()) * 2 * sizeof(void*);
+
+        // The renderer data itself is shared between widgets, only the renderer object belongs to this widget
+        const std::size_t rendererBytes = m_renderer ? sizeof(WidgetRenderer) : 0;
+
+        std::size_t coldDataBytes = 0;
+        if (m_coldData)
+            coldDataBytes = sizeof(ColdData) + m_coldData->showAnimations.capacity() * sizeof(std::shared_ptr<priv::Animation>);
+
+        report.subsystems["Widget"] += sizeof(Widget);
+        report.subsystems["Layouts"] += layoutBytes;
+        report.subsystems["Signals"] += signalBytes;
+        report.subsystems["Bound layouts"] += boundLayoutBytes;
+        report.subsystems["Renderer"] += rendererBytes;
+        report.subsystems["Cold data"] += coldDataBytes;
+
+        const std::size_t bytes = sizeof(Widget) + layoutBytes + signalBytes + boundLayoutBytes + rendererBytes + coldDataBytes;
+        auto& typeUsage = report.widgetTypes[getWidgetType()];
+        typeUsage.widgetCount++;
+        typeUsage.bytes += bytes;
+
+        report.widgetCount++;
+        report.totalBytes += bytes;
+
+        if (m_coldData && m_coldData->toolTip)
+            m_coldData->toolTip->addToMemoryReport(report);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::ColdData& Widget::getColdData()
+    {
+        if (!m_coldData)
+            m_coldData = std::make_unique<ColdData>();
+
+        return *m_coldData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::rendererChangedCallback(const std::string& property)
     {
         rendererChanged(property);
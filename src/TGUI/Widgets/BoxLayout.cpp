@@ -95,24 +95,28 @@ namespace tgui
 
             m_widgets.insert(m_widgets.begin() + index, widget);
             m_widgetNames.insert(m_widgetNames.begin() + index, widgetName);
+            updateWidgetIndices(index);
         }
         else // Just add the widget to the back
             Group::add(widget, widgetName);
 
-        updateWidgets();
+        // When multiple widgets are added at once, the widgets are only positioned after the last one was added
+        if (!m_changingWidgetsInBatch)
+            updateWidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BoxLayout::remove(const Widget::Ptr& widget)
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] == widget)
-                return remove(i);
-        }
+        if (!widget)
+            return false;
+
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index == m_widgets.size())
+            return false;
 
-        return false;
+        return remove(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,6 +144,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BoxLayout::widgetsChangedInBatch()
+    {
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BoxLayout::rendererChanged(const std::string& property)
     {
         if (property == "spacebetweenwidgets")
@@ -89,6 +89,54 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t BoxLayoutRatios::removeWidgets(const std::function<bool(const Widget::Ptr&)>& predicate)
+    {
+        // Remove the ratios first, the widgets are repositioned when the widgets are removed
+        std::vector<bool> removeFlags(m_widgets.size());
+        std::size_t newSize = 0;
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            removeFlags[i] = predicate(m_widgets[i]);
+            if (!removeFlags[i])
+                m_ratios[newSize++] = m_ratios[i];
+        }
+
+        m_ratios.resize(newSize);
+
+        std::size_t index = 0;
+        return BoxLayout::removeWidgets([&removeFlags,&index](const Widget::Ptr&){ return removeFlags[index++]; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BoxLayoutRatios::reorder(const std::vector<Widget::Ptr>& widgets)
+    {
+        if (widgets.size() != m_widgets.size())
+            return false;
+
+        std::vector<float> ratios(widgets.size());
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+        {
+            const std::size_t index = widgets[i] ? findWidgetIndex(widgets[i].get()) : m_widgets.size();
+            if (index == m_widgets.size())
+                return false;
+
+            ratios[i] = m_ratios[index];
+        }
+
+        // The ratios are changed first, because the widgets are repositioned when they are reordered
+        std::swap(m_ratios, ratios);
+        if (!BoxLayout::reorder(widgets))
+        {
+            std::swap(m_ratios, ratios);
+            return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BoxLayoutRatios::addSpace(float ratio)
     {
         insertSpace(m_widgets.size(), ratio);
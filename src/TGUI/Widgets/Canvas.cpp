@@ -24,11 +24,25 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Returns the new size of a texture that has to be able to contain at least the required amount of pixels.
+        // Textures grow in steps of 50% so that a canvas that is resized continuously doesn't create a texture every frame.
+        unsigned int getGrownTextureSize(unsigned int currentSize, unsigned int requiredSize)
+        {
+            if (requiredSize <= currentSize)
+                return currentSize;
+
+            return std::max(requiredSize, std::min(currentSize + currentSize / 2, sf::Texture::getMaximumSize()));
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Canvas::Canvas(const Layout2d& size)
@@ -41,7 +55,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Canvas::Canvas(const Canvas& other) :
-        ClickableWidget{other}
+        ClickableWidget{other},
+        m_autoClear    {other.m_autoClear}
     {
         setSize(other.getSize());
     }
@@ -49,7 +64,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Canvas::Canvas(Canvas&& other) :
-        ClickableWidget{std::move(other)}
+        ClickableWidget{std::move(other)},
+        m_autoClear    {std::move(other.m_autoClear)}
     {
         // sf::RenderTexture does not support move yet
         setSize(other.getSize());
@@ -62,6 +78,7 @@ namespace tgui
         if (this != &right)
         {
             ClickableWidget::operator=(right);
+            m_autoClear = right.m_autoClear;
             setSize(right.getSize());
         }
 
@@ -75,6 +92,7 @@ namespace tgui
         if (this != &right)
         {
             ClickableWidget::operator=(std::move(right));
+            m_autoClear = std::move(right.m_autoClear);
 
             // sf::RenderTexture does not support move yet
             setSize(right.getSize());
@@ -106,18 +124,139 @@ namespace tgui
     {
         Widget::setSize(size);
 
-        if (getSize() != Vector2f{})
+        const sf::Vector2u newSize{static_cast<unsigned int>(getSize().x), static_cast<unsigned int>(getSize().y)};
+        if ((newSize.x == 0) || (newSize.y == 0) || (newSize == m_canvasSize))
+            return;
+
+        const sf::Vector2u oldSize = m_canvasSize;
+        const sf::Vector2u textureSize = m_renderTexture.getSize();
+        if ((newSize.x <= textureSize.x) && (newSize.y <= textureSize.y) && (m_scrollOffset == sf::Vector2u{}))
+        {
+            // The texture is large enough and the canvas starts at the top left of it, so the contents can stay where they are
+            m_canvasSize = newSize;
+            if (m_autoClear)
+            {
+                if (newSize.x > oldSize.x)
+                    fillArea({static_cast<float>(oldSize.x), 0, static_cast<float>(newSize.x - oldSize.x), static_cast<float>(newSize.y)}, Color::Black);
+                if (newSize.y > oldSize.y)
+                    fillArea({0, static_cast<float>(oldSize.y), static_cast<float>(std::min(oldSize.x, newSize.x)), static_cast<float>(newSize.y - oldSize.y)}, Color::Black);
+            }
+        }
+        else
         {
-            m_renderTexture.create(static_cast<unsigned int>(getSize().x), static_cast<unsigned int>(getSize().y));
-            m_sprite.setTexture(m_renderTexture.getTexture(), true);
+            // Keep a copy of the current contents, they have to be moved to the top left of the (new) texture
+            std::array<Tile, 4> oldTiles;
+            const std::size_t oldTileCount = getTiles(oldTiles);
+
+            sf::Texture oldTexture;
+            if (oldTileCount > 0)
+            {
+                m_renderTexture.display();
+                oldTexture = m_renderTexture.getTexture();
+            }
+
+            if ((newSize.x > textureSize.x) || (newSize.y > textureSize.y))
+                m_renderTexture.create(getGrownTextureSize(textureSize.x, newSize.x), getGrownTextureSize(textureSize.y, newSize.y));
+
+            m_canvasSize = newSize;
+            m_scrollOffset = {};
+
+            if (m_autoClear || (oldTileCount == 0))
+                m_renderTexture.clear();
+
+            sf::RenderStates states;
+            states.blendMode = sf::BlendNone;
+            for (std::size_t i = 0; i < oldTileCount; ++i)
+            {
+                sf::Sprite oldContents{oldTexture, oldTiles[i].textureRect};
+                oldContents.setPosition(oldTiles[i].area.left, oldTiles[i].area.top);
+                draw(oldContents, states);
+            }
+        }
+
+        m_renderTexture.display();
+        m_sprite.setTexture(m_renderTexture.getTexture());
+        m_sprite.setTextureRect({0, 0, static_cast<int>(newSize.x), static_cast<int>(newSize.y)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::setAutoClear(bool autoClear)
+    {
+        m_autoClear = autoClear;
+    }
 
-            m_renderTexture.clear();
-            m_renderTexture.display();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Canvas::getAutoClear() const
+    {
+        return m_autoClear;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::scroll(Vector2f offset, Color fillColor)
+    {
+        if ((m_canvasSize.x == 0) || (m_canvasSize.y == 0))
+            return;
+
+        const int width = static_cast<int>(m_canvasSize.x);
+        const int height = static_cast<int>(m_canvasSize.y);
+        const int offsetX = static_cast<int>(std::round(offset.x));
+        const int offsetY = static_cast<int>(std::round(offset.y));
+
+        // Nothing remains visible when scrolling further than the size of the canvas
+        if ((std::abs(offsetX) >= width) || (std::abs(offsetY) >= height))
+        {
+            m_scrollOffset = {};
+            if (m_autoClear)
+                fillArea({0, 0, static_cast<float>(width), static_cast<float>(height)}, fillColor);
+
+            return;
+        }
+
+        // Instead of moving the pixels, the part of the texture where the canvas starts is moved in the opposite direction
+        m_scrollOffset.x = static_cast<unsigned int>((((static_cast<int>(m_scrollOffset.x) - offsetX) % width) + width) % width);
+        m_scrollOffset.y = static_cast<unsigned int>((((static_cast<int>(m_scrollOffset.y) - offsetY) % height) + height) % height);
+
+        if (m_autoClear)
+        {
+            if (offsetX < 0)
+                fillArea({static_cast<float>(width + offsetX), 0, static_cast<float>(-offsetX), static_cast<float>(height)}, fillColor);
+            else if (offsetX > 0)
+                fillArea({0, 0, static_cast<float>(offsetX), static_cast<float>(height)}, fillColor);
+
+            if (offsetY < 0)
+                fillArea({0, static_cast<float>(height + offsetY), static_cast<float>(width), static_cast<float>(-offsetY)}, fillColor);
+            else if (offsetY > 0)
+                fillArea({0, 0, static_cast<float>(width), static_cast<float>(offsetY)}, fillColor);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Canvas::updatePixels(const sf::Uint8* pixels, unsigned int width, unsigned int height, unsigned int x, unsigned int y)
+    {
+        if (!pixels || (width == 0) || (height == 0))
+            return;
+
+        const sf::Vector2u uploadSize = m_uploadTexture.getSize();
+        if ((width > uploadSize.x) || (height > uploadSize.y))
+            m_uploadTexture.create(getGrownTextureSize(uploadSize.x, width), getGrownTextureSize(uploadSize.y, height));
+
+        // Only the changed pixels are uploaded, the texture is then copied into the canvas on the graphics card
+        m_uploadTexture.update(pixels, width, height, 0, 0);
+
+        sf::Sprite sprite{m_uploadTexture, {0, 0, static_cast<int>(width), static_cast<int>(height)}};
+        sprite.setPosition(static_cast<float>(x), static_cast<float>(y));
+
+        sf::RenderStates states;
+        states.blendMode = sf::BlendNone;
+        draw(sprite, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Canvas::clear(Color color)
     {
         m_renderTexture.clear(color);
@@ -127,14 +266,26 @@ namespace tgui
 
     void Canvas::draw(const sf::Drawable& drawable, const sf::RenderStates& states)
     {
-        m_renderTexture.draw(drawable, states);
+        std::array<Tile, 4> tiles;
+        const std::size_t tileCount = getTiles(tiles);
+        for (std::size_t i = 0; i < tileCount; ++i)
+        {
+            setViewToTile(tiles[i]);
+            m_renderTexture.draw(drawable, states);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Canvas::draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
     {
-        m_renderTexture.draw(vertices, vertexCount, type, states);
+        std::array<Tile, 4> tiles;
+        const std::size_t tileCount = getTiles(tiles);
+        for (std::size_t i = 0; i < tileCount; ++i)
+        {
+            setViewToTile(tiles[i]);
+            m_renderTexture.draw(vertices, vertexCount, type, states);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,7 +310,23 @@ namespace tgui
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+
+        std::array<Tile, 4> tiles;
+        const std::size_t tileCount = getTiles(tiles);
+        if (tileCount == 1)
+        {
+            target.draw(m_sprite, states);
+            return;
+        }
+
+        // The canvas was scrolled, so it has to be drawn in multiple parts
+        for (std::size_t i = 0; i < tileCount; ++i)
+        {
+            sf::Sprite sprite = m_sprite;
+            sprite.setTextureRect(tiles[i].textureRect);
+            sprite.setPosition(tiles[i].area.left, tiles[i].area.top);
+            target.draw(sprite, states);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +337,85 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Canvas::getTiles(std::array<Tile, 4>& tiles) const
+    {
+        struct Segment
+        {
+            unsigned int position;
+            unsigned int texturePosition;
+            unsigned int length;
+        };
+
+        // Along each axis, the canvas is split in two when it was scrolled along that axis
+        const auto getSegments = [](unsigned int size, unsigned int offset, std::array<Segment, 2>& segments) -> std::size_t
+            {
+                if (offset == 0)
+                {
+                    segments[0] = {0, 0, size};
+                    return 1;
+                }
+
+                segments[0] = {0, offset, size - offset};
+                segments[1] = {size - offset, 0, offset};
+                return 2;
+            };
+
+        if ((m_canvasSize.x == 0) || (m_canvasSize.y == 0))
+            return 0;
+
+        std::array<Segment, 2> horizontalSegments;
+        std::array<Segment, 2> verticalSegments;
+        const std::size_t horizontalCount = getSegments(m_canvasSize.x, m_scrollOffset.x, horizontalSegments);
+        const std::size_t verticalCount = getSegments(m_canvasSize.y, m_scrollOffset.y, verticalSegments);
+
+        std::size_t tileCount = 0;
+        for (std::size_t y = 0; y < verticalCount; ++y)
+        {
+            for (std::size_t x = 0; x < horizontalCount; ++x)
+            {
+                const Segment& horiSegment = horizontalSegments[x];
+                const Segment& vertSegment = verticalSegments[y];
+                tiles[tileCount].area = {static_cast<float>(horiSegment.position), static_cast<float>(vertSegment.position),
+                                         static_cast<float>(horiSegment.length), static_cast<float>(vertSegment.length)};
+                tiles[tileCount].textureRect = {static_cast<int>(horiSegment.texturePosition), static_cast<int>(vertSegment.texturePosition),
+                                                static_cast<int>(horiSegment.length), static_cast<int>(vertSegment.length)};
+                ++tileCount;
+            }
+        }
+
+        return tileCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::setViewToTile(const Tile& tile)
+    {
+        // The view shows the part of the canvas that is stored in the tile, the viewport clips drawing to that part of the texture
+        const sf::Vector2f textureSize{m_renderTexture.getSize()};
+        sf::View view{tile.area};
+        view.setViewport({tile.textureRect.left / textureSize.x, tile.textureRect.top / textureSize.y,
+                          tile.textureRect.width / textureSize.x, tile.textureRect.height / textureSize.y});
+        m_renderTexture.setView(view);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Canvas::fillArea(FloatRect area, Color color)
+    {
+        const sf::Vertex vertices[] = {
+            {{area.left, area.top}, color},
+            {{area.left + area.width, area.top}, color},
+            {{area.left, area.top + area.height}, color},
+            {{area.left + area.width, area.top + area.height}, color}
+        };
+
+        sf::RenderStates states;
+        states.blendMode = sf::BlendNone;
+        draw(vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -714,6 +714,7 @@ namespace tgui
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
+            childWidgetsOffsetChanged();
         }
         else if (property == "titlecolor")
         {
@@ -727,15 +728,19 @@ namespace tgui
             m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
             if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
                 updateTitleBarHeight();
+
+            childWidgetsOffsetChanged();
         }
         else if (property == "titlebarheight")
         {
             m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
             updateTitleBarHeight();
+            childWidgetsOffsetChanged();
         }
         else if (property == "borderbelowtitlebar")
         {
             m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
+            childWidgetsOffsetChanged();
         }
         else if (property == "distancetoside")
         {
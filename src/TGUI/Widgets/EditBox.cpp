@@ -27,6 +27,10 @@
 #include <TGUI/Widgets/EditBox.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Clipping.hpp>
+#include <cctype>
+#include <cstdlib>
+#include <map>
+#include <mutex>
 
 /// TODO: Where m_selStart and m_selEnd are compared, use std::min and std::max and merge the if and else bodies
 
@@ -41,10 +45,213 @@ namespace tgui
     const std::string EditBox::Validator::Int   = "[+-]?[0-9]*";
     const std::string EditBox::Validator::UInt  = "[0-9]*";
     const std::string EditBox::Validator::Float = "[+-]?[0-9]*\\.?[0-9]*";
+    const std::string EditBox::Validator::Hex   = "[0-9a-fA-F]*";
 #endif
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // The text that would be the result of replacing a range of characters with a single character, without building it
+        struct EditedText
+        {
+            const sf::String& text;
+            std::size_t replaceStart;
+            std::size_t replaceEnd;
+            std::uint32_t insertedChar;
+
+            std::size_t size() const
+            {
+                return text.getSize() - (replaceEnd - replaceStart) + 1;
+            }
+
+            std::uint32_t operator[](std::size_t index) const
+            {
+                if (index < replaceStart)
+                    return text[index];
+                else if (index == replaceStart)
+                    return insertedChar;
+                else
+                    return text[index - 1 + replaceEnd - replaceStart];
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isSignCharacter(std::uint32_t c)
+        {
+            return (c == '+') || (c == '-');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isDigitCharacter(std::uint32_t c)
+        {
+            return (c >= '0') && (c <= '9');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Checks the entire text against the Int, UInt or Float validators
+        bool isValidNumber(const sf::String& text, bool allowSign, bool allowDecimalPoint)
+        {
+            bool decimalPointFound = false;
+            for (std::size_t i = 0; i < text.getSize(); ++i)
+            {
+                if (isDigitCharacter(text[i]) || ((i == 0) && allowSign && isSignCharacter(text[i])))
+                    continue;
+
+                if (allowDecimalPoint && (text[i] == '.') && !decimalPointFound)
+                {
+                    decimalPointFound = true;
+                    continue;
+                }
+
+                return false;
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isInCharacterRanges(const std::vector<std::pair<std::uint32_t, std::uint32_t>>& ranges, std::uint32_t c)
+        {
+            for (const auto& range : ranges)
+            {
+                if ((c >= range.first) && (c <= range.second))
+                    return true;
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads a single character inside a bracket expression. Returns false when it isn't a plain ASCII character.
+        bool readCharacterSetCharacter(const std::string& regex, std::size_t& index, std::uint32_t& character)
+        {
+            if (index >= regex.size())
+                return false;
+
+            char c = regex[index];
+            if (c == '\\')
+            {
+                // Escapes like \d or \w are character classes instead of characters
+                if ((index + 1 >= regex.size()) || std::isalnum(static_cast<unsigned char>(regex[index + 1])))
+                    return false;
+
+                c = regex[index + 1];
+                index += 2;
+            }
+            else if ((c == '[') || (c == ']'))
+                return false;
+            else
+                ++index;
+
+            if (static_cast<unsigned char>(c) >= 128)
+                return false;
+
+            character = static_cast<unsigned char>(c);
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Parses regexes of the form "[...]*" and "[...]{0,n}". Returns false when the regex has any other form.
+        bool parseCharacterSetRegex(const std::string& regex, std::vector<std::pair<std::uint32_t, std::uint32_t>>& ranges, std::size_t& maxLength)
+        {
+            if ((regex.size() < 3) || (regex[0] != '[') || (regex[1] == '^') || (regex[1] == ']'))
+                return false;
+
+            ranges.clear();
+            std::size_t index = 1;
+            while ((index < regex.size()) && (regex[index] != ']'))
+            {
+                std::uint32_t first;
+                if (!readCharacterSetCharacter(regex, index, first))
+                    return false;
+
+                std::uint32_t last = first;
+                if ((index + 1 < regex.size()) && (regex[index] == '-') && (regex[index + 1] != ']'))
+                {
+                    ++index;
+                    if (!readCharacterSetCharacter(regex, index, last) || (last < first))
+                        return false;
+                }
+
+                ranges.emplace_back(first, last);
+            }
+
+            if (index >= regex.size())
+                return false;
+
+            const std::string quantifier = regex.substr(index + 1);
+            if (quantifier == "*")
+            {
+                maxLength = 0;
+                return true;
+            }
+            else if ((quantifier.size() > 4) && (quantifier.size() < 12) && (quantifier.compare(0, 3, "{0,") == 0) && (quantifier.back() == '}'))
+            {
+                const std::string number = quantifier.substr(3, quantifier.size() - 4);
+                if (number.find_first_not_of("0123456789") != std::string::npos)
+                    return false;
+
+                maxLength = std::strtoul(number.c_str(), nullptr, 10);
+                return (maxLength > 0);
+            }
+            else
+                return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Regexes are compiled only once and shared between all edit boxes that use them
+        std::shared_ptr<const std::regex> getCompiledRegex(const std::string& regex)
+        {
+            static std::mutex compiledRegexesMutex; // Edit boxes can be created on multiple threads when widgets are loaded in the background
+            static std::map<std::string, std::weak_ptr<const std::regex>> compiledRegexes;
+
+            {
+                std::lock_guard<std::mutex> lock(compiledRegexesMutex);
+                auto it = compiledRegexes.find(regex);
+                if (it != compiledRegexes.end())
+                {
+                    if (auto compiledRegex = it->second.lock())
+                        return compiledRegex;
+                }
+            }
+
+            // The regex is compiled without holding the lock, as this can take a while
+            auto compiledRegex = std::make_shared<const std::regex>(regex);
+
+            std::lock_guard<std::mutex> lock(compiledRegexesMutex);
+
+            // Another thread may have compiled the same regex in the meantime
+            auto it = compiledRegexes.find(regex);
+            if (it != compiledRegexes.end())
+            {
+                if (auto otherCompiledRegex = it->second.lock())
+                    return otherCompiledRegex;
+            }
+
+            // Forget about regexes that are no longer used by any edit box
+            for (auto regexIt = compiledRegexes.begin(); regexIt != compiledRegexes.end();)
+            {
+                if (regexIt->second.expired())
+                    regexIt = compiledRegexes.erase(regexIt);
+                else
+                    ++regexIt;
+            }
+
+            compiledRegexes[regex] = compiledRegex;
+            return compiledRegex;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     EditBox::EditBox()
     {
         m_type = "EditBox";
@@ -165,17 +372,22 @@ namespace tgui
         }
 
         // Change the text if allowed
-        if (m_regexString == ".*")
+        if (m_validatorType == ValidatorType::All)
             m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
-        else // Clear the text
+        else if (!isAcceptedByValidator(text)) // Clear the text
             m_text = "";
+        else if (m_validatorType == ValidatorType::Regex)
+            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
+        else
+            m_text = text;
 
         // Remove all the excess characters if there is a character limit
         if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
             m_text.erase(m_maxChars, sf::String::InvalidPos);
 
+        // Find the decimal point once, it is kept up-to-date when characters are typed or removed afterwards
+        m_decimalPointPosition = m_text.find(".");
+
         // Set the displayed text
         if (m_passwordChar != '\0')
         {
@@ -206,7 +418,7 @@ namespace tgui
                 sf::String displayedString = m_textFull.getString();
                 displayedString.erase(displayedString.getSize()-1);
                 m_textFull.setString(displayedString);
-                m_text.erase(m_text.getSize()-1);
+                eraseCharacters(m_text.getSize()-1, 1);
             }
 
             m_textBeforeSelection.setString(m_textFull.getString());
@@ -316,7 +528,7 @@ namespace tgui
             sf::String displayedText = m_textFull.getString();
 
             // Remove all the excess characters
-            m_text.erase(m_maxChars, sf::String::InvalidPos);
+            eraseCharacters(m_maxChars, sf::String::InvalidPos);
             displayedText.erase(m_maxChars, sf::String::InvalidPos);
 
             // If we passed here then the text has changed.
@@ -371,7 +583,7 @@ namespace tgui
                 sf::String displayedString = m_textFull.getString();
                 displayedString.erase(displayedString.getSize()-1);
                 m_textFull.setString(displayedString);
-                m_text.erase(m_text.getSize()-1);
+                eraseCharacters(m_text.getSize()-1, 1);
             }
 
             m_textBeforeSelection.setString(m_textFull.getString());
@@ -431,9 +643,26 @@ namespace tgui
 
     void EditBox::setInputValidator(const std::string& regex)
     {
-        m_regexString = regex;
-        m_regex = m_regexString;
+        if (regex == Validator::All)
+            m_validatorType = ValidatorType::All;
+        else if (regex == Validator::Int)
+            m_validatorType = ValidatorType::Int;
+        else if (regex == Validator::UInt)
+            m_validatorType = ValidatorType::UInt;
+        else if (regex == Validator::Float)
+            m_validatorType = ValidatorType::Float;
+        else if (parseCharacterSetRegex(regex, m_validatorCharacterRanges, m_validatorMaxLength))
+            m_validatorType = ValidatorType::CharacterSet;
+        else
+        {
+            m_regex = getCompiledRegex(regex);
+            m_validatorType = ValidatorType::Regex;
+        }
+
+        if (m_validatorType != ValidatorType::Regex)
+            m_regex = nullptr;
 
+        m_regexString = regex;
         setText(m_text);
     }
 
@@ -465,6 +694,7 @@ namespace tgui
     #endif
 
         Widget::setFocused(focused);
+        updateRequiredChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -521,6 +751,7 @@ namespace tgui
 
             // If the next click comes soon enough then it will be a double click
             m_possibleDoubleClick = true;
+            updateRequiredChanged();
         }
 
         // Set the mouse down flag
@@ -743,7 +974,7 @@ namespace tgui
                     sf::String displayedString = m_textFull.getString();
                     displayedString.erase(m_selEnd-1, 1);
                     m_textFull.setString(displayedString);
-                    m_text.erase(m_selEnd-1, 1);
+                    eraseCharacters(m_selEnd-1, 1);
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd - 1);
@@ -782,7 +1013,7 @@ namespace tgui
                     sf::String displayedString = m_textFull.getString();
                     displayedString.erase(m_selEnd, 1);
                     m_textFull.setString(displayedString);
-                    m_text.erase(m_selEnd, 1);
+                    eraseCharacters(m_selEnd, 1);
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd);
@@ -827,10 +1058,9 @@ namespace tgui
 
                         const std::size_t oldCaretPos = m_selEnd;
 
-                        if (m_text.getSize() > m_selEnd)
-                            setText(m_text.toWideString().substr(0, m_selEnd) + Clipboard::get() + m_text.toWideString().substr(m_selEnd, m_text.getSize() - m_selEnd));
-                        else
-                            setText(m_text + clipboardContents);
+                        sf::String text = m_text;
+                        text.insert(m_selEnd, clipboardContents);
+                        setText(text);
 
                         setCaretPosition(oldCaretPos + clipboardContents.getSize());
                     }
@@ -877,24 +1107,10 @@ namespace tgui
         if (m_readOnly)
             return;
 
-        // Only add the character when the regex matches
-        if (m_regexString != ".*")
-        {
-            sf::String text = m_text;
-
-            if (m_selChars == 0)
-                text.insert(m_selEnd, key);
-            else
-            {
-                const std::size_t pos = std::min(m_selStart, m_selEnd);
-                text.erase(pos, m_selChars);
-                text.insert(pos, key);
-            }
-
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
-                return;
-        }
+        // Only add the character when the input validator accepts it
+        const std::size_t replaceStart = (m_selChars > 0) ? std::min(m_selStart, m_selEnd) : m_selEnd;
+        if (!canReplaceCharacters(replaceStart, replaceStart + m_selChars, key))
+            return;
 
         // If there are selected characters then delete them first
         if (m_selChars > 0)
@@ -906,15 +1122,21 @@ namespace tgui
 
         // Insert our character
         m_text.insert(m_selEnd, key);
+        if (key == '.')
+            m_decimalPointPosition = m_selEnd;
+        else if ((m_decimalPointPosition != sf::String::InvalidPos) && (m_decimalPointPosition >= m_selEnd))
+            ++m_decimalPointPosition;
 
-        // Change the displayed text
-        sf::String displayedText = m_textFull.getString();
+        // Change the displayed text. Without password character the displayed text is identical to m_text, so there is no need
+        // to make a copy of the old displayed text first.
         if (m_passwordChar != '\0')
+        {
+            sf::String displayedText = m_textFull.getString();
             displayedText.insert(m_selEnd, m_passwordChar);
+            m_textFull.setString(displayedText);
+        }
         else
-            displayedText.insert(m_selEnd, key);
-
-        m_textFull.setString(displayedText);
+            m_textFull.setString(m_text);
 
         // When there is a text width limit then reverse what we just did
         if (m_limitTextWidth)
@@ -923,9 +1145,17 @@ namespace tgui
             if (getFullTextWidth() > getVisibleEditBoxWidth())
             {
                 // If the text does not fit in the EditBox then delete the added character
-                m_text.erase(m_selEnd, 1);
-                displayedText.erase(m_selEnd, 1);
-                m_textFull.setString(displayedText);
+                eraseCharacters(m_selEnd, 1);
+
+                if (m_passwordChar != '\0')
+                {
+                    sf::String displayedText = m_textFull.getString();
+                    displayedText.erase(m_selEnd, 1);
+                    m_textFull.setString(displayedText);
+                }
+                else
+                    m_textFull.setString(m_text);
+
                 return;
             }
         }
@@ -1116,6 +1346,8 @@ namespace tgui
                 node->propertyValuePairs["InputValidator"] = std::make_unique<DataIO::ValueNode>("UInt");
             else if (getInputValidator() == EditBox::Validator::Float)
                 node->propertyValuePairs["InputValidator"] = std::make_unique<DataIO::ValueNode>("Float");
+            else if (getInputValidator() == EditBox::Validator::Hex)
+                node->propertyValuePairs["InputValidator"] = std::make_unique<DataIO::ValueNode>("Hex");
             else
                 node->propertyValuePairs["InputValidator"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(sf::String{getInputValidator()}));
         }
@@ -1177,6 +1409,8 @@ namespace tgui
                 setInputValidator(EditBox::Validator::UInt);
             else if (toLower(node->propertyValuePairs["inputvalidator"]->value) == "float")
                 setInputValidator(EditBox::Validator::Float);
+            else if (toLower(node->propertyValuePairs["inputvalidator"]->value) == "hex")
+                setInputValidator(EditBox::Validator::Hex);
             else
                 setInputValidator(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["inputvalidator"]->value).getString());
         }
@@ -1282,7 +1516,7 @@ namespace tgui
         sf::String displayedString = m_textFull.getString();
         displayedString.erase(pos, m_selChars);
         m_textFull.setString(displayedString);
-        m_text.erase(pos, m_selChars);
+        eraseCharacters(pos, m_selChars);
 
         // Set the caret back on the correct position
         setCaretPosition(pos);
@@ -1301,6 +1535,118 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::eraseCharacters(std::size_t pos, std::size_t count)
+    {
+        if ((m_decimalPointPosition != sf::String::InvalidPos) && (m_decimalPointPosition >= pos))
+        {
+            if (m_decimalPointPosition - pos < count)
+                m_decimalPointPosition = sf::String::InvalidPos;
+            else
+                m_decimalPointPosition -= count;
+        }
+
+        m_text.erase(pos, count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EditBox::isAcceptedByValidator(const sf::String& text)
+    {
+        switch (m_validatorType)
+        {
+        case ValidatorType::All:
+            return true;
+        case ValidatorType::Int:
+            return isValidNumber(text, true, false);
+        case ValidatorType::UInt:
+            return isValidNumber(text, false, false);
+        case ValidatorType::Float:
+            return isValidNumber(text, true, true);
+        case ValidatorType::CharacterSet:
+        {
+            if ((m_validatorMaxLength > 0) && (text.getSize() > m_validatorMaxLength))
+                return false;
+
+            for (const auto c : text)
+            {
+                if (!isInCharacterRanges(m_validatorCharacterRanges, c))
+                    return false;
+            }
+
+            return true;
+        }
+        case ValidatorType::Regex:
+        {
+            m_regexBuffer.clear();
+            for (const auto c : text)
+                m_regexBuffer.push_back((c < 128) ? static_cast<char>(c) : '\0');
+
+            return std::regex_match(m_regexBuffer, *m_regex);
+        }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EditBox::canReplaceCharacters(std::size_t start, std::size_t end, std::uint32_t key)
+    {
+        const EditedText editedText{m_text, start, end, key};
+
+        // Removing characters from an accepted text keeps it accepted for all validators except regexes, so apart from the regex
+        // only the inserted character and the characters directly around it have to be checked.
+        switch (m_validatorType)
+        {
+        case ValidatorType::All:
+            return true;
+
+        case ValidatorType::Int:
+        case ValidatorType::UInt:
+        case ValidatorType::Float:
+        {
+            // Nothing can be inserted in front of the sign
+            if ((start == 0) && (editedText.size() > 1) && isSignCharacter(editedText[1]))
+                return false;
+
+            if (isDigitCharacter(key))
+                return true;
+            else if (isSignCharacter(key))
+                return (m_validatorType != ValidatorType::UInt) && (start == 0);
+            else if ((key == '.') && (m_validatorType == ValidatorType::Float))
+            {
+                // A decimal point can only be added if the existing one (if any) is being replaced
+                return (m_decimalPointPosition == sf::String::InvalidPos)
+                    || ((m_decimalPointPosition >= start) && (m_decimalPointPosition < end));
+            }
+            else
+                return false;
+        }
+
+        case ValidatorType::CharacterSet:
+        {
+            if ((m_validatorMaxLength > 0) && (editedText.size() > m_validatorMaxLength))
+                return false;
+
+            return isInCharacterRanges(m_validatorCharacterRanges, key);
+        }
+
+        case ValidatorType::Regex:
+        {
+            // The buffer keeps its memory between calls. Unicode characters can't be matched by the regex.
+            m_regexBuffer.clear();
+            for (std::size_t i = 0; i < editedText.size(); ++i)
+                m_regexBuffer.push_back((editedText[i] < 128) ? static_cast<char>(editedText[i]) : '\0');
+
+            return std::regex_match(m_regexBuffer, *m_regex);
+        }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::recalculateTextPositions()
     {
         const float textOffset = Text::getExtraHorizontalPadding(m_textFull);
@@ -1456,11 +1802,22 @@ namespace tgui
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
+
+            // The caret no longer has to blink when the widget was unfocused
+            if (!isUpdateRequired())
+                updateRequiredChanged();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isUpdateRequired() const
+    {
+        return m_focused || m_possibleDoubleClick || Widget::isUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
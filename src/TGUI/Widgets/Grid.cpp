@@ -239,6 +239,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t Grid::removeWidgets(const std::function<bool(const Widget::Ptr&)>& predicate)
+    {
+        std::vector<Widget::Ptr> widgetsToRemove;
+        for (const auto& widget : m_widgets)
+        {
+            if (predicate(widget))
+                widgetsToRemove.push_back(widget);
+        }
+
+        for (const auto& widget : widgetsToRemove)
+            remove(widget);
+
+        return widgetsToRemove.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Grid::removeAllWidgets()
     {
         Container::removeAllWidgets();
@@ -141,6 +141,7 @@ namespace tgui
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
+            childWidgetsOffsetChanged();
         }
         else
             Container::rendererChanged(property);
@@ -264,6 +264,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                updateRequiredChanged();
             }
         }
     }
@@ -409,11 +410,19 @@ namespace tgui
         {
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
+            updateRequiredChanged();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Label::isUpdateRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::rearrangeText()
     {
         m_lines.clear();
@@ -552,6 +552,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                updateRequiredChanged();
             }
         }
 
@@ -961,11 +962,19 @@ namespace tgui
         {
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
+            updateRequiredChanged();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::isUpdateRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -0,0 +1,1237 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Widgets/ListView.hpp>
+#include <TGUI/Clipping.hpp>
+#include <cstdint>
+#include <limits>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListView::ListView()
+    {
+        m_type = "ListView";
+
+        m_draggableWidget = true;
+
+        // Rotate the horizontal scrollbar
+        m_horizontalScroll->setSize(m_horizontalScroll->getSize().y, m_horizontalScroll->getSize().x);
+
+        m_renderer = aurora::makeCopied<ListViewRenderer>();
+        setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
+
+        setTextSize(getGlobalTextSize());
+
+        const float lineHeight = Text::getLineHeight(m_fontCached, m_textSize, m_textStyleCached);
+        setRowHeight(static_cast<unsigned int>(lineHeight * 1.25f));
+        setHeaderHeight(static_cast<unsigned int>(lineHeight * 1.5f));
+        setSize({lineHeight * 20,
+                 (m_rowHeight * 10) + m_headerHeight + m_paddingCached.getTop() + m_paddingCached.getBottom() + m_bordersCached.getTop() + m_bordersCached.getBottom()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListView::Ptr ListView::create()
+    {
+        return std::make_shared<ListView>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListView::Ptr ListView::copy(ListView::ConstPtr listView)
+    {
+        if (listView)
+            return std::static_pointer_cast<ListView>(listView->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListViewRenderer* ListView::getSharedRenderer()
+    {
+        return aurora::downcast<ListViewRenderer*>(Widget::getSharedRenderer());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListViewRenderer* ListView::getSharedRenderer() const
+    {
+        return aurora::downcast<const ListViewRenderer*>(Widget::getSharedRenderer());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListViewRenderer* ListView::getRenderer()
+    {
+        return aurora::downcast<ListViewRenderer*>(Widget::getRenderer());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListViewRenderer* ListView::getRenderer() const
+    {
+        return aurora::downcast<const ListViewRenderer*>(Widget::getRenderer());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setSize(const Layout2d& size)
+    {
+        Widget::setSize(size);
+
+        m_bordersCached.updateParentSize(getSize());
+        m_paddingCached.updateParentSize(getSize());
+
+        m_spriteBackground.setSize(getInnerSize());
+
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::addColumn(const sf::String& caption, float width)
+    {
+        Column column;
+        column.caption.setFont(m_fontCached);
+        column.caption.setColor(m_headerTextColorCached);
+        column.caption.setOpacity(m_opacityCached);
+        column.caption.setStyle(m_textStyleCached);
+        column.caption.setCharacterSize(m_textSize);
+        column.caption.setString(caption);
+        column.width = std::max(0.f, width);
+        m_columns.push_back(std::move(column));
+
+        updateScrollbars();
+        return m_columns.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setColumnWidth(std::size_t index, float width)
+    {
+        if (index >= m_columns.size())
+            return;
+
+        m_columns[index].width = std::max(0.f, width);
+
+        // The cells to the right of the column have moved, so they are all created again
+        updateScrollbars();
+        updateVisibleCells(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ListView::getColumnWidth(std::size_t index) const
+    {
+        if (index < m_columns.size())
+            return m_columns[index].width;
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ListView::getColumnCaption(std::size_t index) const
+    {
+        if (index < m_columns.size())
+            return m_columns[index].caption.getString();
+        else
+            return "";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getColumnCount() const
+    {
+        return m_columns.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::removeAllColumns()
+    {
+        m_columns.clear();
+        m_sortColumn = -1;
+        m_mouseDownOnHeaderColumn = -1;
+
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setDataProvider(const DataProvider& provider, std::size_t rowCount)
+    {
+        m_dataProvider = provider;
+        m_sortColumn = -1;
+
+        updateHoveringRow(-1);
+        updateSelectedRow(-1);
+
+        m_visibleRows.clear();
+        setRowCount(rowCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setRowCount(std::size_t rowCount)
+    {
+        m_rowCount = rowCount;
+
+        if (m_hoveringRow >= static_cast<int>(m_rowCount))
+            updateHoveringRow(-1);
+        if (m_selectedRow >= static_cast<int>(m_rowCount))
+            updateSelectedRow(-1);
+
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getRowCount() const
+    {
+        return m_rowCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::refreshRows()
+    {
+        updateVisibleCells(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setSortFunction(const SortFunction& sortFunction)
+    {
+        m_sortFunction = sortFunction;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortByColumn(std::size_t column, bool ascending)
+    {
+        if (column >= m_columns.size())
+            return;
+
+        m_sortColumn = static_cast<int>(column);
+        m_sortAscending = ascending;
+
+        updateSelectedRow(-1);
+
+        if (m_sortFunction)
+            m_sortFunction(column, ascending);
+
+        updateVisibleCells(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getSortColumn() const
+    {
+        return m_sortColumn;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isSortedAscending() const
+    {
+        return m_sortAscending;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::setSelectedRow(std::size_t index)
+    {
+        if (index >= m_rowCount)
+        {
+            deselectRow();
+            return false;
+        }
+
+        updateSelectedRow(static_cast<int>(index));
+
+        // Move the scrollbar so that the selected row becomes visible
+        const std::uint64_t top = static_cast<std::uint64_t>(index) * m_rowHeight;
+        const std::uint64_t bottom = top + m_rowHeight;
+        if (top < m_verticalScroll->getValue())
+            m_verticalScroll->setValue(static_cast<unsigned int>(std::min<std::uint64_t>(top, std::numeric_limits<unsigned int>::max())));
+        else if (bottom > static_cast<std::uint64_t>(m_verticalScroll->getValue()) + m_verticalScroll->getViewportSize())
+            m_verticalScroll->setValue(static_cast<unsigned int>(std::min<std::uint64_t>(bottom - m_verticalScroll->getViewportSize(), std::numeric_limits<unsigned int>::max())));
+
+        updateVisibleCells();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::deselectRow()
+    {
+        updateSelectedRow(-1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getSelectedRow() const
+    {
+        return m_selectedRow;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setRowHeight(unsigned int rowHeight)
+    {
+        m_rowHeight = rowHeight;
+        if (m_requestedTextSize == 0)
+            setTextSize(0);
+
+        m_verticalScroll->setScrollAmount(m_rowHeight);
+        m_horizontalScroll->setScrollAmount(m_rowHeight);
+
+        updateScrollbars();
+        updateVisibleCells(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListView::getRowHeight() const
+    {
+        return m_rowHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setHeaderHeight(unsigned int headerHeight)
+    {
+        m_headerHeight = headerHeight;
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListView::getHeaderHeight() const
+    {
+        return m_headerHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setTextSize(unsigned int textSize)
+    {
+        m_requestedTextSize = textSize;
+
+        if (textSize)
+            m_textSize = textSize;
+        else
+            m_textSize = Text::findBestTextSize(m_fontCached, m_rowHeight * 0.8f);
+
+        updateCaptions();
+        updateVisibleCells(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListView::getTextSize() const
+    {
+        return m_textSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setVerticalScrollbarValue(unsigned int value)
+    {
+        m_verticalScroll->setValue(value);
+        updateVisibleCells();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListView::getVerticalScrollbarValue() const
+    {
+        return m_verticalScroll->getValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setHorizontalScrollbarValue(unsigned int value)
+    {
+        m_horizontalScroll->setValue(value);
+        updateVisibleCells();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListView::getHorizontalScrollbarValue() const
+    {
+        return m_horizontalScroll->getValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::mouseOnWidget(Vector2f pos) const
+    {
+        if (FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos))
+        {
+            if (!m_transparentTextureCached || !m_spriteBackground.isTransparentPixel(pos - getPosition() - m_bordersCached.getOffset()))
+                return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::leftMousePressed(Vector2f pos)
+    {
+        pos -= getPosition();
+
+        m_mouseDown = true;
+
+        if (m_verticalScroll->mouseOnWidget(pos))
+        {
+            m_verticalScroll->leftMousePressed(pos);
+            updateVisibleCells();
+        }
+        else if (m_horizontalScroll->mouseOnWidget(pos))
+        {
+            m_horizontalScroll->leftMousePressed(pos);
+            updateVisibleCells();
+        }
+        else if (getHeaderColumnAtPosition(pos) >= 0)
+        {
+            m_mouseDownOnHeaderColumn = getHeaderColumnAtPosition(pos);
+        }
+        else
+        {
+            const int row = getRowAtPosition(pos);
+            updateHoveringRow(row);
+
+            if (m_selectedRow != row)
+            {
+                m_possibleDoubleClick = false;
+
+                updateSelectedRow(row);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::leftMouseReleased(Vector2f pos)
+    {
+        pos -= getPosition();
+
+        if (m_mouseDown && (m_mouseDownOnHeaderColumn >= 0))
+        {
+            const int column = m_mouseDownOnHeaderColumn;
+            m_mouseDownOnHeaderColumn = -1;
+
+            if (getHeaderColumnAtPosition(pos) == column)
+            {
+                onHeaderClick.emit(this, column);
+
+                // Clicking on the column that is already sorted reverses the order
+                if (m_sortFunction)
+                    sortByColumn(static_cast<std::size_t>(column), (m_sortColumn == column) ? !m_sortAscending : true);
+            }
+        }
+        else if (m_mouseDown && !m_verticalScroll->isMouseDown() && !m_horizontalScroll->isMouseDown())
+        {
+            // Check if you double-clicked
+            if (m_possibleDoubleClick)
+            {
+                m_possibleDoubleClick = false;
+
+                if (m_selectedRow >= 0)
+                    onDoubleClick.emit(this, m_selectedRow);
+            }
+            else // This is the first click
+            {
+                m_animationTimeElapsed = {};
+                m_possibleDoubleClick = true;
+                updateRequiredChanged();
+            }
+        }
+
+        // Clicking on an arrow of a scrollbar changes its value when the mouse is released
+        m_verticalScroll->leftMouseReleased(pos);
+        m_horizontalScroll->leftMouseReleased(pos);
+        updateVisibleCells();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::mouseMoved(Vector2f pos)
+    {
+        pos -= getPosition();
+
+        if (!m_mouseHover)
+            mouseEnteredWidget();
+
+        // Check if the mouse event should go to one of the scrollbars
+        if ((m_verticalScroll->isMouseDown() && m_verticalScroll->isMouseDownOnThumb()) || m_verticalScroll->mouseOnWidget(pos))
+        {
+            m_verticalScroll->mouseMoved(pos);
+            m_horizontalScroll->mouseNoLongerOnWidget();
+            updateHoveringRow(-1);
+            updateVisibleCells();
+        }
+        else if ((m_horizontalScroll->isMouseDown() && m_horizontalScroll->isMouseDownOnThumb()) || m_horizontalScroll->mouseOnWidget(pos))
+        {
+            m_horizontalScroll->mouseMoved(pos);
+            m_verticalScroll->mouseNoLongerOnWidget();
+            updateHoveringRow(-1);
+            updateVisibleCells();
+        }
+        else // Mouse not on a scrollbar or dragging a scrollbar thumb
+        {
+            m_verticalScroll->mouseNoLongerOnWidget();
+            m_horizontalScroll->mouseNoLongerOnWidget();
+
+            const int row = getRowAtPosition(pos);
+            updateHoveringRow(row);
+
+            // If the mouse is held down then select the row below the mouse
+            if (m_mouseDown && (m_mouseDownOnHeaderColumn < 0) && !m_verticalScroll->isMouseDown() && !m_horizontalScroll->isMouseDown())
+            {
+                if ((row >= 0) && (m_selectedRow != row))
+                {
+                    m_possibleDoubleClick = false;
+
+                    updateSelectedRow(row);
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::mouseWheelScrolled(float delta, Vector2f pos)
+    {
+        if (m_horizontalScroll->isShown() && m_horizontalScroll->mouseOnWidget(pos - getPosition()))
+            m_horizontalScroll->mouseWheelScrolled(delta, pos - getPosition());
+        else if (m_verticalScroll->isShown())
+            m_verticalScroll->mouseWheelScrolled(delta, pos - getPosition());
+        else
+            return false;
+
+        updateVisibleCells();
+
+        // Update on which row the mouse is hovering
+        mouseMoved(pos);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::mouseNoLongerOnWidget()
+    {
+        Widget::mouseNoLongerOnWidget();
+        m_verticalScroll->mouseNoLongerOnWidget();
+        m_horizontalScroll->mouseNoLongerOnWidget();
+
+        updateHoveringRow(-1);
+
+        m_possibleDoubleClick = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::mouseNoLongerDown()
+    {
+        Widget::mouseNoLongerDown();
+        m_verticalScroll->mouseNoLongerDown();
+        m_horizontalScroll->mouseNoLongerDown();
+
+        m_mouseDownOnHeaderColumn = -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& ListView::getSignal(std::string signalName)
+    {
+        if (signalName == toLower(onItemSelect.getName()))
+            return onItemSelect;
+        else if (signalName == toLower(onDoubleClick.getName()))
+            return onDoubleClick;
+        else if (signalName == toLower(onHeaderClick.getName()))
+            return onHeaderClick;
+        else
+            return Widget::getSignal(std::move(signalName));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::rendererChanged(const std::string& property)
+    {
+        if (property == "borders")
+        {
+            m_bordersCached = getSharedRenderer()->getBorders();
+            setSize(m_size);
+        }
+        else if (property == "padding")
+        {
+            m_paddingCached = getSharedRenderer()->getPadding();
+            setSize(m_size);
+        }
+        else if (property == "textcolor")
+        {
+            m_textColorCached = getSharedRenderer()->getTextColor();
+            updateVisibleRowsColorsAndStyle();
+        }
+        else if (property == "textcolorhover")
+        {
+            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+            updateVisibleRowsColorsAndStyle();
+        }
+        else if (property == "selectedtextcolor")
+        {
+            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+            updateVisibleRowsColorsAndStyle();
+        }
+        else if (property == "selectedtextcolorhover")
+        {
+            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+            updateVisibleRowsColorsAndStyle();
+        }
+        else if (property == "texturebackground")
+        {
+            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+        }
+        else if (property == "textstyle")
+        {
+            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            updateCaptions();
+            updateVisibleRowsColorsAndStyle();
+        }
+        else if (property == "selectedtextstyle")
+        {
+            m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+            updateVisibleRowsColorsAndStyle();
+        }
+        else if (property == "headertextcolor")
+        {
+            m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
+            updateCaptions();
+        }
+        else if (property == "scrollbar")
+        {
+            m_verticalScroll->setRenderer(getSharedRenderer()->getScrollbar());
+            m_horizontalScroll->setRenderer(getSharedRenderer()->getScrollbar());
+        }
+        else if (property == "scrollbarwidth")
+        {
+            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScroll->getDefaultWidth();
+            m_verticalScroll->setSize({width, m_verticalScroll->getSize().y});
+            m_horizontalScroll->setSize({m_horizontalScroll->getSize().x, width});
+            updateScrollbars();
+        }
+        else if (property == "bordercolor")
+        {
+            m_borderColorCached = getSharedRenderer()->getBorderColor();
+        }
+        else if (property == "backgroundcolor")
+        {
+            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+        }
+        else if (property == "backgroundcolorhover")
+        {
+            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+        }
+        else if (property == "selectedbackgroundcolor")
+        {
+            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+        }
+        else if (property == "selectedbackgroundcolorhover")
+        {
+            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+        }
+        else if (property == "headerbackgroundcolor")
+        {
+            m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
+        }
+        else if (property == "separatorcolor")
+        {
+            m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
+        }
+        else if (property == "opacity")
+        {
+            Widget::rendererChanged(property);
+
+            m_verticalScroll->setInheritedOpacity(m_opacityCached);
+            m_horizontalScroll->setInheritedOpacity(m_opacityCached);
+            m_spriteBackground.setOpacity(m_opacityCached);
+            updateCaptions();
+            updateVisibleCells(true);
+        }
+        else if (property == "font")
+        {
+            Widget::rendererChanged(property);
+
+            // Recalculate the text size with the new font
+            if (m_requestedTextSize == 0)
+                m_textSize = Text::findBestTextSize(m_fontCached, m_rowHeight * 0.8f);
+
+            updateCaptions();
+            updateVisibleCells(true);
+        }
+        else
+            Widget::rendererChanged(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> ListView::save(SavingRenderersMap& renderers) const
+    {
+        auto node = Widget::save(renderers);
+
+        if (!m_columns.empty())
+        {
+            std::string captionList = "[" + Serializer::serialize(m_columns[0].caption.getString());
+            std::string widthList = "[" + Serializer::serialize(m_columns[0].width);
+            for (std::size_t i = 1; i < m_columns.size(); ++i)
+            {
+                captionList += ", " + Serializer::serialize(m_columns[i].caption.getString());
+                widthList += ", " + Serializer::serialize(m_columns[i].width);
+            }
+            captionList += "]";
+            widthList += "]";
+
+            node->propertyValuePairs["Columns"] = std::make_unique<DataIO::ValueNode>(captionList);
+            node->propertyValuePairs["ColumnWidths"] = std::make_unique<DataIO::ValueNode>(widthList);
+        }
+
+        node->propertyValuePairs["TextSize"] = std::make_unique<DataIO::ValueNode>(to_string(m_textSize));
+        node->propertyValuePairs["RowHeight"] = std::make_unique<DataIO::ValueNode>(to_string(m_rowHeight));
+        node->propertyValuePairs["HeaderHeight"] = std::make_unique<DataIO::ValueNode>(to_string(m_headerHeight));
+
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
+    {
+        Widget::load(node, renderers);
+
+        removeAllColumns();
+
+        if (node->propertyValuePairs["columns"])
+        {
+            if (!node->propertyValuePairs["columns"]->listNode)
+                throw Exception{"Failed to parse 'Columns' property, expected a list as value"};
+
+            const auto& captions = node->propertyValuePairs["columns"]->valueList;
+            if (node->propertyValuePairs["columnwidths"])
+            {
+                if (!node->propertyValuePairs["columnwidths"]->listNode)
+                    throw Exception{"Failed to parse 'ColumnWidths' property, expected a list as value"};
+
+                if (captions.size() != node->propertyValuePairs["columnwidths"]->valueList.size())
+                    throw Exception{"Amounts of values for 'Columns' differs from the amount in 'ColumnWidths'"};
+
+                for (std::size_t i = 0; i < captions.size(); ++i)
+                {
+                    addColumn(Deserializer::deserialize(ObjectConverter::Type::String, captions[i]).getString(),
+                              Deserializer::deserialize(ObjectConverter::Type::Number, node->propertyValuePairs["columnwidths"]->valueList[i]).getNumber());
+                }
+            }
+            else // There are no column widths
+            {
+                for (const auto& caption : captions)
+                    addColumn(Deserializer::deserialize(ObjectConverter::Type::String, caption).getString());
+            }
+        }
+        else // If there are no columns, there should be no column widths
+        {
+            if (node->propertyValuePairs["columnwidths"])
+                throw Exception{"Found 'ColumnWidths' property while there is no 'Columns' property"};
+        }
+
+        if (node->propertyValuePairs["textsize"])
+            setTextSize(tgui::stoi(node->propertyValuePairs["textsize"]->value));
+        if (node->propertyValuePairs["rowheight"])
+            setRowHeight(tgui::stoi(node->propertyValuePairs["rowheight"]->value));
+        if (node->propertyValuePairs["headerheight"])
+            setHeaderHeight(tgui::stoi(node->propertyValuePairs["headerheight"]->value));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f ListView::getInnerSize() const
+    {
+        return {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(), getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect ListView::getRowsArea() const
+    {
+        float width = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
+        float height = getInnerSize().y - m_headerHeight - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        if (m_verticalScroll->isShown())
+            width -= m_verticalScroll->getSize().x;
+        if (m_horizontalScroll->isShown())
+            height -= m_horizontalScroll->getSize().y;
+
+        return {m_bordersCached.getLeft() + m_paddingCached.getLeft(), m_bordersCached.getTop() + m_headerHeight + m_paddingCached.getTop(),
+                std::max(0.f, width), std::max(0.f, height)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ListView::getTotalColumnWidth() const
+    {
+        float width = 0;
+        for (const auto& column : m_columns)
+            width += column.width;
+
+        return width;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getRowAtPosition(Vector2f pos) const
+    {
+        const FloatRect area = getRowsArea();
+        if ((m_rowHeight == 0) || !area.contains(pos))
+            return -1;
+
+        // The row is calculated with integers to stay accurate when scrolled far down the list
+        const std::size_t row = (m_verticalScroll->getValue() + static_cast<std::size_t>(pos.y - area.top)) / m_rowHeight;
+        if (row < m_rowCount)
+            return static_cast<int>(row);
+        else
+            return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getHeaderColumnAtPosition(Vector2f pos) const
+    {
+        const FloatRect area = getRowsArea();
+        if (!FloatRect{area.left, m_bordersCached.getTop(), area.width, static_cast<float>(m_headerHeight)}.contains(pos))
+            return -1;
+
+        float right = area.left - m_horizontalScroll->getValue();
+        for (std::size_t i = 0; i < m_columns.size(); ++i)
+        {
+            right += m_columns[i].width;
+            if (pos.x < right)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateScrollbars()
+    {
+        const Vector2f innerSize = getInnerSize();
+        const float viewportWidth = std::max(0.f, innerSize.x - m_paddingCached.getLeft() - m_paddingCached.getRight());
+        const float viewportHeight = std::max(0.f, innerSize.y - m_headerHeight - m_paddingCached.getTop() - m_paddingCached.getBottom());
+
+        // The scrollbar can't represent more than a few billion pixels, rows beyond that are only reachable with setSelectedRow
+        const std::uint64_t contentHeight = static_cast<std::uint64_t>(m_rowCount) * m_rowHeight;
+        m_verticalScroll->setMaximum(static_cast<unsigned int>(std::min<std::uint64_t>(contentHeight, std::numeric_limits<unsigned int>::max())));
+        m_horizontalScroll->setMaximum(static_cast<unsigned int>(getTotalColumnWidth()));
+
+        // Each scrollbar takes space away from the other one when it is shown
+        m_verticalScroll->setViewportSize(static_cast<unsigned int>(viewportHeight));
+        m_horizontalScroll->setViewportSize(static_cast<unsigned int>(viewportWidth));
+        if (m_horizontalScroll->isShown())
+            m_verticalScroll->setViewportSize(static_cast<unsigned int>(std::max(0.f, viewportHeight - m_horizontalScroll->getSize().y)));
+        if (m_verticalScroll->isShown())
+        {
+            m_horizontalScroll->setViewportSize(static_cast<unsigned int>(std::max(0.f, viewportWidth - m_verticalScroll->getSize().x)));
+            if (m_horizontalScroll->isShown())
+                m_verticalScroll->setViewportSize(static_cast<unsigned int>(std::max(0.f, viewportHeight - m_horizontalScroll->getSize().y)));
+        }
+
+        const float verticalScrollbarWidth = m_verticalScroll->isShown() ? m_verticalScroll->getSize().x : 0;
+        const float horizontalScrollbarHeight = m_horizontalScroll->isShown() ? m_horizontalScroll->getSize().y : 0;
+
+        m_verticalScroll->setSize({m_verticalScroll->getSize().x, std::max(0.f, innerSize.y - m_headerHeight - horizontalScrollbarHeight)});
+        m_verticalScroll->setPosition(m_bordersCached.getLeft() + innerSize.x - m_verticalScroll->getSize().x, m_bordersCached.getTop() + m_headerHeight);
+
+        m_horizontalScroll->setSize({std::max(0.f, innerSize.x - verticalScrollbarWidth), m_horizontalScroll->getSize().y});
+        m_horizontalScroll->setPosition(m_bordersCached.getLeft(), m_bordersCached.getTop() + innerSize.y - m_horizontalScroll->getSize().y);
+
+        // Changing the maximum or viewport size may have moved the scrollbar values
+        updateVisibleCells();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateVisibleCells(bool rebuild)
+    {
+        const FloatRect area = getRowsArea();
+
+        // Find out which columns are visible
+        const float leftEdge = static_cast<float>(m_horizontalScroll->getValue());
+        const float rightEdge = leftEdge + area.width;
+        std::size_t firstColumn = m_columns.size();
+        std::size_t lastColumn = m_columns.size();
+        float columnLeft = 0;
+        for (std::size_t i = 0; i < m_columns.size(); ++i)
+        {
+            const float columnRight = columnLeft + m_columns[i].width;
+            if ((firstColumn == m_columns.size()) && (columnRight > leftEdge))
+                firstColumn = i;
+            if (columnLeft >= rightEdge)
+            {
+                lastColumn = i;
+                break;
+            }
+
+            columnLeft = columnRight;
+        }
+
+        // All cells have to be created again when other columns became visible
+        if ((firstColumn != m_firstVisibleColumn) || (lastColumn != m_lastVisibleColumn))
+        {
+            m_firstVisibleColumn = firstColumn;
+            m_lastVisibleColumn = lastColumn;
+            rebuild = true;
+        }
+
+        if (!m_dataProvider || (m_rowHeight == 0) || (area.height <= 0) || (firstColumn == lastColumn))
+        {
+            m_visibleRows.clear();
+            return;
+        }
+
+        // Find out which rows are visible, only the offset within the first row has to be added to the viewport height
+        const unsigned int scrollValue = m_verticalScroll->getValue();
+        const std::size_t firstRow = std::min<std::size_t>(scrollValue / m_rowHeight, m_rowCount);
+        const std::size_t rowsInView = static_cast<std::size_t>(std::ceil(((scrollValue % m_rowHeight) + area.height) / m_rowHeight));
+        const std::size_t lastRow = std::min(m_rowCount, firstRow + rowsInView);
+
+        // Nothing has to happen when the same rows are still visible
+        if (!rebuild && (m_visibleRows.size() == lastRow - firstRow)
+         && (m_visibleRows.empty() || (m_visibleRows.front().index == firstRow)))
+            return;
+
+        // Rows that remain visible are kept, the data provider is only asked for the cells of the rows that became visible
+        std::vector<VisibleRow> visibleRows;
+        visibleRows.reserve(lastRow - firstRow);
+        std::vector<std::size_t> newRows;
+        auto oldRowIt = m_visibleRows.begin();
+        for (std::size_t row = firstRow; row < lastRow; ++row)
+        {
+            while (!rebuild && (oldRowIt != m_visibleRows.end()) && (oldRowIt->index < row))
+                ++oldRowIt;
+
+            if (!rebuild && (oldRowIt != m_visibleRows.end()) && (oldRowIt->index == row))
+            {
+                visibleRows.push_back(std::move(*oldRowIt));
+                ++oldRowIt;
+                continue;
+            }
+
+            VisibleRow visibleRow;
+            visibleRow.index = row;
+            visibleRow.cells.reserve(lastColumn - firstColumn);
+
+            float cellLeft = Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached);
+            for (std::size_t i = 0; i < firstColumn; ++i)
+                cellLeft += m_columns[i].width;
+
+            for (std::size_t column = firstColumn; column < lastColumn; ++column)
+            {
+                Text cell;
+                cell.setFont(m_fontCached);
+                cell.setOpacity(m_opacityCached);
+                cell.setCharacterSize(m_textSize);
+                cell.setString(m_dataProvider(row, column));
+
+                // Positions are relative to the row, so they don't lose precision when the list is scrolled far down
+                cell.setPosition({cellLeft, (m_rowHeight - cell.getSize().y) / 2.0f});
+                cellLeft += m_columns[column].width;
+
+                visibleRow.cells.push_back(std::move(cell));
+            }
+
+            visibleRows.push_back(std::move(visibleRow));
+            newRows.push_back(row);
+        }
+
+        m_visibleRows = std::move(visibleRows);
+
+        for (const auto row : newRows)
+            updateRowColorsAndStyle(row);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateRowColorsAndStyle(std::size_t row)
+    {
+        // The visible rows have consecutive indices, so the row can be looked up directly
+        if (m_visibleRows.empty() || (row < m_visibleRows.front().index) || (row > m_visibleRows.back().index))
+            return;
+
+        const bool selected = (static_cast<int>(row) == m_selectedRow);
+        const bool hover = (static_cast<int>(row) == m_hoveringRow);
+
+        Color color = m_textColorCached;
+        if (selected && hover && m_selectedTextColorHoverCached.isSet())
+            color = m_selectedTextColorHoverCached;
+        else if (selected && m_selectedTextColorCached.isSet())
+            color = m_selectedTextColorCached;
+        else if (!selected && hover && m_textColorHoverCached.isSet())
+            color = m_textColorHoverCached;
+
+        const TextStyle style = (selected && m_selectedTextStyleCached.isSet()) ? m_selectedTextStyleCached : m_textStyleCached;
+
+        for (auto& cell : m_visibleRows[row - m_visibleRows.front().index].cells)
+        {
+            cell.setColor(color);
+            cell.setStyle(style);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateVisibleRowsColorsAndStyle()
+    {
+        for (const auto& visibleRow : m_visibleRows)
+            updateRowColorsAndStyle(visibleRow.index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateCaptions()
+    {
+        for (auto& column : m_columns)
+        {
+            column.caption.setFont(m_fontCached);
+            column.caption.setColor(m_headerTextColorCached);
+            column.caption.setOpacity(m_opacityCached);
+            column.caption.setStyle(m_textStyleCached);
+            column.caption.setCharacterSize(m_textSize);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateHoveringRow(int row)
+    {
+        if (m_hoveringRow != row)
+        {
+            const int oldHoveringRow = m_hoveringRow;
+            m_hoveringRow = row;
+
+            if (oldHoveringRow >= 0)
+                updateRowColorsAndStyle(static_cast<std::size_t>(oldHoveringRow));
+            if (m_hoveringRow >= 0)
+                updateRowColorsAndStyle(static_cast<std::size_t>(m_hoveringRow));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateSelectedRow(int row)
+    {
+        if (m_selectedRow != row)
+        {
+            const int oldSelectedRow = m_selectedRow;
+            m_selectedRow = row;
+
+            if (oldSelectedRow >= 0)
+                updateRowColorsAndStyle(static_cast<std::size_t>(oldSelectedRow));
+            if (m_selectedRow >= 0)
+                updateRowColorsAndStyle(static_cast<std::size_t>(m_selectedRow));
+
+            onItemSelect.emit(this, m_selectedRow);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::update(sf::Time elapsedTime)
+    {
+        Widget::update(elapsedTime);
+
+        if (m_animationTimeElapsed >= sf::milliseconds(getDoubleClickTime()))
+        {
+            m_animationTimeElapsed = {};
+            m_possibleDoubleClick = false;
+            updateRequiredChanged();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isUpdateRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        states.transform.translate(getPosition());
+        const sf::RenderStates statesForScrollbars = states;
+
+        // Draw the borders
+        if (m_bordersCached != Borders{0})
+        {
+            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            states.transform.translate(m_bordersCached.getOffset());
+        }
+
+        // Draw the background
+        if (m_spriteBackground.isSet())
+            m_spriteBackground.draw(target, states);
+        else
+            drawRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
+
+        const FloatRect area = getRowsArea();
+        const Vector2f areaOffset = {area.left - m_bordersCached.getLeft(), area.top - m_bordersCached.getTop()};
+        const float horizontalOffset = static_cast<float>(m_horizontalScroll->getValue());
+
+        // Draw the header with the column captions
+        if (m_headerHeight > 0)
+        {
+            float headerWidth = getInnerSize().x;
+            if (m_verticalScroll->isShown())
+                headerWidth -= m_verticalScroll->getSize().x;
+            drawRectangleShape(target, states, {std::max(0.f, headerWidth), static_cast<float>(m_headerHeight)}, m_headerBackgroundColorCached);
+
+            const Clipping clipping{target, states, {areaOffset.x, 0}, {area.width, static_cast<float>(m_headerHeight)}};
+
+            sf::RenderStates headerStates = states;
+            headerStates.transform.translate({areaOffset.x - horizontalOffset, 0});
+
+            const float captionPadding = Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached);
+            float columnLeft = 0;
+            for (std::size_t i = 0; i < m_columns.size(); ++i)
+            {
+                const float columnRight = columnLeft + m_columns[i].width;
+                if ((i >= m_firstVisibleColumn) && (i < m_lastVisibleColumn))
+                {
+                    {
+                        const Clipping captionClipping{target, headerStates, {columnLeft, 0}, {m_columns[i].width, static_cast<float>(m_headerHeight)}};
+
+                        sf::RenderStates captionStates = headerStates;
+                        captionStates.transform.translate({columnLeft + captionPadding, (m_headerHeight - m_columns[i].caption.getSize().y) / 2.0f});
+                        m_columns[i].caption.draw(target, captionStates);
+                    }
+
+                    // Draw a triangle that shows in which direction the column is sorted
+                    if (static_cast<int>(i) == m_sortColumn)
+                    {
+                        const float triangleSize = m_headerHeight / 4.f;
+                        const float triangleLeft = columnRight - (2 * triangleSize);
+                        const float triangleTop = (m_headerHeight - triangleSize) / 2.f;
+                        const Color triangleColor = Color::calcColorOpacity(m_headerTextColorCached, m_opacityCached);
+                        const float tipY = m_sortAscending ? triangleTop : triangleTop + triangleSize;
+                        const float baseY = m_sortAscending ? triangleTop + triangleSize : triangleTop;
+                        const sf::Vertex vertices[] = {
+                            {{triangleLeft, baseY}, triangleColor},
+                            {{triangleLeft + triangleSize, baseY}, triangleColor},
+                            {{triangleLeft + (triangleSize / 2.f), tipY}, triangleColor}
+                        };
+
+                        target.draw(vertices, 3, sf::PrimitiveType::Triangles, headerStates);
+                    }
+
+                    // Draw the separator to the right of the column
+                    if (m_separatorColorCached.isSet())
+                    {
+                        sf::RenderStates separatorStates = headerStates;
+                        separatorStates.transform.translate({columnRight - 1, 0});
+                        drawRectangleShape(target, separatorStates, {1, static_cast<float>(m_headerHeight)}, m_separatorColorCached);
+                    }
+                }
+
+                columnLeft = columnRight;
+            }
+        }
+
+        // Draw the rows and their selected/hover backgrounds
+        if (!m_visibleRows.empty())
+        {
+            // Set the clipping for all draw calls that happen until this clipping object goes out of scope
+            const Clipping clipping{target, states, areaOffset, {area.width, area.height}};
+
+            // Only the offset within the first visible row is needed, which keeps the floats small for millions of rows
+            sf::RenderStates rowStates = states;
+            rowStates.transform.translate({areaOffset.x, areaOffset.y - static_cast<float>(m_verticalScroll->getValue() % m_rowHeight)});
+
+            const std::size_t firstRow = m_verticalScroll->getValue() / m_rowHeight;
+            const float rowWidth = std::max(area.width, getTotalColumnWidth() - horizontalOffset);
+
+            float firstColumnLeft = 0;
+            for (std::size_t i = 0; i < m_firstVisibleColumn; ++i)
+                firstColumnLeft += m_columns[i].width;
+
+            for (const auto& visibleRow : m_visibleRows)
+            {
+                sf::RenderStates cellStates = rowStates;
+                cellStates.transform.translate({0, static_cast<float>(static_cast<std::ptrdiff_t>(visibleRow.index - firstRow)) * m_rowHeight});
+
+                const bool selected = (static_cast<int>(visibleRow.index) == m_selectedRow);
+                const bool hover = (static_cast<int>(visibleRow.index) == m_hoveringRow);
+                if (selected)
+                {
+                    if (hover && m_selectedBackgroundColorHoverCached.isSet())
+                        drawRectangleShape(target, cellStates, {rowWidth, static_cast<float>(m_rowHeight)}, m_selectedBackgroundColorHoverCached);
+                    else
+                        drawRectangleShape(target, cellStates, {rowWidth, static_cast<float>(m_rowHeight)}, m_selectedBackgroundColorCached);
+                }
+                else if (hover && m_backgroundColorHoverCached.isSet())
+                    drawRectangleShape(target, cellStates, {rowWidth, static_cast<float>(m_rowHeight)}, m_backgroundColorHoverCached);
+
+                cellStates.transform.translate({-horizontalOffset, 0});
+
+                float columnLeft = firstColumnLeft;
+                for (std::size_t i = 0; i < visibleRow.cells.size(); ++i)
+                {
+                    const float columnWidth = m_columns[m_firstVisibleColumn + i].width;
+                    const Clipping cellClipping{target, cellStates, {columnLeft, 0}, {columnWidth, static_cast<float>(m_rowHeight)}};
+                    visibleRow.cells[i].draw(target, cellStates);
+                    columnLeft += columnWidth;
+                }
+            }
+        }
+
+        // Draw the scrollbars
+        m_verticalScroll->draw(target, statesForScrollbars);
+        m_horizontalScroll->draw(target, statesForScrollbars);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,30 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Adds two triangles that fill a rectangle to the vertices of the open menu
+        void addMenuBarQuad(std::vector<sf::Vertex>& vertices, Vector2f position, Vector2f size, const sf::Color& color)
+        {
+            vertices.emplace_back(sf::Vector2f{position.x, position.y}, color);
+            vertices.emplace_back(sf::Vector2f{position.x + size.x, position.y}, color);
+            vertices.emplace_back(sf::Vector2f{position.x, position.y + size.y}, color);
+            vertices.emplace_back(sf::Vector2f{position.x, position.y + size.y}, color);
+            vertices.emplace_back(sf::Vector2f{position.x + size.x, position.y}, color);
+            vertices.emplace_back(sf::Vector2f{position.x + size.x, position.y + size.y}, color);
+        }
+
+        // Changes the color of a rectangle that was added with addMenuBarQuad
+        void setMenuBarQuadColor(std::vector<sf::Vertex>& vertices, std::size_t quadIndex, const sf::Color& color)
+        {
+            if ((quadIndex + 1) * 6 > vertices.size())
+                return;
+
+            for (std::size_t i = quadIndex * 6; i < (quadIndex + 1) * 6; ++i)
+                vertices[i].color = color;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     MenuBar::MenuBar()
@@ -98,6 +122,8 @@ namespace tgui
         Widget::setSize(size);
 
         m_spriteBackground.setSize(getSize());
+
+        updateMenuWidths();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -111,6 +137,8 @@ namespace tgui
         newMenu.text.setCharacterSize(m_textSize);
         newMenu.text.setString(text);
         m_menus.push_back(std::move(newMenu));
+
+        updateMenuWidth(m_menus.size() - 1);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,6 +159,11 @@ namespace tgui
                 menuItem.setString(text);
 
                 m_menus[i].menuItems.push_back(std::move(menuItem));
+
+                m_menus[i].itemsWidthOutdated = true;
+                if (m_visibleMenu == static_cast<int>(i))
+                    updateOpenMenuGeometry();
+
                 return true;
             }
         }
@@ -159,12 +192,13 @@ namespace tgui
             // If this is the menu then remove it
             if (m_menus[i].text.getString() == menu)
             {
-                m_menus.erase(m_menus.begin() + i);
-
-                // The menu was removed, so it can't remain open
+                // The menu is removed, so it can't remain open
                 if (m_visibleMenu == static_cast<int>(i))
-                    m_visibleMenu = -1;
+                    closeMenu();
+                else if (m_visibleMenu > static_cast<int>(i))
+                    --m_visibleMenu;
 
+                m_menus.erase(m_menus.begin() + i);
                 return true;
             }
         }
@@ -193,6 +227,12 @@ namespace tgui
                         // The item can't still be selected
                         if (m_menus[i].selectedMenuItem == static_cast<int>(j))
                             m_menus[i].selectedMenuItem = -1;
+                        else if (m_menus[i].selectedMenuItem > static_cast<int>(j))
+                            --m_menus[i].selectedMenuItem;
+
+                        m_menus[i].itemsWidthOutdated = true;
+                        if (m_visibleMenu == static_cast<int>(i))
+                            updateOpenMenuGeometry();
 
                         return true;
                     }
@@ -208,6 +248,7 @@ namespace tgui
 
     void MenuBar::removeAllMenus()
     {
+        closeMenu();
         m_menus.clear();
     }
 
@@ -224,6 +265,8 @@ namespace tgui
 
             m_menus[i].text.setCharacterSize(m_textSize);
         }
+
+        updateMenuWidths();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -238,6 +281,11 @@ namespace tgui
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
         m_minimumSubMenuWidth = minimumWidth;
+
+        for (auto& menu : m_menus)
+            menu.itemsWidthOutdated = true;
+
+        updateOpenMenuGeometry();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,6 +300,8 @@ namespace tgui
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
         m_invertedMenuDirection = invertDirection;
+
+        updateOpenMenuGeometry();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -287,14 +337,12 @@ namespace tgui
         if (m_visibleMenu != -1)
         {
             // If an item in that menu was selected then unselect it first
-            if (m_menus[m_visibleMenu].selectedMenuItem != -1)
-            {
-                m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
-                m_menus[m_visibleMenu].selectedMenuItem = -1;
-            }
+            updateSelectedMenuItem(-1);
 
             m_menus[m_visibleMenu].text.setColor(m_textColorCached);
             m_visibleMenu = -1;
+
+            m_openMenuVertices.clear();
         }
     }
 
@@ -310,28 +358,20 @@ namespace tgui
             // Check if there is a menu open
             if (m_visibleMenu != -1)
             {
-                // Search the left position of the open menu
-                float left = 0;
-                for (int i = 0; i < m_visibleMenu; ++i)
-                    left += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
-
-                // Find out what the width of the menu should be
-                float width = m_minimumSubMenuWidth;
-                for (unsigned int j = 0; j < m_menus[m_visibleMenu].menuItems.size(); ++j)
-                {
-                    if (width < m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * m_distanceToSideCached))
-                        width = m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * m_distanceToSideCached);
-                }
+                // The width of the open menu is always up-to-date
+                const float left = getPosition().x + getMenuLeft(m_visibleMenu);
+                const float width = m_menus[m_visibleMenu].itemsWidth;
+                const float height = getSize().y * m_menus[m_visibleMenu].menuItems.size();
 
                 // Check if the mouse is on top of the open menu
                 if (m_invertedMenuDirection)
                 {
-                    if (FloatRect{left, -(getSize().y * m_menus[m_visibleMenu].menuItems.size()), width, getSize().y * m_menus[m_visibleMenu].menuItems.size()}.contains(pos))
+                    if (FloatRect{left, getPosition().y - height, width, height}.contains(pos))
                         return true;
                 }
                 else
                 {
-                    if (FloatRect{getPosition().x + left, getPosition().y + getSize().y, width, getSize().y * m_menus[m_visibleMenu].menuItems.size()}.contains(pos))
+                    if (FloatRect{left, getPosition().y + getSize().y, width, height}.contains(pos))
                         return true;
                 }
             }
@@ -351,32 +391,16 @@ namespace tgui
             float menuWidth = 0;
             for (unsigned int i = 0; i < m_menus.size(); ++i)
             {
-                menuWidth += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+                menuWidth += m_menus[i].width;
                 if (pos.x < menuWidth)
                 {
                     // Close the menu when it was already open
                     if (m_visibleMenu == static_cast<int>(i))
-                    {
-                        if (m_menus[m_visibleMenu].selectedMenuItem != -1)
-                        {
-                            m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
-                            m_menus[m_visibleMenu].selectedMenuItem = -1;
-                        }
-
-                        m_menus[m_visibleMenu].text.setColor(m_textColorCached);
-                        m_visibleMenu = -1;
-                    }
+                        closeMenu();
 
                     // If this menu can be opened then do so
                     else if (!m_menus[i].menuItems.empty())
-                    {
-                        if (m_selectedTextColorCached.isSet())
-                            m_menus[i].text.setColor(m_selectedTextColorCached);
-                        else
-                            m_menus[i].text.setColor(m_textColorCached);
-
-                        m_visibleMenu = static_cast<int>(i);
-                    }
+                        openMenu(i);
 
                     break;
                 }
@@ -434,34 +458,22 @@ namespace tgui
                 float menuWidth = 0;
                 for (unsigned int i = 0; i < m_menus.size(); ++i)
                 {
-                    menuWidth += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+                    menuWidth += m_menus[i].width;
                     if (pos.x < menuWidth)
                     {
                         // Check if the menu is already open
                         if (m_visibleMenu == static_cast<int>(i))
                         {
                             // If one of the menu items is selected then unselect it
-                            if (m_menus[m_visibleMenu].selectedMenuItem != -1)
-                            {
-                                m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
-                                m_menus[m_visibleMenu].selectedMenuItem = -1;
-                            }
+                            updateSelectedMenuItem(-1);
                         }
                         else // The menu isn't open yet
                         {
-                            // If there is another menu open then close it first
-                            closeMenu();
-
-                            // If this menu can be opened then do so
+                            // If this menu can be opened then do so, the menu that was open is closed first
                             if (!m_menus[i].menuItems.empty())
-                            {
-                                if (m_selectedTextColorCached.isSet())
-                                    m_menus[i].text.setColor(m_selectedTextColorCached);
-                                else
-                                    m_menus[i].text.setColor(m_textColorCached);
-
-                                m_visibleMenu = static_cast<int>(i);
-                            }
+                                openMenu(i);
+                            else
+                                closeMenu();
                         }
                         break;
                     }
@@ -477,20 +489,9 @@ namespace tgui
             else
                 selectedMenuItem = static_cast<int>((pos.y - getSize().y) / getSize().y);
 
-            // Check if the mouse is on a different item than before
-            if (selectedMenuItem != m_menus[m_visibleMenu].selectedMenuItem)
-            {
-                // If another of the menu items is selected then unselect it
-                if (m_menus[m_visibleMenu].selectedMenuItem != -1)
-                    m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
-
-                // Mark the item below the mouse as selected
-                m_menus[m_visibleMenu].selectedMenuItem = selectedMenuItem;
-                if (m_selectedTextColorCached.isSet())
-                    m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_selectedTextColorCached);
-                else
-                    m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
-            }
+            // Mark the item below the mouse as selected
+            if ((selectedMenuItem >= 0) && (selectedMenuItem < static_cast<int>(m_menus[m_visibleMenu].menuItems.size())))
+                updateSelectedMenuItem(selectedMenuItem);
         }
     }
 
@@ -509,11 +510,8 @@ namespace tgui
     void MenuBar::mouseLeftWidget()
     {
         // Menu items which are selected on mouse hover should not remain selected now that the mouse has left
-        if ((m_visibleMenu != -1) && (m_menus[m_visibleMenu].selectedMenuItem != -1))
-        {
-            m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
-            m_menus[m_visibleMenu].selectedMenuItem = -1;
-        }
+        if (m_visibleMenu != -1)
+            updateSelectedMenuItem(-1);
 
         Widget::mouseLeftWidget();
     }
@@ -572,22 +570,30 @@ namespace tgui
         else if (property == "textureitembackground")
         {
             m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
+            m_spriteOpenMenuItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
+            updateMenuWidths();
         }
         else if (property == "textureselecteditembackground")
         {
             m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
+            m_spriteOpenMenuBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
+            m_spriteOpenMenuSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
+            updateOpenMenuGeometry();
         }
         else if (property == "backgroundcolor")
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+            updateOpenMenuGeometry();
         }
         else if (property == "selectedbackgroundcolor")
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+            updateOpenMenuGeometry();
         }
         else if (property == "distancetoside")
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+            updateMenuWidths();
         }
         else if (property == "opacity")
         {
@@ -602,6 +608,7 @@ namespace tgui
             }
 
             m_spriteBackground.setOpacity(m_opacityCached);
+            updateOpenMenuGeometry();
         }
         else if (property == "font")
         {
@@ -691,6 +698,146 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void MenuBar::openMenu(std::size_t menuIndex)
+    {
+        closeMenu();
+
+        if (m_selectedTextColorCached.isSet())
+            m_menus[menuIndex].text.setColor(m_selectedTextColorCached);
+        else
+            m_menus[menuIndex].text.setColor(m_textColorCached);
+
+        m_visibleMenu = static_cast<int>(menuIndex);
+        updateOpenMenuGeometry();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MenuBar::updateSelectedMenuItem(int menuItem)
+    {
+        Menu& menu = m_menus[m_visibleMenu];
+        if (menu.selectedMenuItem == menuItem)
+            return;
+
+        // Only the colors of the two items that changed have to be updated
+        if (menu.selectedMenuItem != -1)
+        {
+            menu.menuItems[menu.selectedMenuItem].setColor(m_textColorCached);
+            if (!m_spriteItemBackground.isSet())
+                setMenuBarQuadColor(m_openMenuVertices, menu.selectedMenuItem + 1, Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
+        }
+
+        menu.selectedMenuItem = menuItem;
+        if (menu.selectedMenuItem != -1)
+        {
+            if (m_selectedTextColorCached.isSet())
+                menu.menuItems[menu.selectedMenuItem].setColor(m_selectedTextColorCached);
+            else
+                menu.menuItems[menu.selectedMenuItem].setColor(m_textColorCached);
+
+            if (!m_spriteItemBackground.isSet() && m_selectedBackgroundColorCached.isSet())
+                setMenuBarQuadColor(m_openMenuVertices, menu.selectedMenuItem + 1, Color::calcColorOpacity(m_selectedBackgroundColorCached, m_opacityCached));
+        }
+
+        // The selected item is left out of the batched textured backgrounds, so they have to be rebuilt
+        if (m_spriteItemBackground.isSet() && m_spriteSelectedItemBackground.isSet())
+            updateOpenMenuGeometry();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float MenuBar::getMenuLeft(std::size_t menuIndex) const
+    {
+        float left = 0;
+        for (std::size_t i = 0; i < menuIndex; ++i)
+            left += m_menus[i].width;
+
+        return left;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MenuBar::updateMenuWidth(std::size_t menuIndex)
+    {
+        Menu& menu = m_menus[menuIndex];
+        menu.width = menu.text.getSize().x + (2 * m_distanceToSideCached);
+        menu.itemsWidthOutdated = true;
+
+        // The background texture is sized once here instead of every time the menu bar is drawn
+        if (m_spriteItemBackground.isSet())
+        {
+            menu.spriteBackground = m_spriteItemBackground;
+            menu.spriteBackground.setSize({menu.width, getSize().y});
+        }
+        else
+            menu.spriteBackground = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MenuBar::updateMenuWidths()
+    {
+        for (std::size_t i = 0; i < m_menus.size(); ++i)
+            updateMenuWidth(i);
+
+        updateOpenMenuGeometry();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MenuBar::updateOpenMenuGeometry()
+    {
+        m_openMenuVertices.clear();
+        if (m_visibleMenu == -1)
+            return;
+
+        // The items are only measured when the menu is opened for the first time after they changed
+        Menu& menu = m_menus[m_visibleMenu];
+        if (menu.itemsWidthOutdated)
+        {
+            menu.itemsWidth = m_minimumSubMenuWidth;
+            for (const auto& menuItem : menu.menuItems)
+                menu.itemsWidth = std::max(menu.itemsWidth, menuItem.getSize().x + (2 * m_distanceToSideCached));
+
+            menu.itemsWidthOutdated = false;
+        }
+
+        if (m_spriteSelectedItemBackground.isSet())
+        {
+            m_spriteOpenMenuBackground.setSize({menu.width, getSize().y});
+            m_spriteOpenMenuSelectedItemBackground.setSize({menu.itemsWidth, getSize().y});
+        }
+
+        const float nextItemDistance = m_invertedMenuDirection ? -getSize().y : getSize().y;
+        if (m_spriteItemBackground.isSet())
+        {
+            // The textured backgrounds of the items are drawn with a single draw call, except for the selected item
+            // when it has a different texture
+            m_spriteOpenMenuItemBackground.setSize({menu.itemsWidth, getSize().y});
+            for (std::size_t i = 0; i < menu.menuItems.size(); ++i)
+            {
+                if ((menu.selectedMenuItem != static_cast<int>(i)) || !m_spriteSelectedItemBackground.isSet())
+                    m_spriteOpenMenuItemBackground.addTriangles(m_openMenuVertices, {0, (i + 1) * nextItemDistance});
+            }
+
+            return;
+        }
+
+        // When no textures are used, the backgrounds of the menu and all its items are drawn with a single draw call
+        const Color backgroundColor = Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached);
+        const Color selectedBackgroundColor = m_selectedBackgroundColorCached.isSet() ? Color::calcColorOpacity(m_selectedBackgroundColorCached, m_opacityCached) : backgroundColor;
+
+        m_openMenuVertices.reserve((menu.menuItems.size() + 1) * 6);
+        addMenuBarQuad(m_openMenuVertices, {0, 0}, {menu.width, getSize().y}, selectedBackgroundColor);
+        for (std::size_t i = 0; i < menu.menuItems.size(); ++i)
+        {
+            addMenuBarQuad(m_openMenuVertices, {0, (i + 1) * nextItemDistance}, {menu.itemsWidth, getSize().y},
+                           (menu.selectedMenuItem == static_cast<int>(i)) ? selectedBackgroundColor : backgroundColor);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -709,78 +856,46 @@ namespace tgui
         else
             drawRectangleShape(target, states, getSize(), m_backgroundColorCached);
 
-        // Draw the menu backgrounds
-        Sprite backgroundSprite = m_spriteItemBackground;
-        for (unsigned int i = 0; i < m_menus.size(); ++i)
+        // Draw the backgrounds of the menus in the bar
+        if (m_spriteItemBackground.isSet())
         {
-            // Is the menu open?
-            if (m_visibleMenu == static_cast<int>(i))
+            sf::RenderStates menuStates = states;
+            for (unsigned int i = 0; i < m_menus.size(); ++i)
             {
-                const sf::RenderStates oldStates = states;
-
-                // Find out what the width of the menu should be
-                float menuWidth = m_minimumSubMenuWidth;
-                for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    menuWidth = std::max(menuWidth, m_menus[i].menuItems[j].getSize().x + (2 * m_distanceToSideCached));
+                if ((m_visibleMenu == static_cast<int>(i)) && m_spriteSelectedItemBackground.isSet())
+                    m_spriteOpenMenuBackground.draw(target, menuStates);
+                else
+                    m_menus[i].spriteBackground.draw(target, menuStates);
 
-                Sprite selectedBackgroundSprite = m_spriteSelectedItemBackground;
-                if (selectedBackgroundSprite.isSet() && backgroundSprite.isSet())
-                {
-                    selectedBackgroundSprite.setSize({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
-                    selectedBackgroundSprite.draw(target, states);
+                menuStates.transform.translate({m_menus[i].width, 0});
+            }
+        }
 
-                    backgroundSprite.setSize({menuWidth, getSize().y});
-                    selectedBackgroundSprite.setSize({menuWidth, getSize().y});
-                    for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    {
-                        states.transform.translate({0, nextItemDistance});
-                        if (m_menus[i].selectedMenuItem == static_cast<int>(j))
-                            selectedBackgroundSprite.draw(target, states);
-                        else
-                            backgroundSprite.draw(target, states);
-                    }
-                }
-                else if (backgroundSprite.isSet())
-                {
-                    backgroundSprite.setSize({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
-                    backgroundSprite.draw(target, states);
+        // Draw the background of the open menu
+        if (m_visibleMenu != -1)
+        {
+            sf::RenderStates menuStates = states;
+            menuStates.transform.translate({getMenuLeft(m_visibleMenu), 0});
 
-                    backgroundSprite.setSize({menuWidth, getSize().y});
-                    for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    {
-                        states.transform.translate({0, nextItemDistance});
-                        backgroundSprite.draw(target, states);
-                    }
-                }
-                else // No textures where loaded
+            const Menu& menu = m_menus[m_visibleMenu];
+            if (m_spriteItemBackground.isSet())
+            {
+                if (!m_openMenuVertices.empty())
                 {
-                    if (m_selectedBackgroundColorCached.isSet())
-                        drawRectangleShape(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y}, m_selectedBackgroundColorCached);
-                    else
-                        drawRectangleShape(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y}, m_backgroundColorCached);
-
-                    for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    {
-                        states.transform.translate({0, nextItemDistance});
-                        if ((m_menus[i].selectedMenuItem == static_cast<int>(j)) && m_selectedBackgroundColorCached.isSet())
-                            drawRectangleShape(target, states, {menuWidth, getSize().y}, m_selectedBackgroundColorCached);
-                        else
-                            drawRectangleShape(target, states, {menuWidth, getSize().y}, m_backgroundColorCached);
-                    }
+                    sf::RenderStates itemStates = menuStates;
+                    itemStates.texture = &m_spriteOpenMenuItemBackground.getTexture().getData()->texture;
+                    itemStates.shader = m_spriteOpenMenuItemBackground.getTexture().getData()->shader;
+                    target.draw(m_openMenuVertices.data(), m_openMenuVertices.size(), sf::PrimitiveType::Triangles, itemStates);
                 }
 
-                states = oldStates;
-            }
-            else // This menu is not open
-            {
-                if (backgroundSprite.isSet())
+                if ((menu.selectedMenuItem != -1) && m_spriteSelectedItemBackground.isSet())
                 {
-                    backgroundSprite.setSize({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
-                    backgroundSprite.draw(target, states);
+                    menuStates.transform.translate({0, (menu.selectedMenuItem + 1) * nextItemDistance});
+                    m_spriteOpenMenuSelectedItemBackground.draw(target, menuStates);
                 }
             }
-
-            states.transform.translate({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), 0});
+            else if (!m_openMenuVertices.empty())
+                target.draw(m_openMenuVertices.data(), m_openMenuVertices.size(), sf::PrimitiveType::Triangles, menuStates);
         }
 
         // Draw the texts of the menus
@@ -805,7 +920,7 @@ namespace tgui
                     textStates = oldStates;
                 }
 
-                textStates.transform.translate({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), 0});
+                textStates.transform.translate({m_menus[i].width, 0});
             }
         }
     }
@@ -167,6 +167,7 @@ namespace tgui
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
+            childWidgetsOffsetChanged();
         }
         else if (property == "bordercolor")
         {
@@ -159,6 +159,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                updateRequiredChanged();
             }
         }
     }
@@ -227,11 +228,19 @@ namespace tgui
         {
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
+            updateRequiredChanged();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Picture::isUpdateRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -216,7 +216,8 @@ namespace tgui
             if (bottomRight.y > m_mostBottomRightPosition.y)
                 m_mostBottomRightPosition.y = bottomRight.y;
 
-            updateScrollbars();
+            if (!m_changingWidgetsInBatch)
+                updateScrollbars();
 
             connectPositionAndSize(widget);
         }
@@ -266,6 +267,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ScrollablePanel::removeWidgets(const std::function<bool(const Widget::Ptr&)>& predicate)
+    {
+        return Panel::removeWidgets([this,&predicate](const Widget::Ptr& widget){
+            if (!predicate(widget))
+                return false;
+
+            const auto callbackIt = m_connectedCallbacks.find(widget);
+            if (callbackIt != m_connectedCallbacks.end())
+            {
+                widget->disconnect(callbackIt->second-1);
+                widget->disconnect(callbackIt->second);
+                m_connectedCallbacks.erase(callbackIt);
+            }
+
+            return true;
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ScrollablePanel::setContentSize(Vector2f size)
     {
         m_contentSize = size;
@@ -388,9 +409,15 @@ namespace tgui
         m_mouseDown = true;
 
         if (m_verticalScrollbar->mouseOnWidget(pos - getPosition()))
+        {
             m_verticalScrollbar->leftMousePressed(pos - getPosition());
+            childWidgetsOffsetChanged();
+        }
         else if (m_horizontalScrollbar->mouseOnWidget(pos - getPosition()))
+        {
             m_horizontalScrollbar->leftMousePressed(pos - getPosition());
+            childWidgetsOffsetChanged();
+        }
         else if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
         {
             Panel::leftMousePressed({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -402,10 +429,17 @@ namespace tgui
 
     void ScrollablePanel::leftMouseReleased(Vector2f pos)
     {
+        // Clicking on an arrow of a scrollbar changes its value when the mouse is released
         if (m_verticalScrollbar->mouseOnWidget(pos - getPosition()))
+        {
             m_verticalScrollbar->leftMouseReleased(pos - getPosition());
+            childWidgetsOffsetChanged();
+        }
         else if (m_horizontalScrollbar->mouseOnWidget(pos - getPosition()))
+        {
             m_horizontalScrollbar->leftMouseReleased(pos - getPosition());
+            childWidgetsOffsetChanged();
+        }
         else if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
         {
             Panel::leftMouseReleased({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -421,10 +455,12 @@ namespace tgui
         if ((m_verticalScrollbar->isMouseDown() && m_verticalScrollbar->isMouseDownOnThumb()) || m_verticalScrollbar->mouseOnWidget(pos - getPosition()))
         {
             m_verticalScrollbar->mouseMoved(pos - getPosition());
+            childWidgetsOffsetChanged();
         }
         else if ((m_horizontalScrollbar->isMouseDown() && m_horizontalScrollbar->isMouseDownOnThumb()) || m_horizontalScrollbar->mouseOnWidget(pos - getPosition()))
         {
             m_horizontalScrollbar->mouseMoved(pos - getPosition());
+            childWidgetsOffsetChanged();
         }
         else // Mouse not on scrollbar or dragging the scrollbar thumb
         {
@@ -461,11 +497,13 @@ namespace tgui
         if (m_horizontalScrollbar->isShown() && m_horizontalScrollbar->mouseOnWidget(pos - getPosition()))
         {
             m_horizontalScrollbar->mouseWheelScrolled(delta, pos - getPosition());
+            childWidgetsOffsetChanged();
             mouseMoved(pos);
         }
         else if (m_verticalScrollbar->isShown())
         {
             m_verticalScrollbar->mouseWheelScrolled(delta, pos - getPosition());
+            childWidgetsOffsetChanged();
             mouseMoved(pos);
         }
 
@@ -508,7 +546,7 @@ namespace tgui
                     return toolTip;
             }
 
-            if (m_toolTip)
+            if (m_coldData && m_coldData->toolTip)
                 return getToolTip();
         }
 
@@ -569,6 +607,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ScrollablePanel::widgetsChangedInBatch()
+    {
+        if (m_contentSize == Vector2f{0, 0})
+        {
+            recalculateMostBottomRightPosition();
+            updateScrollbars();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ScrollablePanel::rendererChanged(const std::string& property)
     {
         if (property == "scrollbar")
@@ -700,6 +749,9 @@ namespace tgui
 
         const float horizontalSpeed = 40.f * (static_cast<float>(m_horizontalScrollbar->getMaximum() - m_horizontalScrollbar->getViewportSize()) / m_horizontalScrollbar->getViewportSize());
         m_horizontalScrollbar->setScrollAmount(static_cast<unsigned int>(std::ceil(std::sqrt(horizontalSpeed))));
+
+        // Changing the maximum or viewport size may have moved the scrollbar values
+        childWidgetsOffsetChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
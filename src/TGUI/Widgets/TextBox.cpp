@@ -137,13 +137,105 @@ namespace tgui
             m_text = text;
 
         rearrangeText(false);
+
+        if (removeOldestLines(m_lineLimit, m_characterLimit) > 0)
+            recalculatePositions();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        if (text.isEmpty())
+            return;
+
+        // Remove all the excess characters when a character limit is set
+        if ((m_maxChars > 0) && (m_text.getSize() + text.getSize() > m_maxChars))
+        {
+            if (m_text.getSize() < m_maxChars)
+                addText(text.substring(0, m_maxChars - m_text.getSize()));
+            return;
+        }
+
+        // Rearrange the whole text when the lines can't be updated incrementally
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr) || m_lines.empty())
+        {
+            setText(m_text + text);
+            return;
+        }
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+        if (m_verticalScroll->isShown())
+            maxLineWidth -= m_verticalScroll->getSize().x;
+
+        if (maxLineWidth <= 0)
+        {
+            setText(m_text + text);
+            return;
+        }
+
+        const std::size_t lastLineIndex = m_lines.size() - 1;
+        const std::size_t lastLineStart = m_text.getSize() - m_lines[lastLineIndex].getSize();
+        const bool caretAtEnd = (m_selStart == m_selEnd) && (m_selEnd == sf::Vector2<std::size_t>{m_lines[lastLineIndex].getSize(), lastLineIndex});
+        const bool scrolledToBottom = !m_verticalScroll->isShown()
+                                   || (m_verticalScroll->getValue() + m_verticalScroll->getViewportSize() >= m_verticalScroll->getMaximum());
+
+        m_text += text;
+
+        // The lines above the last one don't change, so only the last line has to be word-wrapped together with the new text
+        const sf::String string = Text::wordWrap(maxLineWidth, m_text.substring(lastLineStart), m_fontCached, m_textSize, false, false);
+
+        m_lines.pop_back();
+        std::size_t searchPosStart = 0;
+        std::size_t newLinePos = 0;
+        while (newLinePos != sf::String::InvalidPos)
+        {
+            newLinePos = string.find('\n', searchPosStart);
+
+            if (newLinePos != sf::String::InvalidPos)
+                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
+            else
+                m_lines.push_back(string.substring(searchPosStart));
+
+            searchPosStart = newLinePos + 1;
+        }
+
+        if (caretAtEnd)
+        {
+            m_selStart = sf::Vector2<std::size_t>(m_lines.back().getSize(), m_lines.size() - 1);
+            m_selEnd = m_selStart;
+        }
+        else // A selection on the old last line may now end up on the next lines
+        {
+            for (auto* pos : {&m_selStart, &m_selEnd})
+            {
+                while ((pos->y + 1 < m_lines.size()) && (pos->x > m_lines[pos->y].getSize()))
+                {
+                    pos->x -= m_lines[pos->y].getSize();
+                    pos->y++;
+                }
+            }
+        }
+
+        // When a limit is exceeded, remove more than needed so that the next calls don't have to remove anything
+        if (((m_lineLimit > 0) && (m_lines.size() > m_lineLimit)) || ((m_characterLimit > 0) && (m_text.getSize() > m_characterLimit)))
+            removeOldestLines(m_lineLimit - (m_lineLimit / 4), m_characterLimit - (m_characterLimit / 4));
+
+        const bool scrollbarShown = m_verticalScroll->isShown();
+        updateScrollbarMaximum();
+
+        // The text has to be word-wrapped again if the scrollbar just appeared or disappeared
+        if (scrollbarShown != m_verticalScroll->isShown())
+        {
+            rearrangeText(true);
+            return;
+        }
+
+        if (scrolledToBottom)
+            m_verticalScroll->setValue(m_verticalScroll->getMaximum());
+
+        recalculatePositions();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -220,6 +312,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::setLineLimit(std::size_t maxLines)
+    {
+        m_lineLimit = maxLines;
+
+        if (removeOldestLines(m_lineLimit, m_characterLimit) > 0)
+            recalculatePositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::getLineLimit() const
+    {
+        return m_lineLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::setCharacterLimit(std::size_t maxChars)
+    {
+        m_characterLimit = maxChars;
+
+        if (removeOldestLines(m_lineLimit, m_characterLimit) > 0)
+            recalculatePositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::getCharacterLimit() const
+    {
+        return m_characterLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::setVerticalScrollbarPresent(bool present)
     {
         if (present)
@@ -323,6 +449,7 @@ namespace tgui
     #endif
 
         Widget::setFocused(focused);
+        updateRequiredChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,6 +540,7 @@ namespace tgui
 
                 // If the next click comes soon enough then it will be a double click
                 m_possibleDoubleClick = true;
+                updateRequiredChanged();
             }
 
             // Update the texts
@@ -1194,10 +1322,7 @@ namespace tgui
 
         // Tell the scrollbar how many pixels the text contains
         const bool scrollbarShown = m_verticalScroll->isShown();
-
-        m_verticalScroll->setMaximum(static_cast<unsigned int>(m_lines.size() * m_lineHeight
-                                                              + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
-                                                              + Text::getExtraVerticalPadding(m_textSize)));
+        updateScrollbarMaximum();
 
         // We may have to recalculate what we just calculated if the scrollbar just appeared or disappeared
         if (scrollbarShown != m_verticalScroll->isShown())
@@ -1211,73 +1336,66 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateSelectionTexts()
+    std::size_t TextBox::removeOldestLines(std::size_t lineLimit, std::size_t characterLimit)
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
+        // Find out how many lines and characters have to be removed, but always keep the last line
+        std::size_t removedLines = 0;
+        std::size_t removedChars = 0;
+        while (removedLines + 1 < m_lines.size())
         {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
+            const bool linesFit = (lineLimit == 0) || (m_lines.size() - removedLines <= lineLimit);
+            const bool charactersFit = (characterLimit == 0) || (m_text.getSize() - removedChars <= characterLimit);
+            if (linesFit && charactersFit)
+                break;
 
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString("");
-            m_textSelection2.setString("");
-            m_textAfterSelection1.setString("");
-            m_textAfterSelection2.setString("");
+            removedChars += m_lines[removedLines].getSize();
+            if ((removedChars < m_text.getSize()) && (m_text[removedChars] == '\n'))
+                ++removedChars;
+
+            ++removedLines;
         }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+        if (removedLines == 0)
+            return 0;
 
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
+        m_text.erase(0, removedChars);
+        m_lines.erase(m_lines.begin(), m_lines.begin() + removedLines);
 
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
+        for (auto* pos : {&m_selStart, &m_selEnd})
+        {
+            if (pos->y >= removedLines)
+                pos->y -= removedLines;
             else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
+                *pos = {0, 0};
+        }
 
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString("");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
+        // Keep the same lines in view
+        const unsigned int removedHeight = static_cast<unsigned int>(removedLines * m_lineHeight);
+        const unsigned int oldScrollValue = m_verticalScroll->getValue();
+        const bool scrollbarShown = m_verticalScroll->isShown();
 
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
+        updateScrollbarMaximum();
+        m_verticalScroll->setValue((oldScrollValue > removedHeight) ? (oldScrollValue - removedHeight) : 0);
 
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
+        if (scrollbarShown != m_verticalScroll->isShown())
+            rearrangeText(true);
 
-                m_textSelection2.setString(string);
-            }
+        return removedLines;
+    }
 
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
+    void TextBox::updateScrollbarMaximum()
+    {
+        m_verticalScroll->setMaximum(static_cast<unsigned int>(m_lines.size() * m_lineHeight
+                                                              + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
+                                                              + Text::getExtraVerticalPadding(m_textSize)));
+    }
 
-                m_textAfterSelection2.setString(string);
-            }
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::updateSelectionTexts()
+    {
         // Check if the caret is located above or below the view
         if (isVerticalScrollbarPresent())
         {
@@ -1318,11 +1436,22 @@ namespace tgui
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
+
+            // The caret no longer has to blink when the widget was unfocused
+            if (!isUpdateRequired())
+                updateRequiredChanged();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TextBox::isUpdateRequired() const
+    {
+        return m_focused || m_possibleDoubleClick || Widget::isUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::recalculatePositions()
     {
         if (!m_fontCached)
@@ -1342,111 +1471,191 @@ namespace tgui
             m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
         }
 
-        // Calculate the position of the text objects
-        m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
-        if (m_selStart != m_selEnd)
+        m_visibleTextsOutdated = true;
+        recalculateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::recalculateVisibleLines()
+    {
+        const std::size_t oldTopLine = m_topLine;
+        const std::size_t oldVisibleLines = m_visibleLines;
+
+        m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
+
+        // Store which area is visible
+        if (m_verticalScroll->isShown())
         {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
+            m_verticalScroll->setPosition({getSize().x - m_bordersCached.getRight() - m_verticalScroll->getSize().x, m_bordersCached.getTop()});
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+            m_topLine = m_verticalScroll->getValue() / m_lineHeight;
 
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSize);
+            // The scrollbar may be standing between lines in which case one more line is visible
+            if (((static_cast<unsigned int>(getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) % m_lineHeight) != 0) || ((m_verticalScroll->getValue() % m_lineHeight) != 0))
+                m_visibleLines++;
+        }
+        else // There is no scrollbar
+        {
+            m_topLine = 0;
+            m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
+        }
 
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
+        // Only the visible lines are stored in the text objects, so they have to be rebuilt when scrolling
+        if (m_visibleTextsOutdated || (m_topLine != oldTopLine) || (m_visibleLines != oldVisibleLines))
+            updateVisibleTexts();
+    }
 
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
+    void TextBox::updateVisibleTexts()
+    {
+        m_visibleTextsOutdated = false;
+        m_selectionRects.clear();
 
-            if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
+        if (!m_fontCached || m_lines.empty())
+            return;
 
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
+        // One extra line is included as it may be partially visible
+        const std::size_t firstLine = std::min(m_topLine, m_lines.size() - 1);
+        const std::size_t lastLine = std::min(firstLine + m_visibleLines, m_lines.size() - 1);
 
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
 
-                if (!m_lines[selectionStart.y].isEmpty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
+        // Only the part of the selection that lies on the visible lines matters
+        if (selectionStart.y < firstLine)
+            selectionStart = {0, firstLine};
+        if (selectionEnd.y > lastLine)
+            selectionEnd = {m_lines[lastLine].getSize(), lastLine};
 
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(firstLine * m_lineHeight)});
 
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+        // If there is no visible selection then just put all visible lines in m_textBeforeSelection
+        if ((m_selStart == m_selEnd) || (selectionStart.y > selectionEnd.y) || ((selectionStart.y == selectionEnd.y) && (selectionStart.x >= selectionEnd.x)))
+        {
+            sf::String displayedText;
+            for (std::size_t i = firstLine; i <= lastLine; ++i)
+                displayedText += m_lines[i] + "\n";
 
-                    if (!m_lines[i].isEmpty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
-                    }
-                }
+            m_textBeforeSelection.setString(displayedText);
+            m_textSelection1.setString("");
+            m_textSelection2.setString("");
+            m_textAfterSelection1.setString("");
+            m_textAfterSelection2.setString("");
+            return;
+        }
 
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
+        // Set the text before the selection
+        {
+            sf::String string;
+            for (std::size_t i = firstLine; i < selectionStart.y; ++i)
+                string += m_lines[i] + "\n";
 
-                    if (m_textSelection2.getString() != "")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
-                        m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                    textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
-                    }
-                    else
-                        m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-                }
-            }
+            string += m_lines[selectionStart.y].substring(0, selectionStart.x);
+            m_textBeforeSelection.setString(string);
         }
 
-        recalculateVisibleLines();
-    }
+        // Set the selected text
+        if (selectionStart.y == selectionEnd.y)
+        {
+            m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
+            m_textSelection2.setString("");
+        }
+        else
+        {
+            m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            sf::String string;
+            for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
+                string += m_lines[i] + "\n";
 
-    void TextBox::recalculateVisibleLines()
-    {
-        m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
+            string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
 
-        // Store which area is visible
-        if (m_verticalScroll->isShown())
+            m_textSelection2.setString(string);
+        }
+
+        // Set the text after the selection
         {
-            m_verticalScroll->setPosition({getSize().x - m_bordersCached.getRight() - m_verticalScroll->getSize().x, m_bordersCached.getTop()});
+            m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
 
-            m_topLine = m_verticalScroll->getValue() / m_lineHeight;
+            sf::String string;
+            for (std::size_t i = selectionEnd.y + 1; i <= lastLine; ++i)
+                string += m_lines[i] + "\n";
 
-            // The scrollbar may be standing between lines in which case one more line is visible
-            if (((static_cast<unsigned int>(getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) % m_lineHeight) != 0) || ((m_verticalScroll->getValue() % m_lineHeight) != 0))
-                m_visibleLines++;
+            m_textAfterSelection2.setString(string);
         }
-        else // There is no scrollbar
+
+        float kerningSelectionStart = 0;
+        if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
+            kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSize);
+
+        float kerningSelectionEnd = 0;
+        if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
+            kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
+
+        // Calculate the position of the text objects
+        if (selectionStart.x > 0)
         {
-            m_topLine = 0;
-            m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
+            m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
+                                          static_cast<float>(selectionStart.y * m_lineHeight)});
+        }
+        else
+            m_textSelection1.setPosition({textOffset, static_cast<float>(selectionStart.y * m_lineHeight)});
+
+        m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
+
+        if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
+        {
+            m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
+                                               m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
+        }
+        else
+            m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
+                                               m_textSelection1.getPosition().y});
+
+        m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
+
+        // Recalculate the selection rectangles
+        sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
+        m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
+
+        if (!m_lines[selectionStart.y].isEmpty())
+        {
+            m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
+
+            // There is kerning when the selection is on just this line
+            if (selectionStart.y == selectionEnd.y)
+                m_selectionRects.back().width += kerningSelectionEnd;
+        }
+
+        for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
+        {
+            m_selectionRects.back().width += textOffset;
+            m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+
+            if (!m_lines[i].isEmpty())
+            {
+                tempText.setString(m_lines[i]);
+                m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
+            }
+        }
+
+        if (selectionStart.y != selectionEnd.y)
+        {
+            m_selectionRects.back().width += textOffset;
+
+            if (m_textSelection2.getString() != "")
+            {
+                tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
+                m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
+                                            textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
+            }
+            else
+                m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
         }
     }
 
@@ -1559,6 +1768,11 @@ namespace tgui
         if (m_readOnly)
             node->propertyValuePairs["ReadOnly"] = std::make_unique<DataIO::ValueNode>("true");
 
+        if (m_lineLimit > 0)
+            node->propertyValuePairs["LineLimit"] = std::make_unique<DataIO::ValueNode>(to_string(m_lineLimit));
+        if (m_characterLimit > 0)
+            node->propertyValuePairs["CharacterLimit"] = std::make_unique<DataIO::ValueNode>(to_string(m_characterLimit));
+
         if (!isVerticalScrollbarPresent())
             node->propertyValuePairs["VerticalScrollbarPresent"] = std::make_unique<DataIO::ValueNode>("false");
 
@@ -1577,6 +1791,10 @@ namespace tgui
             setTextSize(tgui::stoi(node->propertyValuePairs["textsize"]->value));
         if (node->propertyValuePairs["maximumcharacters"])
             setMaximumCharacters(tgui::stoi(node->propertyValuePairs["maximumcharacters"]->value));
+        if (node->propertyValuePairs["linelimit"])
+            setLineLimit(tgui::stoi(node->propertyValuePairs["linelimit"]->value));
+        if (node->propertyValuePairs["characterlimit"])
+            setCharacterLimit(tgui::stoi(node->propertyValuePairs["characterlimit"]->value));
         if (node->propertyValuePairs["readonly"])
             setReadOnly(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["readonly"]->value).getBool());
         if (node->propertyValuePairs["verticalscrollbarpresent"])
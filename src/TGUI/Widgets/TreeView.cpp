@@ -0,0 +1,1166 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Widgets/TreeView.hpp>
+#include <TGUI/Clipping.hpp>
+#include <cstdint>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    constexpr std::size_t TreeView::npos;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TreeView::TreeView()
+    {
+        m_type = "TreeView";
+
+        m_draggableWidget = true;
+
+        m_renderer = aurora::makeCopied<ListBoxRenderer>();
+        setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
+
+        setTextSize(getGlobalTextSize());
+        setItemHeight(static_cast<unsigned int>(Text::getLineHeight(m_fontCached, m_textSize, m_textStyleCached) * 1.25f));
+        setSize({Text::getLineHeight(m_fontCached, m_textSize, m_textStyleCached) * 10,
+                 (m_itemHeight * 7) + m_paddingCached.getTop() + m_paddingCached.getBottom() + m_bordersCached.getTop() + m_bordersCached.getBottom()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TreeView::Ptr TreeView::create()
+    {
+        return std::make_shared<TreeView>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TreeView::Ptr TreeView::copy(TreeView::ConstPtr treeView)
+    {
+        if (treeView)
+            return std::static_pointer_cast<TreeView>(treeView->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListBoxRenderer* TreeView::getSharedRenderer()
+    {
+        return aurora::downcast<ListBoxRenderer*>(Widget::getSharedRenderer());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListBoxRenderer* TreeView::getSharedRenderer() const
+    {
+        return aurora::downcast<const ListBoxRenderer*>(Widget::getSharedRenderer());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListBoxRenderer* TreeView::getRenderer()
+    {
+        return aurora::downcast<ListBoxRenderer*>(Widget::getRenderer());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListBoxRenderer* TreeView::getRenderer() const
+    {
+        return aurora::downcast<const ListBoxRenderer*>(Widget::getRenderer());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::setSize(const Layout2d& size)
+    {
+        Widget::setSize(size);
+
+        m_bordersCached.updateParentSize(getSize());
+        m_paddingCached.updateParentSize(getSize());
+
+        m_spriteBackground.setSize(getInnerSize());
+
+        updateScrollbar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::setChildrenProvider(const ChildrenProvider& provider)
+    {
+        updateHoveringNode(npos);
+        updateSelectedNode(npos);
+
+        m_childrenProvider = provider;
+
+        unloadChildren(npos);
+        loadChildren(npos);
+        m_rows = m_rootNodes;
+        updateRowIndices(0);
+
+        updateScrollbar();
+        updateVisibleItems(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::expand(const std::vector<sf::String>& hierarchy)
+    {
+        if (hierarchy.empty())
+            return false;
+
+        // Every item in the hierarchy is expanded, which loads the children that are searched in the next step
+        std::size_t node = npos;
+        for (const auto& text : hierarchy)
+        {
+            node = findChild(node, text);
+            if ((node == npos) || !m_nodes[node].hasChildren)
+                return false;
+
+            if (!m_nodes[node].expanded)
+                expandRow(findRow(node));
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::collapse(const std::vector<sf::String>& hierarchy)
+    {
+        const std::size_t node = findNode(hierarchy);
+        if (node == npos)
+            return false;
+
+        if (m_nodes[node].expanded)
+        {
+            const std::size_t row = findRow(node);
+            if (row != npos)
+                collapseRow(row);
+            else // A parent is collapsed, so none of the rows have to be removed
+                m_nodes[node].expanded = false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::isExpanded(const std::vector<sf::String>& hierarchy) const
+    {
+        const std::size_t node = findNode(hierarchy);
+        return (node != npos) && m_nodes[node].expanded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::collapseAll()
+    {
+        for (auto& node : m_nodes)
+        {
+            node.expanded = false;
+            node.row = npos;
+        }
+
+        if ((m_selectedNode != npos) && (m_nodes[m_selectedNode].parent != npos))
+            updateSelectedNode(npos);
+
+        updateHoveringNode(npos);
+
+        m_rows = m_rootNodes;
+        updateRowIndices(0);
+        updateScrollbar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::reloadChildren(const std::vector<sf::String>& hierarchy)
+    {
+        const std::size_t node = hierarchy.empty() ? npos : findNode(hierarchy);
+        if (!hierarchy.empty() && (node == npos))
+            return false;
+
+        // Deselect the selected item when it is going to be unloaded
+        if (m_selectedNode != npos)
+        {
+            std::size_t ancestor = m_nodes[m_selectedNode].parent;
+            while ((ancestor != npos) && (ancestor != node))
+                ancestor = m_nodes[ancestor].parent;
+
+            if (ancestor == node)
+                updateSelectedNode(npos);
+        }
+
+        updateHoveringNode(npos);
+
+        if (node == npos)
+        {
+            unloadChildren(npos);
+            loadChildren(npos);
+            m_rows = m_rootNodes;
+            updateRowIndices(0);
+        }
+        else
+        {
+            const std::size_t row = findRow(node);
+            if (m_nodes[node].expanded && (row != npos))
+            {
+                // Replace the rows below the item by its new children
+                std::size_t end = row + 1;
+                while ((end < m_rows.size()) && (m_nodes[m_rows[end]].depth > m_nodes[node].depth))
+                    ++end;
+                m_rows.erase(m_rows.begin() + row + 1, m_rows.begin() + end);
+
+                unloadChildren(node);
+                loadChildren(node);
+                m_rows.insert(m_rows.begin() + row + 1, m_nodes[node].children.begin(), m_nodes[node].children.end());
+                updateRowIndices(row + 1);
+            }
+            else
+            {
+                unloadChildren(node);
+                m_nodes[node].expanded = false;
+            }
+        }
+
+        updateScrollbar();
+        updateVisibleItems(true);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::setSelectedItem(const std::vector<sf::String>& hierarchy)
+    {
+        if (hierarchy.empty())
+        {
+            deselectItem();
+            return false;
+        }
+
+        // Make sure that the item is visible
+        if ((hierarchy.size() > 1) && !expand({hierarchy.begin(), hierarchy.end() - 1}))
+        {
+            deselectItem();
+            return false;
+        }
+
+        const std::size_t node = findNode(hierarchy);
+        if (node == npos)
+        {
+            deselectItem();
+            return false;
+        }
+
+        updateSelectedNode(node);
+
+        // Move the scrollbar
+        const std::uint64_t top = static_cast<std::uint64_t>(findRow(node)) * m_itemHeight;
+        const std::uint64_t bottom = top + m_itemHeight;
+        if (top < m_scroll->getValue())
+            m_scroll->setValue(static_cast<unsigned int>(top));
+        else if (bottom > static_cast<std::uint64_t>(m_scroll->getValue()) + m_scroll->getViewportSize())
+            m_scroll->setValue(static_cast<unsigned int>(std::min<std::uint64_t>(bottom - m_scroll->getViewportSize(), m_scroll->getMaximum())));
+
+        updateVisibleItems();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::deselectItem()
+    {
+        updateSelectedNode(npos);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<sf::String> TreeView::getSelectedItem() const
+    {
+        if (m_selectedNode != npos)
+            return getHierarchy(m_selectedNode);
+        else
+            return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::getVisibleItemCount() const
+    {
+        return m_rows.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::getLoadedItemCount() const
+    {
+        return m_nodes.size() - m_freeNodes.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::setItemHeight(unsigned int itemHeight)
+    {
+        m_itemHeight = itemHeight;
+        if (m_requestedTextSize == 0)
+            m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
+
+        m_scroll->setScrollAmount(m_itemHeight);
+        updateScrollbar();
+        updateVisibleItems(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TreeView::getItemHeight() const
+    {
+        return m_itemHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::setTextSize(unsigned int textSize)
+    {
+        m_requestedTextSize = textSize;
+
+        if (textSize)
+            m_textSize = textSize;
+        else
+            m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+
+        updateVisibleItems(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TreeView::getTextSize() const
+    {
+        return m_textSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::setScrollbarValue(unsigned int value)
+    {
+        m_scroll->setValue(value);
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TreeView::getScrollbarValue() const
+    {
+        return m_scroll->getValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::mouseOnWidget(Vector2f pos) const
+    {
+        if (FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos))
+        {
+            if (!m_transparentTextureCached || !m_spriteBackground.isTransparentPixel(pos - getPosition() - m_bordersCached.getOffset()))
+                return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::leftMousePressed(Vector2f pos)
+    {
+        pos -= getPosition();
+
+        m_mouseDown = true;
+
+        if (m_scroll->mouseOnWidget(pos))
+        {
+            m_scroll->leftMousePressed(pos);
+            updateVisibleItems();
+            return;
+        }
+
+        const int row = getRowAtPosition(pos);
+        if (row < 0)
+        {
+            m_possibleDoubleClick = false;
+            updateSelectedNode(npos);
+            return;
+        }
+
+        // Clicking on the arrow in front of the item expands or collapses it
+        const std::size_t node = m_rows[row];
+        const float arrowLeft = getItemsArea().left + (m_nodes[node].depth * m_itemHeight);
+        if (m_nodes[node].hasChildren && (pos.x >= arrowLeft) && (pos.x < arrowLeft + m_itemHeight))
+        {
+            m_possibleDoubleClick = false;
+
+            if (m_nodes[node].expanded)
+                collapseRow(static_cast<std::size_t>(row));
+            else
+                expandRow(static_cast<std::size_t>(row));
+        }
+        else
+        {
+            updateHoveringNode(node);
+
+            if (m_selectedNode != node)
+            {
+                m_possibleDoubleClick = false;
+
+                updateSelectedNode(node);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::leftMouseReleased(Vector2f pos)
+    {
+        if (m_mouseDown && !m_scroll->isMouseDown())
+        {
+            // Check if you double-clicked
+            if (m_possibleDoubleClick)
+            {
+                m_possibleDoubleClick = false;
+
+                if (m_selectedNode != npos)
+                    onDoubleClick.emit(this, m_nodes[m_selectedNode].text, getHierarchy(m_selectedNode));
+
+                // Double clicking an item also expands or collapses it
+                if ((m_selectedNode != npos) && m_nodes[m_selectedNode].hasChildren)
+                {
+                    const std::size_t row = findRow(m_selectedNode);
+                    if (row != npos)
+                    {
+                        if (m_nodes[m_selectedNode].expanded)
+                            collapseRow(row);
+                        else
+                            expandRow(row);
+                    }
+                }
+            }
+            else // This is the first click
+            {
+                m_animationTimeElapsed = {};
+                m_possibleDoubleClick = true;
+                updateRequiredChanged();
+            }
+        }
+
+        // Clicking on an arrow of the scrollbar changes its value when the mouse is released
+        m_scroll->leftMouseReleased(pos - getPosition());
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::mouseMoved(Vector2f pos)
+    {
+        pos -= getPosition();
+
+        if (!m_mouseHover)
+            mouseEnteredWidget();
+
+        // Check if the mouse event should go to the scrollbar
+        if ((m_scroll->isMouseDown() && m_scroll->isMouseDownOnThumb()) || m_scroll->mouseOnWidget(pos))
+        {
+            m_scroll->mouseMoved(pos);
+            updateHoveringNode(npos);
+            updateVisibleItems();
+        }
+        else // Mouse not on scrollbar or dragging the scrollbar thumb
+        {
+            m_scroll->mouseNoLongerOnWidget();
+
+            const int row = getRowAtPosition(pos);
+            updateHoveringNode((row >= 0) ? m_rows[row] : npos);
+
+            // If the mouse is held down then select the item below the mouse
+            if (m_mouseDown && !m_scroll->isMouseDown() && (m_hoveringNode != npos) && (m_selectedNode != m_hoveringNode))
+            {
+                m_possibleDoubleClick = false;
+
+                updateSelectedNode(m_hoveringNode);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::mouseWheelScrolled(float delta, Vector2f pos)
+    {
+        if (m_scroll->isShown())
+        {
+            m_scroll->mouseWheelScrolled(delta, pos - getPosition());
+            updateVisibleItems();
+
+            // Update on which item the mouse is hovering
+            mouseMoved(pos);
+            return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::mouseNoLongerOnWidget()
+    {
+        Widget::mouseNoLongerOnWidget();
+        m_scroll->mouseNoLongerOnWidget();
+
+        updateHoveringNode(npos);
+
+        m_possibleDoubleClick = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::mouseNoLongerDown()
+    {
+        Widget::mouseNoLongerDown();
+        m_scroll->mouseNoLongerDown();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& TreeView::getSignal(std::string signalName)
+    {
+        if (signalName == toLower(onItemSelect.getName()))
+            return onItemSelect;
+        else if (signalName == toLower(onDoubleClick.getName()))
+            return onDoubleClick;
+        else if (signalName == toLower(onExpand.getName()))
+            return onExpand;
+        else if (signalName == toLower(onCollapse.getName()))
+            return onCollapse;
+        else
+            return Widget::getSignal(std::move(signalName));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::rendererChanged(const std::string& property)
+    {
+        if (property == "borders")
+        {
+            m_bordersCached = getSharedRenderer()->getBorders();
+            setSize(m_size);
+        }
+        else if (property == "padding")
+        {
+            m_paddingCached = getSharedRenderer()->getPadding();
+            setSize(m_size);
+        }
+        else if (property == "textcolor")
+        {
+            m_textColorCached = getSharedRenderer()->getTextColor();
+            updateItemColorsAndStyle();
+        }
+        else if (property == "textcolorhover")
+        {
+            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+            updateItemColorsAndStyle();
+        }
+        else if (property == "selectedtextcolor")
+        {
+            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+            updateItemColorsAndStyle();
+        }
+        else if (property == "selectedtextcolorhover")
+        {
+            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+            updateItemColorsAndStyle();
+        }
+        else if (property == "texturebackground")
+        {
+            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+        }
+        else if (property == "textstyle")
+        {
+            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            updateItemColorsAndStyle();
+        }
+        else if (property == "selectedtextstyle")
+        {
+            m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+            updateItemColorsAndStyle();
+        }
+        else if (property == "scrollbar")
+        {
+            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+        }
+        else if (property == "scrollbarwidth")
+        {
+            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+            m_scroll->setSize({width, m_scroll->getSize().y});
+            setSize(m_size);
+        }
+        else if (property == "bordercolor")
+        {
+            m_borderColorCached = getSharedRenderer()->getBorderColor();
+        }
+        else if (property == "backgroundcolor")
+        {
+            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+        }
+        else if (property == "backgroundcolorhover")
+        {
+            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+        }
+        else if (property == "selectedbackgroundcolor")
+        {
+            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+        }
+        else if (property == "selectedbackgroundcolorhover")
+        {
+            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+        }
+        else if (property == "opacity")
+        {
+            Widget::rendererChanged(property);
+
+            m_scroll->setInheritedOpacity(m_opacityCached);
+            m_spriteBackground.setOpacity(m_opacityCached);
+            for (auto& item : m_visibleItems)
+                item.text.setOpacity(m_opacityCached);
+        }
+        else if (property == "font")
+        {
+            Widget::rendererChanged(property);
+
+            // Recalculate the text size with the new font
+            if (m_requestedTextSize == 0)
+                m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+
+            updateVisibleItems(true);
+        }
+        else
+            Widget::rendererChanged(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> TreeView::save(SavingRenderersMap& renderers) const
+    {
+        auto node = Widget::save(renderers);
+
+        node->propertyValuePairs["TextSize"] = std::make_unique<DataIO::ValueNode>(to_string(m_textSize));
+        node->propertyValuePairs["ItemHeight"] = std::make_unique<DataIO::ValueNode>(to_string(m_itemHeight));
+
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
+    {
+        Widget::load(node, renderers);
+
+        if (node->propertyValuePairs["textsize"])
+            setTextSize(tgui::stoi(node->propertyValuePairs["textsize"]->value));
+        if (node->propertyValuePairs["itemheight"])
+            setItemHeight(tgui::stoi(node->propertyValuePairs["itemheight"]->value));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f TreeView::getInnerSize() const
+    {
+        return {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(), getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect TreeView::getItemsArea() const
+    {
+        float width = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
+        if (m_scroll->isShown())
+            width -= m_scroll->getSize().x;
+
+        return {m_bordersCached.getLeft() + m_paddingCached.getLeft(), m_bordersCached.getTop() + m_paddingCached.getTop(),
+                std::max(0.f, width), std::max(0.f, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom())};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int TreeView::getRowAtPosition(Vector2f pos) const
+    {
+        const FloatRect area = getItemsArea();
+        if ((m_itemHeight == 0) || !area.contains(pos))
+            return -1;
+
+        const std::size_t row = (m_scroll->getValue() + static_cast<std::size_t>(pos.y - area.top)) / m_itemHeight;
+        if (row < m_rows.size())
+            return static_cast<int>(row);
+        else
+            return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::findNode(const std::vector<sf::String>& hierarchy) const
+    {
+        std::size_t node = npos;
+        for (const auto& text : hierarchy)
+        {
+            node = findChild(node, text);
+            if (node == npos)
+                return npos;
+        }
+
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::findChild(std::size_t parent, const sf::String& text) const
+    {
+        const auto& children = (parent != npos) ? m_nodes[parent].children : m_rootNodes;
+        for (const auto child : children)
+        {
+            if (m_nodes[child].text == text)
+                return child;
+        }
+
+        return npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<sf::String> TreeView::getHierarchy(std::size_t node) const
+    {
+        std::vector<sf::String> hierarchy(m_nodes[node].depth + 1);
+        for (auto it = hierarchy.rbegin(); it != hierarchy.rend(); ++it)
+        {
+            *it = m_nodes[node].text;
+            node = m_nodes[node].parent;
+        }
+
+        return hierarchy;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::loadChildren(std::size_t node)
+    {
+        std::vector<Item> items;
+        if (m_childrenProvider)
+            items = m_childrenProvider((node != npos) ? getHierarchy(node) : std::vector<sf::String>{});
+
+        const unsigned int depth = (node != npos) ? m_nodes[node].depth + 1 : 0;
+
+        std::vector<std::size_t> children;
+        children.reserve(items.size());
+        for (auto& item : items)
+        {
+            std::size_t index;
+            if (!m_freeNodes.empty())
+            {
+                index = m_freeNodes.back();
+                m_freeNodes.pop_back();
+                m_nodes[index] = {};
+            }
+            else
+            {
+                index = m_nodes.size();
+                m_nodes.emplace_back();
+            }
+
+            Node& child = m_nodes[index];
+            child.text = std::move(item.text);
+            child.parent = node;
+            child.depth = depth;
+            child.hasChildren = item.hasChildren;
+            children.push_back(index);
+        }
+
+        if (node != npos)
+        {
+            m_nodes[node].children = std::move(children);
+            m_nodes[node].childrenLoaded = true;
+        }
+        else
+            m_rootNodes = std::move(children);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::unloadChildren(std::size_t node)
+    {
+        if (node == npos)
+        {
+            m_nodes.clear();
+            m_freeNodes.clear();
+            m_rootNodes.clear();
+            m_rows.clear();
+            m_visibleItems.clear();
+            return;
+        }
+
+        std::vector<std::size_t> nodesToRemove = std::move(m_nodes[node].children);
+        m_nodes[node].children.clear();
+        m_nodes[node].childrenLoaded = false;
+
+        while (!nodesToRemove.empty())
+        {
+            const std::size_t child = nodesToRemove.back();
+            nodesToRemove.pop_back();
+
+            nodesToRemove.insert(nodesToRemove.end(), m_nodes[child].children.begin(), m_nodes[child].children.end());
+            m_nodes[child] = {};
+            m_freeNodes.push_back(child);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::addVisibleDescendants(std::size_t node, std::vector<std::size_t>& rows) const
+    {
+        for (const auto child : m_nodes[node].children)
+        {
+            rows.push_back(child);
+            if (m_nodes[child].expanded)
+                addVisibleDescendants(child, rows);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::findRow(std::size_t node) const
+    {
+        return m_nodes[node].row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateRowIndices(std::size_t firstRow)
+    {
+        for (std::size_t row = firstRow; row < m_rows.size(); ++row)
+            m_nodes[m_rows[row]].row = row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::expandRow(std::size_t row)
+    {
+        const std::size_t node = m_rows[row];
+        if (m_nodes[node].expanded || !m_nodes[node].hasChildren)
+            return;
+
+        if (!m_nodes[node].childrenLoaded)
+            loadChildren(node);
+
+        m_nodes[node].expanded = true;
+
+        // Children that were expanded before the node was collapsed are shown again as well
+        std::vector<std::size_t> rows;
+        addVisibleDescendants(node, rows);
+        m_rows.insert(m_rows.begin() + row + 1, rows.begin(), rows.end());
+        updateRowIndices(row + 1);
+
+        updateHoveringNode(npos);
+        updateScrollbar();
+
+        onExpand.emit(this, m_nodes[node].text, getHierarchy(node));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::collapseRow(std::size_t row)
+    {
+        const std::size_t node = m_rows[row];
+        if (!m_nodes[node].expanded)
+            return;
+
+        m_nodes[node].expanded = false;
+
+        // The rows of the subtree directly follow the row of the node and all have a higher depth
+        bool selectedItemHidden = false;
+        std::size_t end = row + 1;
+        while ((end < m_rows.size()) && (m_nodes[m_rows[end]].depth > m_nodes[node].depth))
+        {
+            if (m_rows[end] == m_selectedNode)
+                selectedItemHidden = true;
+
+            m_nodes[m_rows[end]].row = npos;
+            ++end;
+        }
+
+        m_rows.erase(m_rows.begin() + row + 1, m_rows.begin() + end);
+        updateRowIndices(row + 1);
+
+        updateHoveringNode(npos);
+        if (selectedItemHidden)
+            updateSelectedNode(npos);
+
+        updateScrollbar();
+
+        onCollapse.emit(this, m_nodes[node].text, getHierarchy(node));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateScrollbar()
+    {
+        m_scroll->setSize({m_scroll->getSize().x, std::max(0.f, getInnerSize().y)});
+        m_scroll->setViewportSize(static_cast<unsigned int>(std::max(0.f, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom())));
+        m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
+
+        // The scrollbar can't represent more than a few billion pixels
+        const std::uint64_t contentHeight = static_cast<std::uint64_t>(m_rows.size()) * m_itemHeight;
+        m_scroll->setMaximum(static_cast<unsigned int>(std::min<std::uint64_t>(contentHeight, std::numeric_limits<unsigned int>::max())));
+
+        updateVisibleItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateVisibleItems(bool rebuild)
+    {
+        const FloatRect area = getItemsArea();
+        if ((m_itemHeight == 0) || (area.height <= 0))
+        {
+            m_visibleItems.clear();
+            return;
+        }
+
+        const unsigned int scrollValue = m_scroll->getValue();
+        const std::size_t firstRow = std::min<std::size_t>(scrollValue / m_itemHeight, m_rows.size());
+        const std::size_t rowsInView = static_cast<std::size_t>(std::ceil(((scrollValue % m_itemHeight) + area.height) / m_itemHeight));
+        const std::size_t lastRow = std::min(m_rows.size(), firstRow + rowsInView);
+
+        // Nothing has to happen when the same items are still on the screen
+        if (!rebuild && (m_visibleItems.size() == lastRow - firstRow))
+        {
+            bool unchanged = true;
+            for (std::size_t i = 0; (i < m_visibleItems.size()) && unchanged; ++i)
+                unchanged = (m_visibleItems[i].node == m_rows[firstRow + i]);
+
+            if (unchanged)
+                return;
+        }
+
+        // Texts of items that remain on the screen are reused, the other items are measured for the first time.
+        // Expanding and collapsing doesn't change the order of the remaining items, so they are searched from the last match.
+        std::vector<VisibleItem> visibleItems;
+        visibleItems.reserve(lastRow - firstRow);
+        auto oldItemIt = m_visibleItems.begin();
+        for (std::size_t row = firstRow; row < lastRow; ++row)
+        {
+            const std::size_t node = m_rows[row];
+            if (!rebuild)
+            {
+                const auto it = std::find_if(oldItemIt, m_visibleItems.end(), [node](const VisibleItem& item){ return item.node == node; });
+                if (it != m_visibleItems.end())
+                {
+                    visibleItems.push_back(std::move(*it));
+                    oldItemIt = it + 1;
+                    continue;
+                }
+            }
+
+            VisibleItem item;
+            item.node = node;
+            item.text.setFont(m_fontCached);
+            item.text.setOpacity(m_opacityCached);
+            item.text.setCharacterSize(m_textSize);
+            item.text.setString(m_nodes[node].text);
+
+            // Every level is indented by the item height, which leaves room for the arrow in front of the text
+            item.text.setPosition({((m_nodes[node].depth + 1) * m_itemHeight) + Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached),
+                                   (m_itemHeight - item.text.getSize().y) / 2.0f});
+
+            visibleItems.push_back(std::move(item));
+        }
+
+        m_visibleItems = std::move(visibleItems);
+        updateItemColorsAndStyle();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateItemColorsAndStyle()
+    {
+        for (auto& item : m_visibleItems)
+        {
+            const bool selected = (item.node == m_selectedNode);
+            const bool hover = (item.node == m_hoveringNode);
+
+            if (selected && hover && m_selectedTextColorHoverCached.isSet())
+                item.text.setColor(m_selectedTextColorHoverCached);
+            else if (selected && m_selectedTextColorCached.isSet())
+                item.text.setColor(m_selectedTextColorCached);
+            else if (!selected && hover && m_textColorHoverCached.isSet())
+                item.text.setColor(m_textColorHoverCached);
+            else
+                item.text.setColor(m_textColorCached);
+
+            if (selected && m_selectedTextStyleCached.isSet())
+                item.text.setStyle(m_selectedTextStyleCached);
+            else
+                item.text.setStyle(m_textStyleCached);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateHoveringNode(std::size_t node)
+    {
+        if (m_hoveringNode != node)
+        {
+            m_hoveringNode = node;
+            updateItemColorsAndStyle();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateSelectedNode(std::size_t node)
+    {
+        if (m_selectedNode != node)
+        {
+            m_selectedNode = node;
+            updateItemColorsAndStyle();
+
+            if (m_selectedNode != npos)
+                onItemSelect.emit(this, m_nodes[m_selectedNode].text, getHierarchy(m_selectedNode));
+            else
+                onItemSelect.emit(this, "", {});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::update(sf::Time elapsedTime)
+    {
+        Widget::update(elapsedTime);
+
+        if (m_animationTimeElapsed >= sf::milliseconds(getDoubleClickTime()))
+        {
+            m_animationTimeElapsed = {};
+            m_possibleDoubleClick = false;
+            updateRequiredChanged();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::isUpdateRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        states.transform.translate(getPosition());
+        const sf::RenderStates statesForScrollbar = states;
+
+        // Draw the borders
+        if (m_bordersCached != Borders{0})
+        {
+            drawBorders(target, states, m_bordersCached, getSize(), m_borderColorCached);
+            states.transform.translate(m_bordersCached.getOffset());
+        }
+
+        // Draw the background
+        if (m_spriteBackground.isSet())
+            m_spriteBackground.draw(target, states);
+        else
+            drawRectangleShape(target, states, getInnerSize(), m_backgroundColorCached);
+
+        // Draw the items and their selected/hover backgrounds
+        if (!m_visibleItems.empty())
+        {
+            // Set the clipping for all draw calls that happen until this clipping object goes out of scope
+            const FloatRect area = getItemsArea();
+            const Clipping clipping{target, states, {m_paddingCached.getLeft(), m_paddingCached.getTop()}, {area.width, area.height}};
+
+            // Only the offset within the first row is needed, which keeps the positions small in huge trees
+            states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - static_cast<float>(m_scroll->getValue() % m_itemHeight)});
+
+            const Vector2f itemSize = {area.width, static_cast<float>(m_itemHeight)};
+            for (const auto& item : m_visibleItems)
+            {
+                const bool selected = (item.node == m_selectedNode);
+                const bool hover = (item.node == m_hoveringNode);
+                if (selected)
+                {
+                    if (hover && m_selectedBackgroundColorHoverCached.isSet())
+                        drawRectangleShape(target, states, itemSize, m_selectedBackgroundColorHoverCached);
+                    else
+                        drawRectangleShape(target, states, itemSize, m_selectedBackgroundColorCached);
+                }
+                else if (hover && m_backgroundColorHoverCached.isSet())
+                    drawRectangleShape(target, states, itemSize, m_backgroundColorHoverCached);
+
+                // Draw an arrow that points to the right when the item is collapsed and down when it is expanded
+                const Node& node = m_nodes[item.node];
+                if (node.hasChildren)
+                {
+                    const float arrowSize = m_itemHeight * 0.4f;
+                    const float centerX = (node.depth + 0.5f) * m_itemHeight;
+                    const float centerY = m_itemHeight / 2.f;
+                    const Color arrowColor = Color::calcColorOpacity(item.text.getColor(), m_opacityCached);
+
+                    sf::Vertex vertices[3];
+                    if (node.expanded)
+                    {
+                        vertices[0] = {{centerX - arrowSize / 2, centerY - arrowSize / 2}, arrowColor};
+                        vertices[1] = {{centerX + arrowSize / 2, centerY - arrowSize / 2}, arrowColor};
+                        vertices[2] = {{centerX, centerY + arrowSize / 2}, arrowColor};
+                    }
+                    else
+                    {
+                        vertices[0] = {{centerX - arrowSize / 2, centerY - arrowSize / 2}, arrowColor};
+                        vertices[1] = {{centerX - arrowSize / 2, centerY + arrowSize / 2}, arrowColor};
+                        vertices[2] = {{centerX + arrowSize / 2, centerY}, arrowColor};
+                    }
+
+                    target.draw(vertices, 3, sf::PrimitiveType::Triangles, states);
+                }
+
+                item.text.draw(target, states);
+                states.transform.translate({0, static_cast<float>(m_itemHeight)});
+            }
+        }
+
+        // Draw the scrollbar
+        m_scroll->draw(target, statesForScrollbar);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -200,3 +200,130 @@ TEST_CASE("[Animation]") {
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
 }
+
+TEST_CASE("[Animator]") {
+    tgui::Animator animator;
+
+    tgui::Widget::Ptr widget = tgui::ClickableWidget::create();
+    widget->setPosition(30, 15);
+    widget->setSize(120, 30);
+
+    SECTION("Easing") {
+        for (const auto easing : {tgui::Easing::Linear, tgui::Easing::QuadIn, tgui::Easing::QuadOut, tgui::Easing::QuadInOut,
+                                  tgui::Easing::CubicIn, tgui::Easing::CubicOut, tgui::Easing::CubicInOut, tgui::Easing::SineIn,
+                                  tgui::Easing::SineOut, tgui::Easing::SineInOut, tgui::Easing::BackOut, tgui::Easing::BounceOut})
+        {
+            REQUIRE(std::abs(tgui::Animator::ease(easing, 0)) < 0.0001f);
+            REQUIRE(std::abs(tgui::Animator::ease(easing, 1) - 1) < 0.0001f);
+        }
+
+        REQUIRE(tgui::compareFloats(tgui::Animator::ease(tgui::Easing::Linear, 0.25f), 0.25f));
+        REQUIRE(tgui::compareFloats(tgui::Animator::ease(tgui::Easing::QuadIn, 0.5f), 0.25f));
+        REQUIRE(tgui::compareFloats(tgui::Animator::ease(tgui::Easing::QuadOut, 0.5f), 0.75f));
+        REQUIRE(tgui::Animator::ease(tgui::Easing::BackOut, 0.8f) > 1);
+    }
+
+    SECTION("Widget properties") {
+        animator.moveTo(widget, {130, 215}, sf::milliseconds(400));
+        animator.resizeTo(widget, {20, 50}, sf::milliseconds(200));
+        animator.fadeTo(widget, 0, sf::milliseconds(400));
+        REQUIRE(animator.getTweenCount() == 3);
+
+        animator.update(sf::milliseconds(100));
+        REQUIRE(compareVector2f(widget->getPosition(), {55, 65}));
+        REQUIRE(compareVector2f(widget->getSize(), {70, 40}));
+        REQUIRE(tgui::compareFloats(widget->getInheritedOpacity(), 0.75f));
+
+        animator.update(sf::milliseconds(200));
+        REQUIRE(compareVector2f(widget->getPosition(), {105, 165}));
+        REQUIRE(widget->getSize() == sf::Vector2f(20, 50));
+        REQUIRE(animator.getTweenCount() == 2);
+
+        animator.update(sf::milliseconds(500));
+        REQUIRE(widget->getPosition() == sf::Vector2f(130, 215));
+        REQUIRE(widget->getInheritedOpacity() == 0);
+        REQUIRE(animator.getTweenCount() == 0);
+    }
+
+    SECTION("Position is only set once per frame") {
+        unsigned int positionChangedCount = 0;
+        widget->connect("PositionChanged", [&]{ positionChangedCount++; });
+
+        animator.moveTo(widget, {130, 15}, sf::milliseconds(100));
+        animator.moveTo(widget, {230, 15}, sf::milliseconds(100));
+        animator.resizeTo(widget, {20, 50}, sf::milliseconds(100));
+        animator.update(sf::milliseconds(50));
+        REQUIRE(positionChangedCount == 1);
+    }
+
+    SECTION("Custom values") {
+        float value = 0;
+        tgui::Color color;
+        animator.animateFloat(10, 20, sf::milliseconds(100), [&](float newValue){ value = newValue; }, tgui::Easing::QuadIn);
+        animator.animateColor({0, 0, 0, 255}, {200, 100, 50, 55}, sf::milliseconds(100), [&](tgui::Color newColor){ color = newColor; });
+
+        animator.update(sf::milliseconds(50));
+        REQUIRE(tgui::compareFloats(value, 12.5f));
+        REQUIRE(color == tgui::Color(100, 50, 25, 155));
+
+        animator.update(sf::milliseconds(50));
+        REQUIRE(value == 20);
+        REQUIRE(color == tgui::Color(200, 100, 50, 55));
+    }
+
+    SECTION("Sequence") {
+        unsigned int finishedCount = 0;
+        const auto id = animator.sequence({animator.moveTo(widget, {130, 15}, sf::milliseconds(100)),
+                                           animator.wait(sf::milliseconds(100)),
+                                           animator.parallel({animator.moveTo(widget, {130, 115}, sf::milliseconds(100)),
+                                                              animator.fadeTo(widget, 0.5f, sf::milliseconds(200))})});
+        animator.setFinishedCallback(id, [&]{ finishedCount++; });
+
+        animator.update(sf::milliseconds(100));
+        REQUIRE(widget->getPosition() == sf::Vector2f(130, 15));
+
+        animator.update(sf::milliseconds(100));
+        REQUIRE(widget->getPosition() == sf::Vector2f(130, 15));
+        REQUIRE(widget->getInheritedOpacity() == 1);
+
+        // The last tweens start from the position reached by the first one
+        animator.update(sf::milliseconds(50));
+        REQUIRE(compareVector2f(widget->getPosition(), {130, 65}));
+        REQUIRE(tgui::compareFloats(widget->getInheritedOpacity(), 0.875f));
+
+        animator.update(sf::milliseconds(100));
+        REQUIRE(widget->getPosition() == sf::Vector2f(130, 115));
+        REQUIRE(animator.isRunning(id));
+        REQUIRE(finishedCount == 0);
+
+        animator.update(sf::milliseconds(100));
+        REQUIRE(widget->getInheritedOpacity() == 0.5f);
+        REQUIRE(!animator.isRunning(id));
+        REQUIRE(finishedCount == 1);
+    }
+
+    SECTION("Stop") {
+        unsigned int finishedCount = 0;
+        const auto moveId = animator.moveTo(widget, {130, 15}, sf::milliseconds(100));
+        const auto id = animator.sequence({moveId, animator.resizeTo(widget, {20, 50}, sf::milliseconds(100))});
+        animator.setFinishedCallback(moveId, [&]{ finishedCount++; });
+
+        animator.update(sf::milliseconds(50));
+        animator.stop(moveId);
+        REQUIRE(widget->getPosition() == sf::Vector2f(80, 15));
+        REQUIRE(finishedCount == 1);
+        REQUIRE(animator.isRunning(id));
+
+        animator.stop(id, true);
+        REQUIRE(widget->getSize() == sf::Vector2f(20, 50));
+        REQUIRE(!animator.isRunning(id));
+        REQUIRE(animator.getTweenCount() == 0);
+    }
+
+    SECTION("Destroyed widget") {
+        animator.moveTo(widget, {130, 15}, sf::milliseconds(100));
+        widget = nullptr;
+        animator.update(sf::milliseconds(50));
+        REQUIRE(animator.getTweenCount() == 0);
+    }
+}
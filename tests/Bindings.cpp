@@ -0,0 +1,113 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Bindings.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <thread>
+
+TEST_CASE("[Bindings]")
+{
+    tgui::Bindings bindings;
+
+    SECTION("Arithmetic values")
+    {
+        auto progressBar = tgui::ProgressBar::create();
+        auto value = tgui::BoundValue<int>::create(10);
+        bindings.bind(value, progressBar, &tgui::ProgressBar::setValue);
+        REQUIRE(bindings.getBindingCount() == 1);
+
+        // The initial value is passed during the first update
+        REQUIRE(bindings.update() == 1);
+        REQUIRE(progressBar->getValue() == 10);
+        REQUIRE(bindings.update() == 0);
+
+        // Intermediate values are skipped
+        unsigned int valueChangedCount = 0;
+        progressBar->connect("ValueChanged", [&]{ valueChangedCount++; });
+        for (int i = 20; i <= 50; ++i)
+            value->set(i);
+
+        REQUIRE(bindings.update() == 1);
+        REQUIRE(progressBar->getValue() == 50);
+        REQUIRE(valueChangedCount == 1);
+
+        // The value can be set from other threads
+        std::thread producer1([value]{ for (int i = 0; i < 1000; ++i) value->set(60); });
+        std::thread producer2([value]{ for (int i = 0; i < 1000; ++i) value->set(60); });
+        producer1.join();
+        producer2.join();
+        REQUIRE(bindings.update() == 1);
+        REQUIRE(progressBar->getValue() == 60);
+    }
+
+    SECTION("Other values")
+    {
+        auto label = tgui::Label::create();
+        auto text = tgui::BoundValue<sf::String>::create("Initial");
+        bindings.bind(text, label, [](tgui::Label& l, const sf::String& str){ l.setText("Value: " + str); });
+
+        REQUIRE(bindings.update() == 1);
+        REQUIRE(label->getText() == "Value: Initial");
+
+        std::thread producer([text]{
+            for (int i = 0; i <= 1000; ++i)
+                text->set(tgui::to_string(i));
+        });
+        producer.join();
+
+        REQUIRE(bindings.update() == 1);
+        REQUIRE(label->getText() == "Value: 1000");
+        REQUIRE(bindings.update() == 0);
+    }
+
+    SECTION("Unbinding")
+    {
+        auto progressBar1 = tgui::ProgressBar::create();
+        auto progressBar2 = tgui::ProgressBar::create();
+        auto value = tgui::BoundValue<unsigned int>::create(5);
+        bindings.bind(value, progressBar1, &tgui::ProgressBar::setValue);
+        bindings.bind(value, progressBar2, &tgui::ProgressBar::setMaximum);
+        REQUIRE(bindings.getBindingCount() == 2);
+
+        // Both widgets receive the value
+        REQUIRE(bindings.update() == 2);
+        REQUIRE(progressBar1->getValue() == 5);
+        REQUIRE(progressBar2->getMaximum() == 5);
+
+        value->set(7);
+        bindings.unbind(progressBar1);
+        REQUIRE(bindings.getBindingCount() == 1);
+        REQUIRE(bindings.update() == 1);
+        REQUIRE(progressBar1->getValue() == 5);
+        REQUIRE(progressBar2->getMaximum() == 7);
+
+        // Bindings are removed when their widget is destroyed
+        progressBar2 = nullptr;
+        REQUIRE(bindings.update() == 0);
+        REQUIRE(bindings.getBindingCount() == 0);
+    }
+}
@@ -28,6 +28,32 @@
 #include <TGUI/Widgets/EditBox.hpp>
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Widgets/HorizontalLayout.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
+
+namespace
+{
+    // Widget that remembers the clipping area that was active when it was drawn
+    class ClipRecorderWidget : public tgui::ClickableWidget
+    {
+    public:
+        typedef std::shared_ptr<ClipRecorderWidget> Ptr;
+
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+        {
+            states.transform.translate(getPosition());
+            clipRect = tgui::Clipping::getClipRect(target);
+            visibleArea = tgui::Clipping::getVisibleArea(target, states);
+        }
+
+        tgui::Widget::Ptr clone() const override
+        {
+            return std::make_shared<ClipRecorderWidget>(*this);
+        }
+
+        mutable sf::IntRect clipRect;
+        mutable tgui::FloatRect visibleArea;
+    };
+}
 
 TEST_CASE("[Clipping]")
 {
@@ -120,4 +146,53 @@ TEST_CASE("[Clipping]")
 
         TEST_DRAW("Clipping_NestedLayers.png")
     }
+
+    SECTION("Nested scrollable panels")
+    {
+        auto outerPanel = tgui::ScrollablePanel::create({100, 100}, {300, 300});
+        outerPanel->setPosition({20, 20});
+        outerPanel->setScrollbarWidth(10);
+        TEST_DRAW_INIT(200, 200, outerPanel)
+
+        auto innerPanel = tgui::ScrollablePanel::create({80, 80}, {200, 200});
+        innerPanel->setPosition({50, 50});
+        innerPanel->setScrollbarWidth(10);
+        outerPanel->add(innerPanel);
+
+        auto recorder = std::make_shared<ClipRecorderWidget>();
+        recorder->setSize({10, 10});
+        innerPanel->add(recorder);
+
+        // The content of the outer panel is 90x90 and the one of the inner panel 70x70 because of the scrollbars
+        gui.draw();
+        REQUIRE(recorder->clipRect == sf::IntRect(70, 70, 40, 40));
+        REQUIRE(recorder->visibleArea == tgui::FloatRect(0, 0, 40, 40));
+
+        // Scrolling the outer panel moves the inner panel and thus its clipping area
+        outerPanel->mouseWheelScrolled(-1, {25, 25});
+        const float outerOffset = outerPanel->getContentOffset().y;
+        REQUIRE(outerOffset > 0);
+
+        const int clipTop = std::max(70 - static_cast<int>(outerOffset), 20);
+        const int clipBottom = std::min(140 - static_cast<int>(outerOffset), 110);
+        gui.draw();
+        REQUIRE(recorder->clipRect == sf::IntRect(70, clipTop, 40, clipBottom - clipTop));
+        REQUIRE(recorder->visibleArea == tgui::FloatRect(0, clipTop - (70 - outerOffset), 40, static_cast<float>(clipBottom - clipTop)));
+
+        // Scrolling the inner panel only changes which part of its contents is visible
+        innerPanel->mouseWheelScrolled(-1, {55, 55});
+        const float innerOffset = innerPanel->getContentOffset().y;
+        REQUIRE(innerOffset > 0);
+
+        gui.draw();
+        REQUIRE(recorder->clipRect == sf::IntRect(70, clipTop, 40, clipBottom - clipTop));
+        REQUIRE(recorder->visibleArea == tgui::FloatRect(0, clipTop - (70 - outerOffset) + innerOffset, 40, static_cast<float>(clipBottom - clipTop)));
+
+        // Nothing is visible when the panels are moved outside the view
+        outerPanel->setPosition({20, -100});
+        gui.draw();
+        REQUIRE(recorder->clipRect.width == 0);
+        REQUIRE(recorder->clipRect.height == 0);
+        REQUIRE(recorder->visibleArea == tgui::FloatRect());
+    }
 }
@@ -24,6 +24,46 @@
 
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
+#include <cstdio>
+#include <fstream>
+#include <future>
+
+namespace
+{
+    // Widget that can't be saved
+    class UnsavableWidget : public tgui::ClickableWidget
+    {
+    public:
+
+        tgui::Widget::Ptr clone() const override
+        {
+            return std::make_shared<UnsavableWidget>(*this);
+        }
+
+    protected:
+
+        std::unique_ptr<tgui::DataIO::Node> save(SavingRenderersMap&) const override
+        {
+            throw tgui::Exception{"UnsavableWidget can't be saved"};
+        }
+    };
+
+    // Button that can tell whether its text is still shared with another button
+    class TextSharingButton : public tgui::Button
+    {
+    public:
+
+        tgui::Widget::Ptr clone() const override
+        {
+            return std::make_shared<TextSharingButton>(*this);
+        }
+
+        bool isSharingTextWith(const TextSharingButton& other) const
+        {
+            return m_text.isSharingDataWith(other.m_text);
+        }
+    };
+}
 
 TEST_CASE("[Container]")
 {
@@ -181,6 +221,48 @@ TEST_CASE("[Container]")
         }
     }
 
+    SECTION("bulk changes")
+    {
+        std::vector<tgui::Widget::Ptr> labels;
+        for (unsigned int i = 0; i < 10; ++i)
+            labels.push_back(tgui::Label::create());
+        labels[4] = tgui::EditBox::create();
+
+        container->addWidgets(labels);
+        REQUIRE(container->getWidgets().size() == 13);
+        REQUIRE(container->getWidgetName(labels[0]) == "");
+        REQUIRE_THROWS_AS(container->addWidgets({tgui::Label::create()}, {"a", "b"}), tgui::Exception);
+
+        // Remove the panel and every other label
+        labels[4]->setFocused(true);
+        REQUIRE(container->removeWidgets([&](const tgui::Widget::Ptr& widget){
+            const auto it = std::find(labels.begin(), labels.end(), widget);
+            return (widget == widget2) || ((it != labels.end()) && ((it - labels.begin()) % 2 == 0));
+        }) == 6);
+        REQUIRE(container->getWidgets().size() == 7);
+        REQUIRE(container->getWidgets()[0] == widget1);
+        REQUIRE(container->getWidgetName(widget1) == "w1");
+        REQUIRE(container->getWidgetName(widget3) == "w3");
+        REQUIRE(widget2->getParent() == nullptr);
+        REQUIRE(!labels[4]->isFocused());
+
+        // Names stay with their widgets when the order changes
+        std::vector<tgui::Widget::Ptr> reversed(container->getWidgets().rbegin(), container->getWidgets().rend());
+        REQUIRE(container->reorder(reversed));
+        REQUIRE(container->getWidgets().back() == widget1);
+        REQUIRE(container->getWidgetNames().back() == "w1");
+        REQUIRE(container->getWidgetName(widget3) == "w3");
+        REQUIRE(!container->reorder({widget1}));
+
+        container->getContainer()->moveWidgetToBack(widget1);
+        REQUIRE(container->getWidgets().front() == widget1);
+        REQUIRE(container->setWidgetName(widget1, "first"));
+        REQUIRE(container->getWidgetNames().front() == "first");
+        REQUIRE(container->remove(widget1));
+        REQUIRE(!container->setWidgetName(widget1, "removed"));
+        REQUIRE(container->getWidgetName(widget3) == "w3");
+    }
+
     SECTION("widget name")
     {
         REQUIRE(container->getWidgetNames().size() == 3);
@@ -265,6 +347,208 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("inheritance")
+    {
+        // A font with different metrics than the global font, so that texts change size when it is used
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        font.setDistanceFieldEnabled(true, 7);
+
+        auto label = tgui::Label::create("Text");
+        label->setTextSize(30);
+        widget2->add(label);
+
+        auto labelWithFont = tgui::Label::create("Text");
+        labelWithFont->setTextSize(30);
+        labelWithFont->setInheritedFont(font);
+        REQUIRE(label->getSize() != labelWithFont->getSize());
+
+        // The font is passed to the children immediately, so their size changes without drawing them
+        container->setFont(font);
+        REQUIRE(label->getInheritedFont() == font);
+        REQUIRE(label->getSize() == labelWithFont->getSize());
+
+        // The opacity is combined with the opacity of every parent in between
+        container->setOpacity(0.5f);
+        widget2->getRenderer()->setOpacity(0.5f);
+        REQUIRE(widget1->getInheritedOpacity() == 0.5f);
+        REQUIRE(widget2->getInheritedOpacity() == 0.5f);
+        REQUIRE(label->getInheritedOpacity() == 0.25f);
+
+        // Drawing doesn't overwrite the value that is set on the child
+        widget4->setInheritedOpacity(0.2f);
+
+        sf::RenderTexture target;
+        target.create(100, 100);
+        container->setTarget(target);
+        container->draw();
+        REQUIRE(widget4->getInheritedOpacity() == 0.2f);
+        REQUIRE(widget5->getInheritedOpacity() == 0.25f);
+        REQUIRE(label->getInheritedOpacity() == 0.25f);
+
+        // A widget that is added copies the values immediately
+        auto addedLabel = tgui::Label::create("Text");
+        addedLabel->setTextSize(30);
+        widget2->add(addedLabel);
+        REQUIRE(addedLabel->getInheritedOpacity() == 0.25f);
+        REQUIRE(addedLabel->getSize() == labelWithFont->getSize());
+    }
+
+    SECTION("update scheduling")
+    {
+        // The function is protected in most widgets, but public in the base class
+        auto isUpdateRequired = [](const tgui::Widget::Ptr& widget){ return widget->isUpdateRequired(); };
+
+        // Nothing has to be updated when there are no animations
+        REQUIRE(!isUpdateRequired(container->getContainer()));
+        REQUIRE(!isUpdateRequired(widget2));
+
+        // Animating a nested widget makes all its parents require updates
+        widget4->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(100));
+        REQUIRE(isUpdateRequired(widget4));
+        REQUIRE(isUpdateRequired(widget2));
+        REQUIRE(isUpdateRequired(container->getContainer()));
+        REQUIRE(!isUpdateRequired(widget1));
+
+        container->updateTime(sf::milliseconds(50));
+        REQUIRE(isUpdateRequired(widget4));
+
+        // Once the animation has finished, the widgets are no longer updated
+        container->updateTime(sf::milliseconds(50));
+        REQUIRE(!isUpdateRequired(widget4));
+        REQUIRE(!isUpdateRequired(widget2));
+        REQUIRE(!isUpdateRequired(container->getContainer()));
+
+        // Removing an animated widget also removes it from the updated widgets
+        widget5->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(100));
+        REQUIRE(isUpdateRequired(container->getContainer()));
+        widget2->remove(widget5);
+        REQUIRE(!isUpdateRequired(widget2));
+        REQUIRE(!isUpdateRequired(container->getContainer()));
+
+        // Adding an animated widget makes the container require updates again
+        container->add(widget5);
+        REQUIRE(isUpdateRequired(container->getContainer()));
+
+        // A focused edit box keeps being updated to make its caret blink
+        auto editBox = tgui::EditBox::create();
+        widget2->add(editBox);
+        REQUIRE(!isUpdateRequired(widget2));
+        editBox->setFocused(true);
+        REQUIRE(isUpdateRequired(widget2));
+        editBox->setFocused(false);
+        REQUIRE(!isUpdateRequired(widget2));
+    }
+
+    SECTION("clone")
+    {
+        widget2->setInheritedFont(tgui::Font{"resources/DejaVuSans.ttf"});
+        widget2->setInheritedOpacity(0.5f);
+        widget4->setText("Original");
+
+        auto panel = tgui::Panel::copy(widget2);
+        REQUIRE(panel->getWidgets().size() == 2);
+        REQUIRE(panel->getWidgetNames()[1] == "w5");
+
+        // The children of the copy inherit the same font and opacity without them being set again
+        auto label = panel->get<tgui::Label>("w4");
+        REQUIRE(label != widget4);
+        REQUIRE(label->getParent() == panel.get());
+        REQUIRE(label->getInheritedFont() == widget4->getInheritedFont());
+        REQUIRE(label->getInheritedOpacity() == widget4->getInheritedOpacity());
+
+        // Changing the copy doesn't change the original
+        label->setText("Copy");
+        REQUIRE(widget4->getText() == "Original");
+    }
+
+    SECTION("clone shares text")
+    {
+        const tgui::Font font{"resources/DejaVuSans.ttf"};
+        auto panel1 = tgui::Panel::create();
+        auto panel2 = tgui::Panel::create();
+        panel1->getRenderer()->setFont(font);
+        panel2->getRenderer()->setFont(font);
+
+        auto button = std::make_shared<TextSharingButton>();
+        button->setText("Shared");
+        panel1->add(button);
+
+        // Adding the copy to a panel with the same font doesn't give it its own text
+        auto copy = std::static_pointer_cast<TextSharingButton>(button->clone());
+        panel2->add(copy);
+        REQUIRE(copy->isSharingTextWith(*button));
+
+        copy->setText("Copy");
+        REQUIRE(!copy->isSharingTextWith(*button));
+        REQUIRE(button->getText() == "Shared");
+    }
+
+    SECTION("detached widgets")
+    {
+        std::stringstream stream{"Button.Btn1 { Text = \"1\"; }\n"
+                                 "Picture.Pic { Renderer { Texture = \"resources/image.png\"; } }\n"
+                                 "EditBox.Edit { Size = (100, 20); }\n"};
+
+        auto future = std::async(std::launch::async, [&stream]{ return tgui::Container::loadDetachedWidgetsFromStream(stream); });
+        auto detachedWidgets = future.get();
+        REQUIRE(detachedWidgets.widgets.size() == 3);
+        REQUIRE(detachedWidgets.widgetNames[1] == "Pic");
+        REQUIRE(detachedWidgets.pendingTextures.size() == 1);
+
+        // The size of the texture is already known before it is uploaded
+        REQUIRE(detachedWidgets.widgets[1]->getSize() == sf::Vector2f(50, 50));
+
+        container->addDetachedWidgets(std::move(detachedWidgets));
+        REQUIRE(container->getWidgets().size() == 6);
+        REQUIRE(container->get("Btn1") != nullptr);
+        REQUIRE(container->get<tgui::EditBox>("Edit")->getSize() == sf::Vector2f(100, 20));
+        REQUIRE(detachedWidgets.widgets.empty());
+
+        std::stringstream invalidStream{"UnknownWidget { }"};
+        REQUIRE_THROWS_AS(tgui::Container::loadDetachedWidgetsFromStream(invalidStream), tgui::Exception);
+    }
+
+    SECTION("saving")
+    {
+        auto listBox = tgui::ListBox::create();
+        listBox->getRenderer()->setScrollbar(tgui::RendererData::create({{"trackcolor", tgui::Color::Red}}));
+        widget2->add(listBox, "List");
+
+        std::stringstream stream;
+        container->saveWidgetsToStream(stream);
+
+        // The renderer shared by the labels is written once, before the widgets that use it
+        const std::string str = stream.str();
+        REQUIRE(str.find("Renderer.1 {") == 0);
+        REQUIRE(str.find("Renderer.2 {") == std::string::npos);
+        REQUIRE(str.find("scrollbar {") != std::string::npos);
+
+        auto gui = std::make_shared<tgui::Gui>();
+        gui->loadWidgetsFromStream(stream);
+        REQUIRE(gui->get("w1")->getSharedRenderer()->getData() == gui->get("w4")->getSharedRenderer()->getData());
+        REQUIRE(gui->get<tgui::ListBox>("List")->getSharedRenderer()->getScrollbar()->propertyValuePairs["trackcolor"].getColor() == tgui::Color::Red);
+
+        std::stringstream stream2;
+        gui->saveWidgetsToStream(stream2);
+        REQUIRE(stream2.str() == str);
+
+        // The existing file is kept when saving fails, and an unrelated file with the name of a temporary file is left alone
+        std::ofstream{"ContainerWidgetFile.txt.tmp"} << "Not a widget file";
+        REQUIRE_NOTHROW(container->saveWidgetsToFile("ContainerWidgetFile.txt"));
+        container->add(std::make_shared<UnsavableWidget>());
+        REQUIRE_THROWS_AS(container->saveWidgetsToFile("ContainerWidgetFile.txt"), tgui::Exception);
+        REQUIRE(!std::ifstream{"ContainerWidgetFile.txt.tmp1"}.is_open());
+
+        std::string unrelatedFileContents;
+        std::getline(std::ifstream{"ContainerWidgetFile.txt.tmp"}, unrelatedFileContents);
+        REQUIRE(unrelatedFileContents == "Not a widget file");
+        std::remove("ContainerWidgetFile.txt.tmp");
+
+        auto gui2 = std::make_shared<tgui::Gui>();
+        REQUIRE_NOTHROW(gui2->loadWidgetsFromFile("ContainerWidgetFile.txt"));
+        REQUIRE(gui2->get<tgui::ListBox>("List") != nullptr);
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
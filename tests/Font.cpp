@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Font.hpp>
+#include <TGUI/Text.hpp>
 
 TEST_CASE("[Font]")
 {
@@ -35,4 +36,121 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font1).getFont() != nullptr);
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
+
+    SECTION("Distance field")
+    {
+        tgui::Font font("resources/DejaVuSans.ttf");
+        REQUIRE(!font.isDistanceFieldEnabled());
+        REQUIRE(font.getDistanceFieldReferenceSize() == 0);
+        REQUIRE(font.getDistanceFieldTexture() == nullptr);
+
+        const float lineSpacing = font.getLineSpacing(40);
+        const float advance = font.getGlyph('A', 40, false).advance;
+
+        font.setDistanceFieldEnabled(true, 40);
+        REQUIRE(font.isDistanceFieldEnabled());
+        REQUIRE(font.getDistanceFieldReferenceSize() == 40);
+        REQUIRE(font.getDistanceFieldTexture() != nullptr);
+        REQUIRE_THROWS_AS(font.setDistanceFieldEnabled(true, 0), tgui::Exception);
+
+        // Metrics are scaled from the reference size
+        REQUIRE(font.getLineSpacing(20) == Approx(lineSpacing / 2));
+        REQUIRE(font.getGlyph('A', 20, false).advance == Approx(advance / 2));
+        REQUIRE(font.getGlyph('A', 80, false).advance == Approx(advance * 2));
+
+        // Copies share the distance field, earlier copies don't
+        tgui::Font copy = font;
+        REQUIRE(copy.isDistanceFieldEnabled());
+        REQUIRE(copy.getDistanceFieldTexture() == font.getDistanceFieldTexture());
+        REQUIRE(copy == font);
+
+        tgui::Font otherDistanceField = font;
+        otherDistanceField.setDistanceFieldEnabled(true, 40);
+        REQUIRE(otherDistanceField != font);
+
+        tgui::Font withoutDistanceField = font;
+        withoutDistanceField.setDistanceFieldEnabled(false);
+        REQUIRE(withoutDistanceField != font);
+
+        font.loadDistanceFieldGlyphs("Hello world", false);
+        const sf::Glyph& glyph = font.getDistanceFieldGlyph('H', false);
+        REQUIRE(glyph.textureRect.width > 0);
+        REQUIRE(glyph.textureRect.height > 0);
+        REQUIRE(font.getDistanceFieldGlyph(' ', false).textureRect.width == 0);
+
+        // Rendering text at many sizes doesn't make the texture grow
+        const sf::Vector2u textureSize = font.getDistanceFieldTexture()->getSize();
+        sf::RenderTexture target;
+        target.create(200, 100);
+        tgui::Text text;
+        text.setFont(font);
+        text.setString("Hello world");
+        for (unsigned int size = 8; size < 100; ++size)
+        {
+            text.setCharacterSize(size);
+            REQUIRE(text.findCharacterPos(11).x == Approx(text.getSize().x));
+            text.draw(target, {});
+        }
+        REQUIRE(font.getDistanceFieldTexture()->getSize() == textureSize);
+
+        font.setDistanceFieldEnabled(false);
+        REQUIRE(!font.isDistanceFieldEnabled());
+        REQUIRE(font.getLineSpacing(40) == lineSpacing);
+        REQUIRE(copy.isDistanceFieldEnabled());
+    }
+
+    SECTION("Warm-up")
+    {
+        tgui::Font font("resources/DejaVuSans.ttf");
+        REQUIRE(font.getUsedCharacterSizes().empty());
+        REQUIRE(font.getGlyphCacheStatistics().pageCount == 0);
+
+        font.warmUp("abc", {20, 12}, true);
+        REQUIRE(font.getUsedCharacterSizes() == std::vector<unsigned int>{12, 20});
+        REQUIRE(font.getGlyphCacheStatistics().pageCount == 2);
+        REQUIRE(font.getGlyphCacheStatistics().textureBytes > 0);
+        REQUIRE(font.getGlyphCacheStatistics().glyphsWarmedUp == 12);
+
+        // Fonts wrapping the same sf::Font share the statistics
+        tgui::Font wrapper(font.getFont());
+        wrapper.getGlyph('x', 30, false);
+        REQUIRE(font.getUsedCharacterSizes() == std::vector<unsigned int>{12, 20, 30});
+        REQUIRE(tgui::Font(font1).getUsedCharacterSizes().empty());
+
+        SECTION("Spread over several calls")
+        {
+            REQUIRE(font.continueWarmUp(sf::Time::Zero));
+
+            font.queueWarmUp("0123456789", {16});
+            REQUIRE(font.isWarmUpPending());
+            REQUIRE(font.getGlyphCacheStatistics().glyphsPending == 10);
+
+            // Queued sizes don't have a glyph page yet
+            REQUIRE(font.getUsedCharacterSizes() == std::vector<unsigned int>{12, 16, 20, 30});
+            REQUIRE(font.getGlyphCacheStatistics().pageCount == 3);
+
+            // At least one glyph is loaded even when there is no time
+            REQUIRE(!font.continueWarmUp(sf::Time::Zero));
+            REQUIRE(font.getGlyphCacheStatistics().glyphsPending == 9);
+
+            REQUIRE(font.continueWarmUp(sf::seconds(10)));
+            REQUIRE(!font.isWarmUpPending());
+            REQUIRE(font.getGlyphCacheStatistics().glyphsPending == 0);
+            REQUIRE(font.getGlyphCacheStatistics().glyphsWarmedUp == 22);
+            REQUIRE(font.getGlyphCacheStatistics().pageCount == 4);
+        }
+
+        SECTION("Distance field")
+        {
+            font.setDistanceFieldEnabled(true, 40);
+            const tgui::Font::GlyphCacheStatistics statistics = font.getGlyphCacheStatistics();
+            REQUIRE(statistics.pageCount == 3);
+
+            // The glyphs are only loaded once for all sizes, at the reference size
+            font.warmUp("def", {12, 20, 30});
+            REQUIRE(font.getGlyphCacheStatistics().glyphsWarmedUp == statistics.glyphsWarmedUp + 3);
+            REQUIRE(font.getGlyphCacheStatistics().pageCount == 4);
+            REQUIRE(font.getDistanceFieldGlyph('d', false).textureRect.width > 0);
+        }
+    }
 }
@@ -0,0 +1,149 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+
+namespace
+{
+    sf::Event createMouseMoveEvent(int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        return event;
+    }
+
+    sf::Event createMouseButtonEvent(sf::Event::EventType type, int x, int y)
+    {
+        sf::Event event;
+        event.type = type;
+        event.mouseButton.button = sf::Mouse::Left;
+        event.mouseButton.x = x;
+        event.mouseButton.y = y;
+        return event;
+    }
+
+    sf::Event createTouchMoveEvent(unsigned int finger, int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::TouchMoved;
+        event.touch.finger = finger;
+        event.touch.x = x;
+        event.touch.y = y;
+        return event;
+    }
+}
+
+TEST_CASE("[Gui]")
+{
+    sf::RenderTexture target;
+    target.create(200, 200);
+    tgui::Gui gui{target};
+
+    auto button = tgui::Button::create();
+    button->setPosition(50, 50);
+    button->setSize(100, 100);
+    gui.add(button);
+
+    unsigned int mouseEnteredCount = 0;
+    unsigned int mouseLeftCount = 0;
+    unsigned int pressedCount = 0;
+    button->connect("MouseEntered", [&]{ genericCallback(mouseEnteredCount); });
+    button->connect("MouseLeft", [&]{ genericCallback(mouseLeftCount); });
+    button->connect("Pressed", [&]{ genericCallback(pressedCount); });
+
+    SECTION("Queued events")
+    {
+        gui.queueEvent(createMouseMoveEvent(10, 10));
+        gui.queueEvent(createMouseMoveEvent(60, 60));
+        gui.queueEvent(createMouseMoveEvent(70, 70));
+        gui.queueEvent(createMouseButtonEvent(sf::Event::MouseButtonPressed, 70, 70));
+        gui.queueEvent(createMouseButtonEvent(sf::Event::MouseButtonReleased, 70, 70));
+        gui.queueEvent(createMouseMoveEvent(5, 5));
+        gui.queueEvent(createMouseMoveEvent(80, 80));
+
+        // Nothing happens until the queue is handled
+        REQUIRE(mouseEnteredCount == 0);
+        REQUIRE(gui.getInputStatistics().queuedEvents == 7);
+        REQUIRE(gui.getInputStatistics().coalescedEvents == 3);
+        REQUIRE(gui.getInputStatistics().handledEvents == 0);
+
+        gui.handleQueuedEvents();
+        REQUIRE(gui.getInputStatistics().handledEvents == 4);
+        REQUIRE(gui.getInputStatistics().hitTests > 0);
+
+        // The mouse never left the button because the move to (5,5) was replaced by the next one
+        REQUIRE(mouseEnteredCount == 1);
+        REQUIRE(mouseLeftCount == 0);
+        REQUIRE(pressedCount == 1);
+
+        // The queue is empty after handling it
+        gui.handleQueuedEvents();
+        REQUIRE(gui.getInputStatistics().handledEvents == 4);
+
+        // The draw function also handles the queued events
+        gui.queueEvent(createMouseMoveEvent(5, 5));
+        gui.draw();
+        REQUIRE(mouseLeftCount == 1);
+        REQUIRE(gui.getInputStatistics().handledEvents == 5);
+    }
+
+    SECTION("Touch events")
+    {
+        gui.queueEvent(createTouchMoveEvent(0, 10, 10));
+        gui.queueEvent(createTouchMoveEvent(0, 20, 20));
+        gui.queueEvent(createTouchMoveEvent(1, 30, 30));
+        gui.queueEvent(createTouchMoveEvent(1, 40, 40));
+        REQUIRE(gui.getInputStatistics().coalescedEvents == 2);
+
+        // Moves are never merged across a move of another pointer
+        gui.queueEvent(createMouseMoveEvent(50, 50));
+        gui.queueEvent(createTouchMoveEvent(1, 60, 60));
+        gui.queueEvent(createMouseMoveEvent(70, 70));
+        gui.queueEvent(createTouchMoveEvent(0, 80, 80));
+        gui.queueEvent(createTouchMoveEvent(1, 90, 90));
+        REQUIRE(gui.getInputStatistics().coalescedEvents == 2);
+
+        gui.handleQueuedEvents();
+        REQUIRE(gui.getInputStatistics().handledEvents == 7);
+    }
+
+    SECTION("Input statistics")
+    {
+        const std::size_t hitTestsBefore = gui.getInputStatistics().hitTests;
+        gui.handleEvent(createMouseMoveEvent(70, 70));
+        REQUIRE(gui.getInputStatistics().handledEvents == 1);
+        REQUIRE(gui.getInputStatistics().hitTests == hitTestsBefore + 1);
+
+        gui.resetInputStatistics();
+        REQUIRE(gui.getInputStatistics().queuedEvents == 0);
+        REQUIRE(gui.getInputStatistics().coalescedEvents == 0);
+        REQUIRE(gui.getInputStatistics().handledEvents == 0);
+        REQUIRE(gui.getInputStatistics().hitTests == 0);
+    }
+}
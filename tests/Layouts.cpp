@@ -349,6 +349,39 @@ TEST_CASE("[Layouts]")
             widget->setPosition({"0"},{"0"});
             widget->setPosition("0","0");
         }
+
+        SECTION("Multiple widgets in one layout")
+        {
+            auto panel = std::make_shared<tgui::Panel>();
+            auto button1 = std::make_shared<tgui::Button>();
+            button1->setSize(100, 20);
+            panel->add(button1, "b1");
+            auto button2 = std::make_shared<tgui::Button>();
+            button2->setSize(30, 40);
+            panel->add(button2, "b2");
+
+            auto button3 = std::make_shared<tgui::Button>();
+            button3->setSize({"b1.width + b2.width", "(b1.height + b2.height) / 2"});
+            panel->add(button3);
+            REQUIRE(button3->getSize() == sf::Vector2f(130, 30));
+            REQUIRE(button3->getSizeLayout().toString() == "(b1.width + b2.width, (b1.height + b2.height) / 2)");
+
+            button2->setSize(50, 10);
+            REQUIRE(button3->getSize() == sf::Vector2f(150, 15));
+
+            // Copies of the layout find the widgets again when connected
+            auto button4 = std::make_shared<tgui::Button>(*button3);
+            panel->add(button4);
+            button1->setSize(200, 20);
+            REQUIRE(button3->getSize() == sf::Vector2f(250, 15));
+            REQUIRE(button4->getSize() == sf::Vector2f(250, 15));
+
+            panel->remove(button2);
+            button2 = nullptr;
+            REQUIRE(button3->getSize() == sf::Vector2f(250, 15));
+            button1->setSize(300, 20);
+            REQUIRE(button3->getSize() == sf::Vector2f(350, 15));
+        }
     }
 
     SECTION("Bug Fixes")
@@ -24,10 +24,10 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Global.hpp>
+#include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Label.hpp>
 
-// TODO: Reloading theme
-
 TEST_CASE("[Theme]")
 {
     SECTION("Loading")
@@ -63,6 +63,70 @@ TEST_CASE("[Theme]")
         }
     }
 
+    SECTION("Reloading")
+    {
+        tgui::Theme theme{"resources/ThemeReload1.txt"};
+
+        SECTION("Without widgets")
+        {
+            // Reading the values converts them to the type that is compared when reloading
+            tgui::ButtonRenderer renderer{theme.getRenderer("Button")};
+            REQUIRE(renderer.getTextColor() == sf::Color::Red);
+            const auto textureData = renderer.getTexture().getData();
+            REQUIRE(textureData != nullptr);
+
+            theme.load("resources/ThemeReload2.txt");
+            REQUIRE(theme.getReloadStatistics().renderersChanged == 1);
+            REQUIRE(theme.getReloadStatistics().propertiesUnchanged == 2);
+            REQUIRE(theme.getReloadStatistics().propertiesChanged == 3);
+            REQUIRE(theme.getReloadStatistics().notifications == 0);
+
+            REQUIRE(renderer.getTextColor() == sf::Color::Red);
+            REQUIRE(renderer.getTexture().getData() == textureData);
+            REQUIRE(renderer.getBackgroundColor() == sf::Color::Green);
+            REQUIRE(renderer.getBorders() == tgui::Borders{2});
+            REQUIRE(theme.getRenderer("Button")->propertyValuePairs.count("bordercolor") == 0);
+        }
+
+        SECTION("With widgets")
+        {
+            auto button1 = tgui::Button::create();
+            auto button2 = tgui::Button::create();
+            button1->setRenderer(theme.getRenderer("Button"));
+            button2->setRenderer(theme.getRenderer("Button"));
+            const auto textureData = button1->getSharedRenderer()->getTexture().getData();
+
+            theme.load("resources/ThemeReload2.txt");
+            REQUIRE(theme.getReloadStatistics().propertiesUnchanged == 2);
+            REQUIRE(theme.getReloadStatistics().propertiesChanged == 3);
+            REQUIRE(theme.getReloadStatistics().notifications == 6);
+            REQUIRE(button1->getSharedRenderer()->getTexture().getData() == textureData);
+            REQUIRE(button2->getSharedRenderer()->getBackgroundColor() == sf::Color::Green);
+
+            // Loading the same theme again doesn't reapply anything, not even the default values that the widgets added
+            theme.load("resources/ThemeReload2.txt");
+            REQUIRE(theme.getReloadStatistics().renderersChanged == 0);
+            REQUIRE(theme.getReloadStatistics().propertiesUnchanged == 4);
+            REQUIRE(theme.getReloadStatistics().propertiesChanged == 0);
+            REQUIRE(theme.getReloadStatistics().notifications == 0);
+        }
+
+        SECTION("Font warm-up")
+        {
+            theme.load("resources/ThemeReload2.txt");
+            REQUIRE(theme.getReloadStatistics().glyphsWarmedUp == 0);
+
+            tgui::getGlobalFont().getGlyph('x', 17, false);
+            theme.setFontWarmUp("abc");
+            theme.load("resources/ThemeReload2.txt");
+            REQUIRE(theme.getReloadStatistics().glyphsWarmedUp > 0);
+
+            const auto characterSizes = tgui::getGlobalFont().getUsedCharacterSizes();
+            REQUIRE(std::find(characterSizes.begin(), characterSizes.end(), 17) != characterSizes.end());
+            REQUIRE(std::find(characterSizes.begin(), characterSizes.end(), tgui::getGlobalTextSize()) != characterSizes.end());
+        }
+    }
+
     SECTION("Adding and removing renderers")
     {
         auto data = std::make_shared<tgui::RendererData>();
@@ -511,6 +511,46 @@ TEST_CASE("[Sprite]")
         }
     }
 
+    SECTION("Sprites with the same size and texture")
+    {
+        sprite.setTexture({"resources/image.png", {}, {10, 0, 30, 50}});
+        sprite.setSize({100, 30});
+        sprite.setColor(sf::Color::Red);
+
+        tgui::Sprite sprite2;
+        sprite2.setTexture({"resources/image.png", {}, {10, 0, 30, 50}});
+        sprite2.setSize({100, 30});
+        REQUIRE(sprite2.getScalingType() == tgui::Sprite::ScalingType::Horizontal);
+        REQUIRE(sprite2.getColor() == sf::Color::White);
+
+        sprite2.setSize({20, 60});
+        REQUIRE(sprite2.getScalingType() == tgui::Sprite::ScalingType::Normal);
+        REQUIRE(sprite.getScalingType() == tgui::Sprite::ScalingType::Horizontal);
+        REQUIRE(sprite.getColor() == sf::Color::Red);
+    }
+
+    SECTION("Adding triangles")
+    {
+        std::vector<sf::Vertex> vertices;
+        sprite.addTriangles(vertices);
+        REQUIRE(vertices.empty());
+
+        sprite.setTexture("resources/image.png");
+        sprite.setSize({40, 20});
+        sprite.setPosition({5, 6});
+        sprite.setColor(sf::Color::Red);
+        sprite.addTriangles(vertices, {100, 0});
+        REQUIRE(vertices.size() == 6);
+        REQUIRE(vertices[0].position == sf::Vector2f(105, 6));
+        REQUIRE(vertices[5].position == sf::Vector2f(145, 26));
+        REQUIRE(vertices[0].color == sf::Color::Red);
+
+        // Vertices are added behind the existing ones
+        sprite.addTriangles(vertices, {100, 20});
+        REQUIRE(vertices.size() == 12);
+        REQUIRE(vertices[6].position == sf::Vector2f(105, 26));
+    }
+
     SECTION("getTexture has a version to change the texture and a const version")
     {
         sprite.getTexture().setSmooth(false);
@@ -73,6 +73,29 @@ TEST_CASE("[Text]")
         REQUIRE(text.getStyle() == sf::Text::Italic);
     }
 
+    SECTION("Copies")
+    {
+        text.setFont("resources/DejaVuSans.ttf");
+        text.setString("Shared");
+        text.setCharacterSize(20);
+
+        // Changing a copy doesn't change the original
+        tgui::Text copy = text;
+        REQUIRE(copy.getString() == "Shared");
+        REQUIRE(copy.getSize() == text.getSize());
+
+        copy.setString("Changed");
+        copy.setStyle(sf::Text::Bold);
+        REQUIRE(copy.getString() == "Changed");
+        REQUIRE(text.getString() == "Shared");
+        REQUIRE(text.getStyle() == sf::Text::Regular);
+        REQUIRE(text.getCharacterSize() == 20);
+
+        text.setCharacterSize(30);
+        REQUIRE(copy.getCharacterSize() == 20);
+        REQUIRE(copy.getString() == "Changed");
+    }
+
     SECTION("Size")
     {
         text.setFont("resources/DejaVuSans.ttf");
@@ -26,6 +26,7 @@
 #include <TGUI/Gui.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
 
 TEST_CASE("[Widget]")
 {
@@ -162,6 +163,49 @@ TEST_CASE("[Widget]")
         REQUIRE(widget4->getPosition() == sf::Vector2f(400*0.2f, 300*0.1f));
     }
 
+    SECTION("Absolute position")
+    {
+        auto outerPanel = tgui::Panel::create();
+        outerPanel->setPosition(10, 20);
+        auto innerPanel = tgui::Panel::create();
+        innerPanel->setPosition(100, 50);
+        outerPanel->add(innerPanel);
+        innerPanel->add(widget);
+        widget->setPosition(5, 6);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(115, 76));
+
+        // The cached position is updated when the widget or one of its parents moves
+        outerPanel->setPosition(20, 30);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(125, 86));
+        innerPanel->setPosition(200, 50);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(225, 86));
+        widget->setPosition(7, 8);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(227, 88));
+
+        // Positions that depend on the size of the parent are updated as well
+        innerPanel->setSize(100, 200);
+        widget->setPosition("10%", "5%");
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(230, 90));
+        innerPanel->setSize(200, 400);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(240, 100));
+
+        // The cached position is updated when the offset of the parent changes
+        innerPanel->getRenderer()->setBorders({1, 2, 3, 4});
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(241, 102));
+
+        // The cached position is updated when the parent changes
+        widget->setPosition(5, 6);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(226, 88));
+        innerPanel->remove(widget);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(5, 6));
+        outerPanel->add(widget);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(25, 36));
+        outerPanel->remove(widget);
+        outerPanel->remove(innerPanel);
+        innerPanel->add(widget);
+        REQUIRE(widget->getAbsolutePosition() == sf::Vector2f(206, 58));
+    }
+
     SECTION("Size")
     {
         auto container = tgui::Panel::create();
@@ -280,6 +324,45 @@ TEST_CASE("[Widget]")
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
+    SECTION("User data")
+    {
+        REQUIRE_THROWS_AS(widget->getUserData<int>(), std::bad_cast);
+
+        widget->setUserData(5);
+        REQUIRE(widget->getUserData<int>() == 5);
+
+        widget->setToolTip(tgui::Label::create("Tool tip"));
+        REQUIRE(widget->getUserData<int>() == 5);
+        REQUIRE(widget->getToolTip() != nullptr);
+
+        widget->setToolTip(nullptr);
+        REQUIRE(widget->getToolTip() == nullptr);
+    }
+
+    SECTION("Memory report")
+    {
+        auto panel = tgui::Panel::create();
+        panel->add(widget);
+        panel->add(tgui::EditBox::create());
+        panel->add(tgui::EditBox::create());
+
+        const auto report = panel->getMemoryReport();
+        REQUIRE(report.widgetCount == 4);
+        REQUIRE(report.widgetTypes.at("Panel").widgetCount == 1);
+        REQUIRE(report.widgetTypes.at("EditBox").widgetCount == 2);
+        REQUIRE(report.widgetTypes.at("ClickableWidget").widgetCount == 1);
+        REQUIRE(report.subsystems.at("Widget") == 4 * sizeof(tgui::Widget));
+        REQUIRE(report.subsystems.at("Containers") > 0);
+
+        std::size_t totalBytes = 0;
+        for (const auto& pair : report.widgetTypes)
+            totalBytes += pair.second.bytes;
+        REQUIRE(report.totalBytes == totalBytes);
+
+        widget->setSize("parent.width / 2", 20);
+        REQUIRE(panel->getMemoryReport().subsystems.at("Layouts") > report.subsystems.at("Layouts"));
+    }
+
     SECTION("Saving and loading widget from file")
     {
         auto parent = tgui::Panel::create();
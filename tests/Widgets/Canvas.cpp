@@ -50,6 +50,63 @@ TEST_CASE("[Canvas]")
         testSavingWidget("Canvas", canvas, false);
     }
 
+    SECTION("Resizing and scrolling")
+    {
+        sf::RenderTexture target;
+        target.create(100, 50);
+        const auto getPixel = [&](unsigned int x, unsigned int y){
+                target.clear(sf::Color::Transparent);
+                canvas->draw(target, sf::RenderStates::Default);
+                target.display();
+                return target.getTexture().copyToImage().getPixel(x, y);
+            };
+
+        REQUIRE(canvas->getAutoClear());
+        canvas->setSize({40, 20});
+        canvas->clear(sf::Color::Red);
+        canvas->display();
+
+        // Growing the canvas keeps the contents and clears the new area
+        canvas->setSize({60, 30});
+        REQUIRE(getPixel(10, 10) == sf::Color::Red);
+        REQUIRE(getPixel(50, 25) == sf::Color::Black);
+
+        // Scrolling moves the contents and fills the area that becomes empty
+        canvas->scroll({-30, 0}, sf::Color::Blue);
+        canvas->display();
+        REQUIRE(getPixel(5, 5) == sf::Color::Red);
+        REQUIRE(getPixel(15, 5) == sf::Color::Black);
+        REQUIRE(getPixel(45, 5) == sf::Color::Blue);
+
+        // Drawing still uses the coordinates of the canvas, even when the shape is split over multiple parts of the texture
+        std::vector<sf::Vertex> vertices = {
+                {{20, 0}, sf::Color::Green},
+                {{40, 0}, sf::Color::Green},
+                {{20, 10}, sf::Color::Green},
+                {{40, 10}, sf::Color::Green}
+            };
+        canvas->draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip);
+        canvas->display();
+        REQUIRE(getPixel(25, 5) == sf::Color::Green);
+        REQUIRE(getPixel(35, 5) == sf::Color::Green);
+        REQUIRE(getPixel(45, 5) == sf::Color::Blue);
+
+        // The contents are also kept when a scrolled canvas is resized
+        canvas->setSize({50, 30});
+        REQUIRE(getPixel(5, 5) == sf::Color::Red);
+        REQUIRE(getPixel(35, 5) == sf::Color::Green);
+        REQUIRE(getPixel(45, 5) == sf::Color::Blue);
+
+        const std::vector<sf::Uint8> pixels(2 * 2 * 4, 255);
+        canvas->updatePixels(pixels.data(), 2, 2, 1, 1);
+        canvas->display();
+        REQUIRE(getPixel(0, 0) == sf::Color::Red);
+        REQUIRE(getPixel(2, 2) == sf::Color::White);
+
+        canvas->setAutoClear(false);
+        REQUIRE(!canvas->getAutoClear());
+    }
+
     SECTION("Draw")
     {
         TEST_DRAW_INIT(200, 150, canvas)
@@ -318,6 +318,119 @@ TEST_CASE("[EditBox]")
                 editBox->textEntered('.');
                 REQUIRE(editBox->getText() == "-.");
             }
+
+            SECTION("Replacing the decimal point")
+            {
+                sf::Event::KeyEvent keyEvent;
+                keyEvent.alt = false;
+                keyEvent.control = false;
+                keyEvent.shift = false;
+                keyEvent.system = false;
+
+                // Select "2.5" and type a new number
+                editBox->selectText(1, 3);
+                editBox->textEntered('3');
+                editBox->textEntered('.');
+                REQUIRE(editBox->getText() == "-3.");
+
+                keyEvent.code = sf::Keyboard::BackSpace;
+                editBox->keyPressed(keyEvent);
+                editBox->textEntered('1');
+                editBox->textEntered('.');
+                editBox->textEntered('5');
+                editBox->textEntered('.');
+                REQUIRE(editBox->getText() == "-31.5");
+
+                keyEvent.code = sf::Keyboard::Left;
+                editBox->keyPressed(keyEvent);
+                editBox->keyPressed(keyEvent);
+                editBox->textEntered('.');
+                REQUIRE(editBox->getText() == "-31.5");
+
+                keyEvent.code = sf::Keyboard::Delete;
+                editBox->keyPressed(keyEvent);
+                REQUIRE(editBox->getText() == "-315");
+                editBox->textEntered('.');
+                REQUIRE(editBox->getText() == "-31.5");
+            }
+        }
+
+        SECTION("Hex")
+        {
+            editBox->setInputValidator(tgui::EditBox::Validator::Hex);
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("09afAF");
+            REQUIRE(editBox->getText() == "09afAF");
+
+            editBox->setText("0x1F");
+            REQUIRE(editBox->getText() == "");
+
+            SECTION("Adding characters")
+            {
+                editBox->textEntered('c');
+                editBox->textEntered('G');
+                editBox->textEntered('7');
+                REQUIRE(editBox->getText() == "c7");
+            }
+        }
+
+        SECTION("Character set")
+        {
+            editBox->setInputValidator("[a-c_\\-]{0,4}");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("a-b_");
+            REQUIRE(editBox->getText() == "a-b_");
+
+            editBox->setText("a-b_c");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("abd");
+            REQUIRE(editBox->getText() == "");
+
+            SECTION("Adding characters")
+            {
+                editBox->textEntered('d');
+                editBox->textEntered('a');
+                editBox->textEntered('-');
+                editBox->textEntered('c');
+                editBox->textEntered('_');
+                editBox->textEntered('b');
+                REQUIRE(editBox->getText() == "a-c_");
+
+                // Replacing a selection doesn't exceed the maximum length
+                editBox->selectText(1, 2);
+                editBox->textEntered('b');
+                REQUIRE(editBox->getText() == "ab_");
+            }
+        }
+
+        SECTION("Custom regex")
+        {
+            editBox->setInputValidator("[a-z]+[0-9]*");
+            REQUIRE(editBox->getInputValidator() == "[a-z]+[0-9]*");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("abc123");
+            REQUIRE(editBox->getText() == "abc123");
+
+            SECTION("Adding characters")
+            {
+                editBox->textEntered('x');
+                REQUIRE(editBox->getText() == "abc123");
+
+                editBox->textEntered('4');
+                REQUIRE(editBox->getText() == "abc1234");
+            }
+
+            // Other edit boxes with the same regex behave identically
+            auto editBox2 = tgui::EditBox::create();
+            editBox2->setInputValidator("[a-z]+[0-9]*");
+            editBox2->setText("1a");
+            REQUIRE(editBox2->getText() == "");
+            editBox2->setText("a1");
+            REQUIRE(editBox2->getText() == "a1");
         }
     }
 
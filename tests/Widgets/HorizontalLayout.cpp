@@ -140,6 +140,35 @@ TEST_CASE("[HorizontalLayout]")
         REQUIRE(layout->get(0) == nullptr);
     }
 
+    SECTION("Bulk changes")
+    {
+        auto button1 = tgui::Button::create();
+        auto button2 = tgui::Button::create();
+        auto button3 = tgui::Button::create();
+        layout->addWidgets({button1, button2, button3}, {"1", "2", "3"});
+        REQUIRE(layout->getWidgets().size() == 3);
+        REQUIRE(button3->getPosition() == sf::Vector2f(2 * (800 * (1 / 3.f)), 0));
+        REQUIRE(button3->getFullSize() == sf::Vector2f(800 * (1 / 3.f), 1000));
+
+        // The ratios move together with the widgets
+        layout->setRatio(button3, 2);
+        REQUIRE(layout->reorder({button3, button1, button2}));
+        REQUIRE(layout->getWidgetName(layout->get(0)) == "3");
+        REQUIRE(layout->getRatio(0) == 2);
+        REQUIRE(layout->getRatio(button1) == 1);
+        REQUIRE(button3->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(button1->getPosition() == sf::Vector2f(400, 0));
+
+        REQUIRE(!layout->reorder({button3, button1}));
+        REQUIRE(!layout->reorder({button3, button1, button1}));
+
+        REQUIRE(layout->removeWidgets([&](const tgui::Widget::Ptr& widget){ return widget == button1; }) == 1);
+        REQUIRE(layout->getRatio(0) == 2);
+        REQUIRE(layout->getRatio(1) == 1);
+        REQUIRE(button3->getFullSize() == sf::Vector2f(800 * (2 / 3.f), 1000));
+        REQUIRE(button2->getPosition() == sf::Vector2f(800 * (2 / 3.f), 0));
+    }
+
     SECTION("Saving and loading from file")
     {
         tgui::Theme::getDefault()->addRenderer("Button", std::make_shared<tgui::RendererData>());
@@ -0,0 +1,335 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/ListView.hpp>
+#include <TGUI/Widgets/Group.hpp>
+
+TEST_CASE("[ListView]")
+{
+    tgui::ListView::Ptr listView = tgui::ListView::create();
+    listView->getRenderer()->setFont("resources/DejaVuSans.ttf");
+
+    SECTION("Signals")
+    {
+        REQUIRE_NOTHROW(listView->connect("ItemSelected", [](){}));
+        REQUIRE_NOTHROW(listView->connect("ItemSelected", [](int){}));
+        REQUIRE_NOTHROW(listView->connect("ItemSelected", [](tgui::Widget::Ptr, std::string){}));
+        REQUIRE_NOTHROW(listView->connect("ItemSelected", [](tgui::Widget::Ptr, std::string, int){}));
+
+        REQUIRE_NOTHROW(listView->connect("DoubleClicked", [](){}));
+        REQUIRE_NOTHROW(listView->connect("DoubleClicked", [](int){}));
+        REQUIRE_NOTHROW(listView->connect("DoubleClicked", [](tgui::Widget::Ptr, std::string){}));
+        REQUIRE_NOTHROW(listView->connect("DoubleClicked", [](tgui::Widget::Ptr, std::string, int){}));
+
+        REQUIRE_NOTHROW(listView->connect("HeaderClicked", [](){}));
+        REQUIRE_NOTHROW(listView->connect("HeaderClicked", [](int){}));
+        REQUIRE_NOTHROW(listView->connect("HeaderClicked", [](tgui::Widget::Ptr, std::string){}));
+        REQUIRE_NOTHROW(listView->connect("HeaderClicked", [](tgui::Widget::Ptr, std::string, int){}));
+    }
+
+    SECTION("WidgetType")
+    {
+        REQUIRE(listView->getWidgetType() == "ListView");
+    }
+
+    SECTION("Position and Size")
+    {
+        listView->setPosition(40, 30);
+        listView->setSize(150, 100);
+        listView->getRenderer()->setBorders(2);
+
+        REQUIRE(listView->getPosition() == sf::Vector2f(40, 30));
+        REQUIRE(listView->getSize() == sf::Vector2f(150, 100));
+        REQUIRE(listView->getFullSize() == listView->getSize());
+        REQUIRE(listView->getWidgetOffset() == sf::Vector2f(0, 0));
+    }
+
+    SECTION("Columns")
+    {
+        REQUIRE(listView->getColumnCount() == 0);
+
+        REQUIRE(listView->addColumn("Name", 120) == 0);
+        REQUIRE(listView->addColumn("Amount") == 1);
+        REQUIRE(listView->getColumnCount() == 2);
+        REQUIRE(listView->getColumnCaption(0) == "Name");
+        REQUIRE(listView->getColumnCaption(1) == "Amount");
+        REQUIRE(listView->getColumnCaption(2) == "");
+        REQUIRE(listView->getColumnWidth(0) == 120);
+        REQUIRE(listView->getColumnWidth(1) == 100);
+
+        listView->setColumnWidth(1, 60);
+        REQUIRE(listView->getColumnWidth(1) == 60);
+        REQUIRE(listView->getColumnWidth(2) == 0);
+
+        listView->removeAllColumns();
+        REQUIRE(listView->getColumnCount() == 0);
+    }
+
+    SECTION("Sizes")
+    {
+        listView->setRowHeight(25);
+        REQUIRE(listView->getRowHeight() == 25);
+
+        listView->setHeaderHeight(30);
+        REQUIRE(listView->getHeaderHeight() == 30);
+
+        listView->setTextSize(18);
+        REQUIRE(listView->getTextSize() == 18);
+    }
+
+    SECTION("Data provider")
+    {
+        listView->setSize(300, 120);
+        listView->setRowHeight(20);
+        listView->setHeaderHeight(20);
+        listView->getRenderer()->setBorders(0);
+        listView->getRenderer()->setPadding(0);
+        listView->addColumn("A", 80);
+        listView->addColumn("B", 80);
+        listView->addColumn("C", 80);
+
+        std::size_t providerCalls = 0;
+        listView->setDataProvider([&](std::size_t row, std::size_t column){
+                ++providerCalls;
+                return tgui::to_string(row) + "," + tgui::to_string(column);
+            }, 10000000);
+        REQUIRE(listView->getRowCount() == 10000000);
+
+        // Only the 5 rows that fit below the header are requested
+        REQUIRE(providerCalls == 15);
+
+        // Scrolling one row down only requests the row that became visible
+        listView->setVerticalScrollbarValue(20);
+        REQUIRE(providerCalls == 18);
+
+        // Scrolling within a row doesn't request anything new besides the partially visible row at the bottom
+        listView->setVerticalScrollbarValue(30);
+        REQUIRE(providerCalls == 21);
+        listView->setVerticalScrollbarValue(35);
+        REQUIRE(providerCalls == 21);
+
+        // Jumping far down the list costs the same as showing the first rows
+        listView->setVerticalScrollbarValue(20 * 5000000);
+        REQUIRE(listView->getVerticalScrollbarValue() == 20 * 5000000);
+        REQUIRE(providerCalls == 36);
+
+        providerCalls = 0;
+        listView->refreshRows();
+        REQUIRE(providerCalls == 15);
+
+        providerCalls = 0;
+        listView->setRowCount(2);
+        REQUIRE(listView->getVerticalScrollbarValue() == 0);
+        REQUIRE(providerCalls == 6);
+    }
+
+    SECTION("Selecting rows")
+    {
+        listView->addColumn("A");
+        listView->setDataProvider([](std::size_t, std::size_t){ return sf::String{"x"}; }, 100);
+
+        unsigned int itemSelectedCount = 0;
+        listView->connect("ItemSelected", [&](){ ++itemSelectedCount; });
+
+        REQUIRE(listView->getSelectedRow() == -1);
+
+        REQUIRE(listView->setSelectedRow(50));
+        REQUIRE(listView->getSelectedRow() == 50);
+        REQUIRE(itemSelectedCount == 1);
+
+        REQUIRE(!listView->setSelectedRow(100));
+        REQUIRE(listView->getSelectedRow() == -1);
+        REQUIRE(itemSelectedCount == 2);
+
+        listView->setSelectedRow(99);
+        listView->setRowCount(50);
+        REQUIRE(listView->getSelectedRow() == -1);
+
+        listView->setSelectedRow(10);
+        listView->deselectRow();
+        REQUIRE(listView->getSelectedRow() == -1);
+    }
+
+    SECTION("Sorting")
+    {
+        listView->addColumn("A");
+        listView->addColumn("B");
+        REQUIRE(listView->getSortColumn() == -1);
+
+        int sortedColumn = -1;
+        bool sortedAscending = false;
+        listView->setSortFunction([&](std::size_t column, bool ascending){ sortedColumn = static_cast<int>(column); sortedAscending = ascending; });
+
+        listView->sortByColumn(1, false);
+        REQUIRE(sortedColumn == 1);
+        REQUIRE(!sortedAscending);
+        REQUIRE(listView->getSortColumn() == 1);
+        REQUIRE(!listView->isSortedAscending());
+
+        // Invalid columns are ignored
+        listView->sortByColumn(2);
+        REQUIRE(listView->getSortColumn() == 1);
+    }
+
+    SECTION("Events / Signals")
+    {
+        auto container = tgui::Group::create({400.f, 300.f});
+        container->add(listView);
+
+        auto mouseMoved = [container](sf::Vector2i pos){
+            sf::Event event;
+            event.type = sf::Event::MouseMoved;
+            event.mouseMove.x = pos.x;
+            event.mouseMove.y = pos.y;
+            container->handleEvent(event);
+        };
+        auto mousePressed = [container](sf::Vector2i pos){
+            sf::Event event;
+            event.type = sf::Event::MouseButtonPressed;
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = pos.x;
+            event.mouseButton.y = pos.y;
+            container->handleEvent(event);
+        };
+        auto mouseReleased = [container](sf::Vector2i pos){
+            sf::Event event;
+            event.type = sf::Event::MouseButtonReleased;
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = pos.x;
+            event.mouseButton.y = pos.y;
+            container->handleEvent(event);
+        };
+
+        listView->setPosition(10, 20);
+        listView->setSize(200, 102);
+        listView->setRowHeight(20);
+        listView->setHeaderHeight(20);
+        listView->getRenderer()->setBorders(1);
+        listView->getRenderer()->setPadding(0);
+        listView->addColumn("A", 80);
+        listView->addColumn("B", 80);
+        listView->setDataProvider([](std::size_t, std::size_t){ return sf::String{"x"}; }, 3);
+
+        SECTION("Widget")
+        {
+            testWidgetSignals(listView);
+        }
+
+        SECTION("Click on row")
+        {
+            unsigned int itemSelectedCount = 0;
+            unsigned int doubleClickedCount = 0;
+            listView->connect("ItemSelected", [&](){ ++itemSelectedCount; });
+            listView->connect("DoubleClicked", [&](int row){ REQUIRE(row == 2); ++doubleClickedCount; });
+
+            // Select the third row
+            mouseMoved({50, 86});
+            mousePressed({50, 86});
+            mouseReleased({50, 86});
+            REQUIRE(itemSelectedCount == 1);
+            REQUIRE(listView->getSelectedRow() == 2);
+
+            container->update(sf::milliseconds(5));
+            mousePressed({50, 86});
+            mouseReleased({50, 86});
+            REQUIRE(doubleClickedCount == 1);
+            REQUIRE(itemSelectedCount == 1);
+
+            // Clicking below the last row deselects it
+            mousePressed({50, 110});
+            mouseReleased({50, 110});
+            REQUIRE(itemSelectedCount == 2);
+            REQUIRE(listView->getSelectedRow() == -1);
+        }
+
+        SECTION("Click on header")
+        {
+            std::vector<std::pair<std::size_t, bool>> sortCalls;
+            listView->setSortFunction([&](std::size_t column, bool ascending){ sortCalls.emplace_back(column, ascending); });
+
+            int clickedColumn = -1;
+            listView->connect("HeaderClicked", [&](int column){ clickedColumn = column; });
+
+            mousePressed({130, 30});
+            mouseReleased({130, 30});
+            REQUIRE(clickedColumn == 1);
+            REQUIRE(sortCalls.size() == 1);
+            REQUIRE(sortCalls[0] == std::make_pair(std::size_t{1}, true));
+
+            // Clicking the same column again reverses the order
+            mousePressed({130, 30});
+            mouseReleased({130, 30});
+            REQUIRE(sortCalls.size() == 2);
+            REQUIRE(sortCalls[1] == std::make_pair(std::size_t{1}, false));
+
+            // Releasing the mouse on a different column doesn't count as a click
+            mousePressed({50, 30});
+            mouseReleased({130, 30});
+            REQUIRE(sortCalls.size() == 2);
+            REQUIRE(listView->getSelectedRow() == -1);
+        }
+
+        SECTION("Click on scrollbar arrow")
+        {
+            std::size_t providerCalls = 0;
+            listView->getRenderer()->setScrollbarWidth(16);
+            listView->setDataProvider([&](std::size_t, std::size_t){ ++providerCalls; return sf::String{"x"}; }, 20);
+            REQUIRE(providerCalls == 8);
+
+            // The list scrolls one row down when the mouse is released on the down arrow
+            mousePressed({201, 113});
+            mouseReleased({201, 113});
+            REQUIRE(listView->getVerticalScrollbarValue() == 20);
+            REQUIRE(providerCalls == 10);
+        }
+    }
+
+    testWidgetRenderer(listView->getRenderer());
+    SECTION("Renderer")
+    {
+        auto renderer = listView->getRenderer();
+
+        renderer->setHeaderBackgroundColor({10, 20, 30});
+        renderer->setHeaderTextColor({40, 50, 60});
+        renderer->setSeparatorColor({70, 80, 90});
+        REQUIRE(renderer->getHeaderBackgroundColor() == sf::Color(10, 20, 30));
+        REQUIRE(renderer->getHeaderTextColor() == sf::Color(40, 50, 60));
+        REQUIRE(renderer->getSeparatorColor() == sf::Color(70, 80, 90));
+
+        REQUIRE_NOTHROW(renderer->setProperty("HeaderBackgroundColor", "rgb(100, 110, 120)"));
+        REQUIRE(renderer->getProperty("HeaderBackgroundColor").getColor() == sf::Color(100, 110, 120));
+    }
+
+    SECTION("Saving and loading from file")
+    {
+        listView->addColumn("Name", 150);
+        listView->addColumn("Amount", 60);
+        listView->setRowHeight(25);
+        listView->setHeaderHeight(30);
+        listView->setTextSize(20);
+
+        testSavingWidget("ListView", listView);
+    }
+}
@@ -222,6 +222,51 @@ TEST_CASE("[MenuBar]")
             testWidgetSignals(menuBar);
         }
 
+        SECTION("Open menu")
+        {
+            menuBar->setSize(400, 20);
+            menuBar->setMinimumSubMenuWidth(100);
+            menuBar->addMenu("File");
+            menuBar->addMenuItem("Load");
+            menuBar->addMenu("Edit");
+
+            REQUIRE(!menuBar->mouseOnWidget({10, 30}));
+
+            menuBar->leftMousePressed({10, 10});
+            menuBar->leftMouseReleased({10, 10});
+            REQUIRE(menuBar->mouseOnWidget({10, 30}));
+            REQUIRE(menuBar->mouseOnWidget({95, 30}));
+            REQUIRE(!menuBar->mouseOnWidget({105, 30}));
+            REQUIRE(!menuBar->mouseOnWidget({10, 45}));
+
+            // The open menu is resized when its items change
+            menuBar->addMenuItem("File", "A menu item that is a lot wider than the minimum width");
+            REQUIRE(menuBar->mouseOnWidget({105, 30}));
+            REQUIRE(menuBar->mouseOnWidget({10, 45}));
+
+            menuBar->removeMenuItem("File", "A menu item that is a lot wider than the minimum width");
+            REQUIRE(!menuBar->mouseOnWidget({105, 30}));
+            REQUIRE(!menuBar->mouseOnWidget({10, 45}));
+
+            menuBar->setInvertedMenuDirection(true);
+            REQUIRE(menuBar->mouseOnWidget({10, -10}));
+            REQUIRE(!menuBar->mouseOnWidget({10, 30}));
+            menuBar->setInvertedMenuDirection(false);
+
+            sf::String clickedItem;
+            menuBar->connect("MenuItemClicked", [&](sf::String item){ clickedItem = item; });
+            menuBar->mouseMoved({10, 30});
+            menuBar->leftMousePressed({10, 30});
+            menuBar->leftMouseReleased({10, 30});
+            REQUIRE(clickedItem == "Load");
+            REQUIRE(!menuBar->mouseOnWidget({10, 30}));
+
+            // Removing the open menu closes it
+            menuBar->leftMousePressed({10, 10});
+            menuBar->removeMenu("File");
+            REQUIRE(!menuBar->mouseOnWidget({10, 30}));
+        }
+
         /// TODO
     }
 
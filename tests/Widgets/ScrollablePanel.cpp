@@ -75,6 +75,21 @@ TEST_CASE("[ScrollablePanel]")
             panel->getRenderer()->setBorders({1, 2, 3, 4});
             REQUIRE(childWidget->getPosition() == sf::Vector2f(60, 50));
             REQUIRE(childWidget->getAbsolutePosition() == sf::Vector2f(101, 82));
+
+            // Scrolling moves the child widgets
+            panel->setContentSize({300, 300});
+            panel->mouseWheelScrolled(-1, {100, 80});
+            REQUIRE(panel->getContentOffset().y > 0);
+            REQUIRE(childWidget->getAbsolutePosition() == sf::Vector2f(101, 82 - panel->getContentOffset().y));
+
+            // Clicking the down arrow of the vertical scrollbar also moves them
+            const float scrollbarWidth = panel->getScrollbarWidth();
+            const sf::Vector2f downArrowPos = {40 + 150 - 3 - (scrollbarWidth / 2.f), 30 + 100 - 4 - scrollbarWidth - (scrollbarWidth / 2.f)};
+            const float oldOffset = panel->getContentOffset().y;
+            panel->leftMousePressed(downArrowPos);
+            panel->leftMouseReleased(downArrowPos);
+            REQUIRE(panel->getContentOffset().y > oldOffset);
+            REQUIRE(childWidget->getAbsolutePosition() == sf::Vector2f(101, 82 - panel->getContentOffset().y));
         }
     }
 
@@ -176,6 +176,115 @@ TEST_CASE("[TextBox]")
         REQUIRE(textBox->getLinesCount() == 4);
     }
 
+    SECTION("Appending text")
+    {
+        textBox->setSize(150, 100);
+
+        sf::String text;
+        for (unsigned int i = 0; i < 50; ++i)
+        {
+            const sf::String chunk = "Some words in chunk " + tgui::to_string(i) + ((i % 3 == 0) ? "\n" : " ");
+            textBox->addText(chunk);
+            text += chunk;
+        }
+        REQUIRE(textBox->getText() == text);
+
+        // Only wrapping the last line gives the same result as wrapping the whole text
+        auto textBox2 = tgui::TextBox::create();
+        textBox2->setSize(150, 100);
+        textBox2->setText(text);
+        REQUIRE(textBox->getLinesCount() == textBox2->getLinesCount());
+        REQUIRE(textBox->getCaretPosition() == text.getSize());
+
+        // The caret doesn't move when it isn't at the end of the text
+        textBox->setCaretPosition(5);
+        textBox->addText("More text");
+        REQUIRE(textBox->getCaretPosition() == 5);
+        REQUIRE(textBox->getText() == text + "More text");
+    }
+
+    SECTION("LineLimit")
+    {
+        REQUIRE(textBox->getLineLimit() == 0);
+
+        sf::String text;
+        for (unsigned int i = 0; i < 20; ++i)
+            text += "Line " + tgui::to_string(i) + "\n";
+        textBox->setText(text);
+        REQUIRE(textBox->getLinesCount() == 21);
+
+        textBox->setLineLimit(10);
+        REQUIRE(textBox->getLineLimit() == 10);
+        REQUIRE(textBox->getLinesCount() == 10);
+        REQUIRE(textBox->getText().substring(0, 8) == "Line 11\n");
+
+        // A quarter of the lines is removed when the limit is exceeded by adding text
+        for (unsigned int i = 20; i < 30; ++i)
+        {
+            textBox->addText("Line " + tgui::to_string(i) + "\n");
+            REQUIRE(textBox->getLinesCount() <= 10);
+            REQUIRE(textBox->getLinesCount() >= 7);
+        }
+        REQUIRE(textBox->getText().substring(textBox->getText().getSize() - 8) == "Line 29\n");
+
+        textBox->setText(text);
+        REQUIRE(textBox->getLinesCount() == 10);
+    }
+
+    SECTION("CharacterLimit")
+    {
+        REQUIRE(textBox->getCharacterLimit() == 0);
+
+        textBox->setText("0123\n4567\n89");
+        textBox->setCharacterLimit(7);
+        REQUIRE(textBox->getCharacterLimit() == 7);
+        REQUIRE(textBox->getText() == "4567\n89");
+
+        textBox->addText("\nabc");
+        REQUIRE(textBox->getText() == "89\nabc");
+
+        textBox->addText("\nde");
+        REQUIRE(textBox->getText() == "abc\nde");
+    }
+
+    SECTION("Long text")
+    {
+        sf::String text;
+        for (unsigned int i = 0; i < 1000; ++i)
+            text += "Line " + tgui::to_string(i) + "\n";
+        text += "Last line";
+
+        textBox->setSize(200, 100);
+        textBox->setText(text);
+        REQUIRE(textBox->getLinesCount() == 1001);
+
+        // Selecting everything keeps the whole text selected, even though only a few lines are visible
+        sf::Event::KeyEvent event;
+        event.control = true;
+        event.alt     = false;
+        event.shift   = false;
+        event.system  = false;
+        event.code    = sf::Keyboard::A;
+        textBox->keyPressed(event);
+        REQUIRE(textBox->getSelectedText() == text);
+
+        TEST_DRAW_INIT(200, 100, textBox)
+        gui.draw();
+
+        // Scrolling up to the top keeps the selection
+        textBox->mouseWheelScrolled(5000, {100, 50});
+        gui.draw();
+        REQUIRE(textBox->getSelectedText() == text);
+
+        // Editing the last line, which is no longer visible after scrolling up
+        event.control = false;
+        event.code = sf::Keyboard::End;
+        textBox->keyPressed(event);
+        textBox->textEntered('!');
+        REQUIRE(textBox->getText() == text + "!");
+        gui.draw();
+    }
+
     SECTION("Events / Signals")
     {
         textBox->setSize(165, 100);
@@ -479,6 +588,8 @@ TEST_CASE("[TextBox]")
         textBox->setMaximumCharacters(16);
         textBox->setReadOnly(true);
         textBox->setVerticalScrollbarPresent(false);
+        textBox->setLineLimit(50);
+        textBox->setCharacterLimit(1000);
 
         testSavingWidget("TextBox", textBox);
     }
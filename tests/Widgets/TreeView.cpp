@@ -0,0 +1,339 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/TreeView.hpp>
+#include <TGUI/Widgets/Group.hpp>
+
+TEST_CASE("[TreeView]")
+{
+    tgui::TreeView::Ptr treeView = tgui::TreeView::create();
+    treeView->getRenderer()->setFont("resources/DejaVuSans.ttf");
+
+    std::vector<std::vector<sf::String>> requestedHierarchies;
+    auto provider = [&](const std::vector<sf::String>& hierarchy){
+            requestedHierarchies.push_back(hierarchy);
+
+            std::vector<tgui::TreeView::Item> items;
+            if (hierarchy.empty())
+                items = {{"A", true}, {"B", false}};
+            else if (hierarchy == std::vector<sf::String>{"A"})
+                items = {{"C1", true}, {"C2", false}};
+            else if (hierarchy == std::vector<sf::String>{"A", "C1"})
+                items = {{"D", false}};
+            return items;
+        };
+
+    SECTION("Signals")
+    {
+        REQUIRE_NOTHROW(treeView->connect("ItemSelected", [](){}));
+        REQUIRE_NOTHROW(treeView->connect("ItemSelected", [](sf::String){}));
+        REQUIRE_NOTHROW(treeView->connect("ItemSelected", [](std::vector<sf::String>){}));
+        REQUIRE_NOTHROW(treeView->connect("ItemSelected", [](tgui::Widget::Ptr, std::string){}));
+        REQUIRE_NOTHROW(treeView->connect("ItemSelected", [](tgui::Widget::Ptr, std::string, std::vector<sf::String>){}));
+
+        REQUIRE_NOTHROW(treeView->connect("DoubleClicked", [](){}));
+        REQUIRE_NOTHROW(treeView->connect("DoubleClicked", [](sf::String){}));
+        REQUIRE_NOTHROW(treeView->connect("DoubleClicked", [](std::vector<sf::String>){}));
+
+        REQUIRE_NOTHROW(treeView->connect("Expanded", [](){}));
+        REQUIRE_NOTHROW(treeView->connect("Expanded", [](std::vector<sf::String>){}));
+
+        REQUIRE_NOTHROW(treeView->connect("Collapsed", [](){}));
+        REQUIRE_NOTHROW(treeView->connect("Collapsed", [](std::vector<sf::String>){}));
+    }
+
+    SECTION("WidgetType")
+    {
+        REQUIRE(treeView->getWidgetType() == "TreeView");
+    }
+
+    SECTION("Position and Size")
+    {
+        treeView->setPosition(40, 30);
+        treeView->setSize(150, 100);
+        treeView->getRenderer()->setBorders(2);
+
+        REQUIRE(treeView->getPosition() == sf::Vector2f(40, 30));
+        REQUIRE(treeView->getSize() == sf::Vector2f(150, 100));
+        REQUIRE(treeView->getFullSize() == treeView->getSize());
+        REQUIRE(treeView->getWidgetOffset() == sf::Vector2f(0, 0));
+    }
+
+    SECTION("Sizes")
+    {
+        treeView->setItemHeight(25);
+        REQUIRE(treeView->getItemHeight() == 25);
+
+        treeView->setTextSize(18);
+        REQUIRE(treeView->getTextSize() == 18);
+    }
+
+    SECTION("Lazy loading")
+    {
+        treeView->setChildrenProvider(provider);
+        REQUIRE(requestedHierarchies.size() == 1);
+        REQUIRE(requestedHierarchies[0].empty());
+        REQUIRE(treeView->getVisibleItemCount() == 2);
+        REQUIRE(treeView->getLoadedItemCount() == 2);
+
+        // Children are only requested when their parent is expanded for the first time
+        REQUIRE(treeView->expand({"A"}));
+        REQUIRE(requestedHierarchies.size() == 2);
+        REQUIRE(requestedHierarchies[1] == std::vector<sf::String>{"A"});
+        REQUIRE(treeView->isExpanded({"A"}));
+        REQUIRE(treeView->getVisibleItemCount() == 4);
+        REQUIRE(treeView->getLoadedItemCount() == 4);
+
+        REQUIRE(treeView->collapse({"A"}));
+        REQUIRE(!treeView->isExpanded({"A"}));
+        REQUIRE(treeView->getVisibleItemCount() == 2);
+        REQUIRE(treeView->getLoadedItemCount() == 4);
+
+        REQUIRE(treeView->expand({"A"}));
+        REQUIRE(requestedHierarchies.size() == 2);
+        REQUIRE(treeView->getVisibleItemCount() == 4);
+
+        // Items without children can't be expanded
+        REQUIRE(!treeView->expand({"B"}));
+        REQUIRE(!treeView->expand({"A", "C2"}));
+        REQUIRE(!treeView->expand({"X"}));
+        REQUIRE(requestedHierarchies.size() == 2);
+
+        // Expanding a deeper item expands its parents as well
+        treeView->collapseAll();
+        REQUIRE(treeView->getVisibleItemCount() == 2);
+        REQUIRE(treeView->expand({"A", "C1"}));
+        REQUIRE(requestedHierarchies.size() == 3);
+        REQUIRE(treeView->getVisibleItemCount() == 5);
+
+        // The expanded children are shown again when their parent is expanded again
+        REQUIRE(treeView->collapse({"A"}));
+        REQUIRE(treeView->getVisibleItemCount() == 2);
+        REQUIRE(treeView->isExpanded({"A", "C1"}));
+        REQUIRE(treeView->expand({"A"}));
+        REQUIRE(treeView->getVisibleItemCount() == 5);
+
+        // Reloading requests the children again
+        REQUIRE(treeView->reloadChildren({"A"}));
+        REQUIRE(requestedHierarchies.size() == 4);
+        REQUIRE(requestedHierarchies[3] == std::vector<sf::String>{"A"});
+        REQUIRE(treeView->getVisibleItemCount() == 4);
+        REQUIRE(treeView->getLoadedItemCount() == 4);
+        REQUIRE(!treeView->reloadChildren({"X"}));
+
+        REQUIRE(treeView->reloadChildren());
+        REQUIRE(requestedHierarchies.size() == 5);
+        REQUIRE(requestedHierarchies[4].empty());
+        REQUIRE(treeView->getVisibleItemCount() == 2);
+        REQUIRE(treeView->getLoadedItemCount() == 2);
+    }
+
+    SECTION("Large trees")
+    {
+        unsigned int providerCalls = 0;
+        treeView->setChildrenProvider([&](const std::vector<sf::String>& hierarchy){
+                ++providerCalls;
+
+                std::vector<tgui::TreeView::Item> items;
+                if (hierarchy.size() < 2)
+                {
+                    items.resize(hierarchy.empty() ? 10 : 100000);
+                    for (std::size_t i = 0; i < items.size(); ++i)
+                        items[i] = {tgui::to_string(i), hierarchy.empty()};
+                }
+                return items;
+            });
+
+        REQUIRE(treeView->expand({"5"}));
+        REQUIRE(providerCalls == 2);
+        REQUIRE(treeView->getVisibleItemCount() == 100010);
+        REQUIRE(treeView->getLoadedItemCount() == 100010);
+
+        // Items far below the visible part of the tree can be selected
+        REQUIRE(treeView->setSelectedItem({"5", "99999"}));
+        REQUIRE(treeView->getSelectedItem() == std::vector<sf::String>{"5", "99999"});
+        REQUIRE(treeView->getScrollbarValue() > 0);
+
+        REQUIRE(treeView->collapse({"5"}));
+        REQUIRE(treeView->getVisibleItemCount() == 10);
+        REQUIRE(treeView->getSelectedItem().empty());
+        REQUIRE(providerCalls == 2);
+    }
+
+    SECTION("Selecting items")
+    {
+        treeView->setChildrenProvider(provider);
+
+        unsigned int itemSelectedCount = 0;
+        treeView->connect("ItemSelected", [&](){ ++itemSelectedCount; });
+
+        REQUIRE(treeView->getSelectedItem().empty());
+
+        // Selecting an item expands its parents
+        REQUIRE(treeView->setSelectedItem({"A", "C1", "D"}));
+        REQUIRE(treeView->getSelectedItem() == std::vector<sf::String>{"A", "C1", "D"});
+        REQUIRE(treeView->isExpanded({"A", "C1"}));
+        REQUIRE(itemSelectedCount == 1);
+
+        REQUIRE(!treeView->setSelectedItem({"A", "X"}));
+        REQUIRE(treeView->getSelectedItem().empty());
+        REQUIRE(itemSelectedCount == 2);
+
+        // Hidden items are deselected
+        REQUIRE(treeView->setSelectedItem({"A", "C2"}));
+        REQUIRE(treeView->collapse({"A"}));
+        REQUIRE(treeView->getSelectedItem().empty());
+
+        REQUIRE(treeView->setSelectedItem({"B"}));
+        treeView->deselectItem();
+        REQUIRE(treeView->getSelectedItem().empty());
+    }
+
+    SECTION("Events / Signals")
+    {
+        auto container = tgui::Group::create({400.f, 300.f});
+        container->add(treeView);
+
+        auto mouseMoved = [container](sf::Vector2i pos){
+            sf::Event event;
+            event.type = sf::Event::MouseMoved;
+            event.mouseMove.x = pos.x;
+            event.mouseMove.y = pos.y;
+            container->handleEvent(event);
+        };
+        auto mousePressed = [container](sf::Vector2i pos){
+            sf::Event event;
+            event.type = sf::Event::MouseButtonPressed;
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = pos.x;
+            event.mouseButton.y = pos.y;
+            container->handleEvent(event);
+        };
+        auto mouseReleased = [container](sf::Vector2i pos){
+            sf::Event event;
+            event.type = sf::Event::MouseButtonReleased;
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = pos.x;
+            event.mouseButton.y = pos.y;
+            container->handleEvent(event);
+        };
+
+        treeView->setPosition(10, 20);
+        treeView->setSize(200, 102);
+        treeView->setItemHeight(20);
+        treeView->getRenderer()->setBorders(1);
+        treeView->getRenderer()->setPadding(0);
+        treeView->setChildrenProvider(provider);
+
+        SECTION("Widget")
+        {
+            testWidgetSignals(treeView);
+        }
+
+        SECTION("Expand and collapse")
+        {
+            std::vector<sf::String> expandedItem;
+            std::vector<sf::String> collapsedItem;
+            treeView->connect("Expanded", [&](std::vector<sf::String> item){ expandedItem = item; });
+            treeView->connect("Collapsed", [&](std::vector<sf::String> item){ collapsedItem = item; });
+
+            // Clicking on the arrow in front of the first item expands it
+            mouseMoved({20, 31});
+            mousePressed({20, 31});
+            mouseReleased({20, 31});
+            REQUIRE(expandedItem == std::vector<sf::String>{"A"});
+            REQUIRE(treeView->getVisibleItemCount() == 4);
+            REQUIRE(treeView->getSelectedItem().empty());
+
+            mousePressed({20, 31});
+            mouseReleased({20, 31});
+            REQUIRE(collapsedItem == std::vector<sf::String>{"A"});
+            REQUIRE(treeView->getVisibleItemCount() == 2);
+        }
+
+        SECTION("Click on item")
+        {
+            unsigned int itemSelectedCount = 0;
+            unsigned int doubleClickedCount = 0;
+            treeView->connect("ItemSelected", [&](){ ++itemSelectedCount; });
+            treeView->connect("DoubleClicked", [&](std::vector<sf::String> item){ REQUIRE(item == std::vector<sf::String>{"A"}); ++doubleClickedCount; });
+
+            mouseMoved({100, 31});
+            mousePressed({100, 31});
+            mouseReleased({100, 31});
+            REQUIRE(itemSelectedCount == 1);
+            REQUIRE(treeView->getSelectedItem() == std::vector<sf::String>{"A"});
+
+            // Double clicking an item expands it
+            container->update(sf::milliseconds(5));
+            mousePressed({100, 31});
+            mouseReleased({100, 31});
+            REQUIRE(doubleClickedCount == 1);
+            REQUIRE(itemSelectedCount == 1);
+            REQUIRE(treeView->isExpanded({"A"}));
+
+            // Clicking below the last item deselects it
+            mousePressed({100, 111});
+            mouseReleased({100, 111});
+            REQUIRE(itemSelectedCount == 2);
+            REQUIRE(treeView->getSelectedItem().empty());
+        }
+
+        SECTION("Click on scrollbar arrow")
+        {
+            treeView->setItemHeight(30);
+            treeView->getRenderer()->setScrollbarWidth(16);
+            treeView->getRenderer()->setBackgroundColor(sf::Color::White);
+            treeView->getRenderer()->setSelectedBackgroundColor(sf::Color::Red);
+            REQUIRE(treeView->expand({"A", "C1"}));
+            REQUIRE(treeView->setSelectedItem({"A"}));
+            REQUIRE(treeView->getVisibleItemCount() == 5);
+
+            // The tree scrolls one item down when the mouse is released on the down arrow
+            mousePressed({201, 113});
+            mouseReleased({201, 113});
+            REQUIRE(treeView->getScrollbarValue() == 30);
+
+            // The selected item is no longer drawn at the top
+            sf::RenderTexture target;
+            target.create(400, 300);
+            target.clear();
+            treeView->draw(target, {});
+            target.display();
+            REQUIRE(target.getTexture().copyToImage().getPixel(180, 25) == sf::Color::White);
+        }
+    }
+
+    testWidgetRenderer(treeView->getRenderer());
+
+    SECTION("Saving and loading from file")
+    {
+        treeView->setItemHeight(25);
+        treeView->setTextSize(20);
+
+        testSavingWidget("TreeView", treeView);
+    }
+}